@@ -3,9 +3,17 @@
 
 #include "BotaniCommonMovementSettings.h"
 
+#include "BotaniMoverSettingsHelpers.h"
+
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniCommonMovementSettings)
 
+void FBotaniResolvedMovementSettings::UpdateDerivedValues()
+{
+	// Derived values, so nobody has to do trigonometry per tick
+	MaxWalkSlopeAngleSine = FMath::Sqrt(FMath::Max(0.f, 1.f - FMath::Square(MaxWalkSlopeAngleCosine)));
+}
+
 UBotaniCommonMovementSettings::UBotaniCommonMovementSettings()
 	: bShouldRemainUpright(true)
 	, bIgnoreBaseRotation(false)
@@ -51,7 +59,105 @@ UBotaniCommonMovementSettings::UBotaniCommonMovementSettings()
 {
 }
 
+void UBotaniCommonMovementSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	UpdateResolvedSettings();
+}
+
+void UBotaniCommonMovementSettings::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	UpdateResolvedSettings();
+}
+
+void UBotaniCommonMovementSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	UpdateResolvedSettings();
+
 #if WITH_EDITOR
+	BindCurveTableDelegates();
+#endif
+}
+
+void UBotaniCommonMovementSettings::RebuildResolvedSettings()
+{
+	if (BotaniMover::Settings::CanModifySettings(this))
+	{
+		UpdateResolvedSettings();
+	}
+}
+
+void UBotaniCommonMovementSettings::UpdateResolvedSettings()
+{
+	const float Level = SettingsLevel;
+	FBotaniResolvedMovementSettings& Resolved = ResolvedSettings;
+
+	Resolved.MaxSpeed = MaxSpeed.GetValueAtLevel(Level);
+	Resolved.MaxStepHeight = MaxStepHeight.GetValueAtLevel(Level);
+	Resolved.Acceleration = Acceleration.GetValueAtLevel(Level);
+	Resolved.Deceleration = Deceleration.GetValueAtLevel(Level);
+	Resolved.TurningRate = TurningRate.GetValueAtLevel(Level);
+	Resolved.TurningBoost = TurningBoost.GetValueAtLevel(Level);
+	Resolved.GroundFriction = GroundFriction.GetValueAtLevel(Level);
+	Resolved.BrakingFriction = BrakingFriction.GetValueAtLevel(Level);
+	Resolved.BrakingFrictionFactor = BrakingFrictionFactor.GetValueAtLevel(Level);
+	Resolved.MaxWalkSlopeAngleCosine = MaxWalkSlopeAngleCosine.GetValueAtLevel(Level);
+	Resolved.SlopeBoostMultiplier = SlopeBoostMultiplier.GetValueAtLevel(Level);
+	Resolved.MaxSprintSpeed = MaxSprintSpeed.GetValueAtLevel(Level);
+	Resolved.SprintAcceleration = SprintAcceleration.GetValueAtLevel(Level);
+	Resolved.SprintDeceleration = SprintDeceleration.GetValueAtLevel(Level);
+	Resolved.SprintTurningRate = SprintTurningRate.GetValueAtLevel(Level);
+	Resolved.SprintTurningBoost = SprintTurningBoost.GetValueAtLevel(Level);
+	Resolved.AirControlPct = AirControlPct.GetValueAtLevel(Level);
+	Resolved.FallingDeceleration = FallingDeceleration.GetValueAtLevel(Level);
+	Resolved.OverTerminalSpeedFallingDeceleration = OverTerminalSpeedFallingDeceleration.GetValueAtLevel(Level);
+	Resolved.TerminalMovementPlaneSpeed = TerminalMovementPlaneSpeed.GetValueAtLevel(Level);
+	Resolved.VerticalFallingDeceleration = VerticalFallingDeceleration.GetValueAtLevel(Level);
+	Resolved.TerminalVerticalSpeed = TerminalVerticalSpeed.GetValueAtLevel(Level);
+	Resolved.MinTimeBetweenJumps = MinTimeBetweenJumps.GetValueAtLevel(Level);
+	Resolved.CoyoteTime = CoyoteTime.GetValueAtLevel(Level);
+	Resolved.JumpVerticalImpulse = JumpVerticalImpulse.GetValueAtLevel(Level);
+	Resolved.JumpHoldTime = JumpHoldTime.GetValueAtLevel(Level);
+	Resolved.ExtraJumpVerticalImpulse = ExtraJumpVerticalImpulse.GetValueAtLevel(Level);
+	Resolved.JumpAirControlPct = JumpAirControlPct.GetValueAtLevel(Level);
+	Resolved.MaxJumpPreviousVelocity = MaxJumpPreviousVelocity.GetValueAtLevel(Level);
+	Resolved.UpdateDerivedValues();
+
+	++ResolvedSettingsRevision;
+}
+
+void UBotaniCommonMovementSettings::SetSettingsLevel(float InLevel)
+{
+	if (SettingsLevel == InLevel || !BotaniMover::Settings::CanModifySettings(this))
+	{
+		return;
+	}
+
+	SettingsLevel = InLevel;
+	UpdateResolvedSettings();
+}
+
+#if WITH_EDITOR
+void UBotaniCommonMovementSettings::BindCurveTableDelegates()
+{
+	// Keep the snapshot in sync with curve table edits
+	BotaniMover::Settings::ForEachReferencedCurveTable(this, [this](UCurveTable* CurveTable)
+	{
+		CurveTable->OnCurveTableChanged().RemoveAll(this);
+		CurveTable->OnCurveTableChanged().AddUObject(this, &ThisClass::HandleCurveTableChanged);
+	});
+}
+
+void UBotaniCommonMovementSettings::HandleCurveTableChanged()
+{
+	UpdateResolvedSettings();
+}
+
 void UBotaniCommonMovementSettings::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
 {
 	UObject::PostEditChangeProperty(PropertyChangedEvent);
@@ -83,5 +189,8 @@ void UBotaniCommonMovementSettings::PostEditChangeProperty(struct FPropertyChang
 			}
 		}
 	}
+
+	UpdateResolvedSettings();
+	BindCurveTableDelegates();
 }
 #endif
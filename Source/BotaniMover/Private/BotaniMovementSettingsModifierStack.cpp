@@ -0,0 +1,174 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMovementSettingsModifierStack.h"
+
+#include "BotaniMoverLogChannels.h"
+#include "Algo/BinarySearch.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMovementSettingsModifierStack)
+
+void FBotaniMovementSettingsModifierStack::Push(
+	const FName Source,
+	TConstArrayView<FBotaniMovementSettingsDelta> Deltas,
+	const int32 Priority)
+{
+	Pop(Source);
+
+	FEntry NewEntry;
+	NewEntry.Source = Source;
+	NewEntry.Priority = Priority;
+
+	// Resolve the setting names once, so resolving the stack is just pointer math
+	const UScriptStruct* SettingsStruct = FBotaniResolvedMovementSettings::StaticStruct();
+	for (const FBotaniMovementSettingsDelta& Delta : Deltas)
+	{
+		const FFloatProperty* FloatProperty = CastField<FFloatProperty>(SettingsStruct->FindPropertyByName(Delta.Setting));
+		if (FloatProperty == nullptr)
+		{
+			BOTANIMOVER_WARN("Movement settings modifier '%s' references unknown setting '%s'", *Source.ToString(), *Delta.Setting.ToString());
+			continue;
+		}
+
+		FCompiledDelta& CompiledDelta = NewEntry.Deltas.AddDefaulted_GetRef();
+		CompiledDelta.Offset = FloatProperty->GetOffset_ForInternal();
+		CompiledDelta.Op = Delta.Op;
+		CompiledDelta.Value = Delta.Value;
+	}
+
+	// Keep the entries sorted by priority, after any entries of equal priority
+	const int32 InsertIndex = Algo::UpperBoundBy(Entries, Priority, &FEntry::Priority);
+	Entries.Insert(MoveTemp(NewEntry), InsertIndex);
+
+	bDirty = true;
+}
+
+bool FBotaniMovementSettingsModifierStack::Pop(const FName Source)
+{
+	const int32 NumRemoved = Entries.RemoveAll([Source](const FEntry& Entry)
+	{
+		return Entry.Source == Source;
+	});
+
+	if (NumRemoved > 0)
+	{
+		bDirty = true;
+		return true;
+	}
+
+	return false;
+}
+
+bool FBotaniMovementSettingsModifierStack::Contains(const FName Source) const
+{
+	return Entries.ContainsByPredicate([Source](const FEntry& Entry)
+	{
+		return Entry.Source == Source;
+	});
+}
+
+const FBotaniResolvedMovementSettings& FBotaniMovementSettingsModifierStack::Resolve(const UBotaniCommonMovementSettings& BaseSettings) const
+{
+	// Nothing to do if neither the stack nor the base settings changed
+	if (!bDirty &&
+		CachedBaseSettings.Get() == &BaseSettings &&
+		CachedBaseRevision == BaseSettings.GetResolvedSettingsRevision())
+	{
+		return EffectiveSettings;
+	}
+
+	EffectiveSettings = BaseSettings.GetResolvedSettings();
+
+	for (const FEntry& Entry : Entries)
+	{
+		for (const FCompiledDelta& Delta : Entry.Deltas)
+		{
+			float& Value = *reinterpret_cast<float*>(reinterpret_cast<uint8*>(&EffectiveSettings) + Delta.Offset);
+			switch (Delta.Op)
+			{
+			case EBotaniSettingsModifierOp::Add:
+				Value += Delta.Value;
+				break;
+
+			case EBotaniSettingsModifierOp::Multiply:
+				Value *= Delta.Value;
+				break;
+
+			case EBotaniSettingsModifierOp::Override:
+				Value = Delta.Value;
+				break;
+			}
+		}
+	}
+
+	EffectiveSettings.UpdateDerivedValues();
+
+	CachedBaseSettings = &BaseSettings;
+	CachedBaseRevision = BaseSettings.GetResolvedSettingsRevision();
+	bDirty = false;
+
+	return EffectiveSettings;
+}
+
+void FBotaniMovementSettingsModifierHistory::Record(const double SimTimeMs, const FBotaniMovementSettingsModifierStack& Stack, const double MaxAgeMs)
+{
+	// Changes are recorded in simulation order, anything later belongs to a timeline we left
+	while (!Snapshots.IsEmpty() && Snapshots.Last().SimTimeMs >= SimTimeMs)
+	{
+		Snapshots.Pop(EAllowShrinking::No);
+	}
+
+	if (Snapshots.Num() >= MaxSnapshots)
+	{
+		Snapshots.RemoveAt(0, 1, EAllowShrinking::No);
+		bTrimmed = true;
+	}
+
+	FSnapshot& Snapshot = Snapshots.AddDefaulted_GetRef();
+	Snapshot.SimTimeMs = SimTimeMs;
+	Snapshot.Stack = Stack;
+
+	// A state is only needed while a rollback could still land before its successor took over
+	const double OldestSimTimeMs = SimTimeMs - MaxAgeMs;
+	int32 NumExpired = 0;
+	while (NumExpired + 1 < Snapshots.Num() && Snapshots[NumExpired + 1].SimTimeMs <= OldestSimTimeMs)
+	{
+		++NumExpired;
+	}
+
+	if (NumExpired > 0)
+	{
+		Snapshots.RemoveAt(0, NumExpired, EAllowShrinking::No);
+		bTrimmed = true;
+	}
+}
+
+bool FBotaniMovementSettingsModifierHistory::Restore(const double SimTimeMs, FBotaniMovementSettingsModifierStack& OutStack)
+{
+	while (!Snapshots.IsEmpty() && Snapshots.Last().SimTimeMs > SimTimeMs)
+	{
+		Snapshots.Pop(EAllowShrinking::No);
+	}
+
+	if (!Snapshots.IsEmpty())
+	{
+		OutStack = Snapshots.Last().Stack;
+		return true;
+	}
+
+	// Nothing was pushed before the first recorded change
+	if (!bTrimmed)
+	{
+		OutStack = FBotaniMovementSettingsModifierStack();
+		return true;
+	}
+
+	return false;
+}
+
+void FBotaniMovementSettingsModifierHistory::Reset()
+{
+	Snapshots.Reset();
+	bTrimmed = false;
+}
@@ -0,0 +1,195 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverFreeSpaceBubble.h"
+
+#include "BotaniMoverStats.h"
+#include "Engine/World.h"
+
+bool FBotaniMoverFreeSpaceBubble::Establish(
+	UWorld* World,
+	const FPlacement& Placement,
+	const float Margin,
+	const double SimTimeMs,
+	const double LifetimeMs,
+	const double RetryIntervalMs,
+	const ECollisionChannel CollisionChannel,
+	const FCollisionQueryParams& QueryParams,
+	const FCollisionResponseParams& ResponseParams)
+{
+	check(World);
+
+	Invalidate();
+	EstablishSimTimeMs = SimTimeMs;
+	NextEstablishSimTimeMs = SimTimeMs + RetryIntervalMs;
+
+	// Without a gap to the supporting surface, the box would always overlap it
+	const bool bSupported = !Placement.SupportNormal.IsNearlyZero();
+	if (bSupported && Placement.SupportGap <= UE_KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	// Rest one side of the box on the supporting surface, either the floor below (Z) or a wall next to us (X)
+	const FVector PlanarSupport = FVector::VectorPlaneProject(Placement.SupportNormal, Placement.UpDirection);
+	const bool bSupportedFromSide = bSupported && !PlanarSupport.IsNearlyZero(UE_KINDA_SMALL_NUMBER) && FMath::Abs(Placement.SupportNormal | Placement.UpDirection) < UE_KINDA_SMALL_NUMBER;
+	Rotation = bSupportedFromSide
+		? FRotationMatrix::MakeFromZX(Placement.UpDirection, PlanarSupport).ToQuat()
+		: FRotationMatrix::MakeFromZ(Placement.UpDirection).ToQuat();
+
+	MinOffset = FVector(-Margin);
+	MaxOffset = FVector(Margin);
+
+	if (bSupportedFromSide)
+	{
+		MinOffset.X = -Placement.SupportGap * 0.5f;
+	}
+	else if (bSupported)
+	{
+		// Supporting surfaces that are neither floors nor walls would cut through the box
+		const float SupportDot = Placement.SupportNormal | Placement.UpDirection;
+		if (FMath::Abs(SupportDot) < 1.f - UE_KINDA_SMALL_NUMBER)
+		{
+			return false;
+		}
+
+		if (SupportDot > 0.f)
+		{
+			MinOffset.Z = -Placement.SupportGap * 0.5f;
+		}
+		else
+		{
+			MaxOffset.Z = Placement.SupportGap * 0.5f;
+		}
+	}
+
+	// The capsule is aligned with the box, so it's inside as long as its center stays within the offsets
+	CapsuleExtent = FVector(Placement.CapsuleRadius, Placement.CapsuleRadius, Placement.CapsuleHalfHeight);
+	const FVector BoxMin = MinOffset - CapsuleExtent;
+	const FVector BoxMax = MaxOffset + CapsuleExtent;
+
+	Origin = Placement.Location;
+	Center = Origin + Rotation.RotateVector((BoxMin + BoxMax) * 0.5f);
+	HalfExtent = (BoxMax - BoxMin) * 0.5f;
+
+	if (World->OverlapBlockingTestByChannel(Center, Rotation, CollisionChannel, FCollisionShape::MakeBox(HalfExtent), QueryParams, ResponseParams))
+	{
+		return false;
+	}
+
+	ExpireSimTimeMs = SimTimeMs + LifetimeMs;
+	bValid = true;
+	return true;
+}
+
+bool FBotaniMoverFreeSpaceBubble::Validate(UWorld* World, const double SimTimeMs)
+{
+	if (!bValid)
+	{
+		return false;
+	}
+
+	// Rolled back to before the bubble existed, or it got too old
+	if (SimTimeMs < EstablishSimTimeMs || SimTimeMs >= ExpireSimTimeMs)
+	{
+		Invalidate();
+		return false;
+	}
+
+	if (bRecheckPending)
+	{
+		// Until the recheck is done we can't tell whether something moved in, so the move has to sweep
+		FOverlapDatum Datum;
+		if (!World || !World->QueryOverlapData(RecheckHandle, Datum))
+		{
+			return false;
+		}
+
+		bRecheckPending = false;
+
+		for (const FOverlapResult& Overlap : Datum.OutOverlaps)
+		{
+			if (Overlap.bBlockingHit)
+			{
+				Invalidate();
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FBotaniMoverFreeSpaceBubble::Contains(const FVector& Location, const FVector& Delta) const
+{
+	if (!bValid)
+	{
+		return false;
+	}
+
+	// The box is convex, so the swept capsule is inside if both ends are
+	const FVector StartOffset = Rotation.UnrotateVector(Location - Origin);
+	const FVector EndOffset = Rotation.UnrotateVector(Location + Delta - Origin);
+
+	return StartOffset.ComponentwiseAllGreaterOrEqual(MinOffset) && StartOffset.ComponentwiseAllLessOrEqual(MaxOffset)
+		&& EndOffset.ComponentwiseAllGreaterOrEqual(MinOffset) && EndOffset.ComponentwiseAllLessOrEqual(MaxOffset);
+}
+
+bool FBotaniMoverFreeSpaceBubble::IsMoveClearOfDynamics(
+	const UWorld* World,
+	const FVector& Location,
+	const FVector& Delta,
+	const ECollisionChannel CollisionChannel,
+	const FCollisionQueryParams& QueryParams,
+	const FCollisionResponseParams& DynamicResponseParams) const
+{
+	check(World);
+
+	// Other pawns and movable props may have moved in since the last recheck, and they may have done the same with us
+	const FVector MoveExtent = CapsuleExtent + Rotation.UnrotateVector(Delta).GetAbs() * 0.5f;
+	return !World->OverlapBlockingTestByChannel(Location + Delta * 0.5f, Rotation, CollisionChannel, FCollisionShape::MakeBox(MoveExtent), QueryParams, DynamicResponseParams);
+}
+
+void FBotaniMoverFreeSpaceBubble::RequestRecheck(
+	UWorld* World,
+	const ECollisionChannel CollisionChannel,
+	const FCollisionQueryParams& QueryParams,
+	const FCollisionResponseParams& ResponseParams)
+{
+	check(World);
+
+	if (!bValid)
+	{
+		return;
+	}
+
+	// The engine batches all async queries of a frame and runs them off the game thread
+	RecheckHandle = World->AsyncOverlapByChannel(Center, Rotation, CollisionChannel, FCollisionShape::MakeBox(HalfExtent), QueryParams, ResponseParams);
+	bRecheckPending = true;
+}
+
+void FBotaniMoverFreeSpaceBubble::Invalidate()
+{
+	bValid = false;
+	bRecheckPending = false;
+	RecheckHandle = FTraceHandle();
+}
+
+void FBotaniMoverFreeSpaceBubble::Reset()
+{
+	Invalidate();
+	EstablishSimTimeMs = 0.0;
+	NextEstablishSimTimeMs = 0.0;
+}
+
+void FBotaniMoverFreeSpaceBubble::RecordHit()
+{
+	++NumHits;
+	INC_DWORD_STAT(STAT_BotaniMover_FreeSpaceHits);
+}
+
+void FBotaniMoverFreeSpaceBubble::RecordMiss()
+{
+	++NumMisses;
+	INC_DWORD_STAT(STAT_BotaniMover_FreeSpaceMisses);
+}
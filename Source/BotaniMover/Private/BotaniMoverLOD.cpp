@@ -0,0 +1,97 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverLOD.h"
+
+#include "BotaniMoverStats.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMoverLOD)
+
+bool FBotaniMoverLODSelector::Update(
+	const TArray<FBotaniMoverLODTier>& Tiers,
+	const FBotaniMoverLODInputs& Inputs,
+	const float Hysteresis,
+	const float MinDwellTime)
+{
+	if (Tiers.IsEmpty())
+	{
+		return Force(INDEX_NONE, Inputs.TimeSeconds);
+	}
+
+	// Leave the budget only once we're clearly back under it
+	if (Inputs.FrameTimeBudgetMs > 0.f)
+	{
+		const float BudgetRatio = Inputs.FrameTimeMs / Inputs.FrameTimeBudgetMs;
+		bOverBudget = bOverBudget ? BudgetRatio > 1.f - Hysteresis : BudgetRatio > 1.f;
+	}
+	else
+	{
+		bOverBudget = false;
+	}
+
+	const int32 LowestTier = Tiers.Num() - 1;
+	int32 DesiredTier = Inputs.bNetRelevant ? SelectByDistance(Tiers, Inputs.NearestPlayerDistance, Hysteresis) : LowestTier;
+	if (bOverBudget)
+	{
+		DesiredTier = FMath::Min(DesiredTier + 1, LowestTier);
+	}
+
+	// The first selection has nothing to blend from
+	if (Tier == INDEX_NONE || Tier > LowestTier)
+	{
+		return Force(DesiredTier, Inputs.TimeSeconds);
+	}
+
+	if (DesiredTier < Tier)
+	{
+		return Force(Tier - 1, Inputs.TimeSeconds);
+	}
+
+	if (DesiredTier > Tier && Inputs.TimeSeconds - TierSinceSeconds >= MinDwellTime)
+	{
+		return Force(Tier + 1, Inputs.TimeSeconds);
+	}
+
+	return false;
+}
+
+bool FBotaniMoverLODSelector::Force(const int32 InTier, const double TimeSeconds)
+{
+	if (Tier == InTier)
+	{
+		return false;
+	}
+
+	Tier = InTier;
+	TierSinceSeconds = TimeSeconds;
+	INC_DWORD_STAT(STAT_BotaniMover_LODTierChanges);
+
+	return true;
+}
+
+void FBotaniMoverLODSelector::Reset()
+{
+	*this = FBotaniMoverLODSelector();
+}
+
+int32 FBotaniMoverLODSelector::SelectByDistance(const TArray<FBotaniMoverLODTier>& Tiers, const float Distance, const float Hysteresis) const
+{
+	for (int32 Idx = 0; Idx < Tiers.Num(); ++Idx)
+	{
+		const float MaxDistance = Tiers[Idx].MaxDistance;
+		if (MaxDistance <= 0.f)
+		{
+			return Idx;
+		}
+
+		// Promoting into a better tier requires getting well inside it, keeping a tier is allowed a bit beyond it
+		const float BandScale = Tier != INDEX_NONE && Idx < Tier ? 1.f - Hysteresis : 1.f + Hysteresis;
+		if (Distance <= MaxDistance * BandScale)
+		{
+			return Idx;
+		}
+	}
+
+	return Tiers.Num() - 1;
+}
@@ -0,0 +1,146 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverLandingPredictor.h"
+
+#include "BotaniMoverSettings.h"
+#include "BotaniMoverStats.h"
+#include "Engine/World.h"
+
+namespace BotaniMover::Landing
+{
+	/** Upper bound for the chords of a single prediction, so a long horizon can't turn into a burst of sweeps. */
+	constexpr int32 MaxChords = 16;
+}
+
+bool FBotaniMoverLandingPredictor::Predict(
+	UWorld* World,
+	const FLaunch& InLaunch,
+	const float InTolerance,
+	const float Horizon,
+	const float MaxSagitta,
+	const double RetryIntervalMs,
+	const ECollisionChannel CollisionChannel,
+	const FCollisionQueryParams& QueryParams,
+	const FCollisionResponseParams& ResponseParams)
+{
+	check(World);
+
+	Invalidate();
+	Launch = InLaunch;
+	Tolerance = InTolerance;
+	NextPredictSimTimeMs = Launch.SimTimeMs + RetryIntervalMs;
+
+	++NumPredictions;
+	INC_DWORD_STAT(STAT_BotaniMover_LandingPredictions);
+
+	// Pick the chord length so the arc never bends further than MaxSagitta away from it
+	const float AccelerationSize = Launch.Acceleration.Size();
+	const float ChordSeconds = AccelerationSize > UE_KINDA_SMALL_NUMBER
+		? FMath::Max(FMath::Sqrt(8.f * MaxSagitta / AccelerationSize), Horizon / BotaniMover::Landing::MaxChords)
+		: Horizon;
+	const float Sagitta = 0.125f * AccelerationSize * FMath::Square(ChordSeconds);
+
+	// Anything within the tolerance of the arc must be free, so cast an inflated capsule
+	const float Inflation = Tolerance + Sagitta;
+	const FCollisionShape CastShape = FCollisionShape::MakeCapsule(
+		Launch.CollisionShape.GetCapsuleRadius() + Inflation,
+		Launch.CollisionShape.GetCapsuleHalfHeight() + Inflation);
+
+	float ImpactTime = Horizon;
+	for (float ChordStart = 0.f; ChordStart < Horizon; ChordStart += ChordSeconds)
+	{
+		const float ChordEnd = FMath::Min(ChordStart + ChordSeconds, Horizon);
+
+		FHitResult Hit;
+		if (World->SweepSingleByChannel(Hit, GetArcLocation(ChordStart), GetArcLocation(ChordEnd), Launch.Rotation, CollisionChannel, CastShape, QueryParams, ResponseParams))
+		{
+			ImpactTime = ChordStart + Hit.Time * (ChordEnd - ChordStart);
+			Impact = Hit;
+			break;
+		}
+	}
+
+	ImpactSimTimeMs = Launch.SimTimeMs + ImpactTime * BotaniMover::Lazy::SToMs;
+
+	// Not even the first step is free, so there is nothing to follow
+	if (ImpactTime < Launch.StepSeconds)
+	{
+		return false;
+	}
+
+	bValid = true;
+	return true;
+}
+
+bool FBotaniMoverLandingPredictor::Matches(const FVector& Gravity, const FVector& MoveInput) const
+{
+	return bValid
+		&& Gravity.Equals(Launch.Gravity)
+		&& MoveInput.Equals(Launch.MoveInput, 0.01f);
+}
+
+FVector FBotaniMoverLandingPredictor::GetPredictedLocation(const double SimTimeMs) const
+{
+	return GetArcLocation((SimTimeMs - Launch.SimTimeMs) * BotaniMover::Lazy::MsToS);
+}
+
+bool FBotaniMoverLandingPredictor::CanFollow(
+	const FVector& Start,
+	const FVector& End,
+	const double StartSimTimeMs,
+	const double EndSimTimeMs) const
+{
+	if (!bValid || StartSimTimeMs < Launch.SimTimeMs || EndSimTimeMs > ImpactSimTimeMs)
+	{
+		return false;
+	}
+
+	// If both ends stay within the tolerance of the arc, so does the whole move
+	const float ToleranceSquared = FMath::Square(Tolerance);
+	return FVector::DistSquared(Start, GetPredictedLocation(StartSimTimeMs)) <= ToleranceSquared
+		&& FVector::DistSquared(End, GetPredictedLocation(EndSimTimeMs)) <= ToleranceSquared;
+}
+
+void FBotaniMoverLandingPredictor::RecordFollowed(const double EndSimTimeMs)
+{
+	LastFollowedSimTimeMs = EndSimTimeMs;
+
+	++NumFollowedMoves;
+	INC_DWORD_STAT(STAT_BotaniMover_LandingFollowedMoves);
+}
+
+void FBotaniMoverLandingPredictor::GetStepBounds(
+	const double SimTimeMs,
+	const float StepSeconds,
+	FVector& OutCenter,
+	float& OutRadius) const
+{
+	const FVector StepStart = GetPredictedLocation(SimTimeMs);
+	const FVector StepEnd = GetPredictedLocation(SimTimeMs + StepSeconds * BotaniMover::Lazy::SToMs);
+
+	OutCenter = (StepStart + StepEnd) * 0.5f;
+	OutRadius = FVector::Dist(StepStart, StepEnd) * 0.5f + Launch.CollisionShape.GetCapsuleHalfHeight() + Tolerance;
+}
+
+void FBotaniMoverLandingPredictor::Invalidate()
+{
+	bValid = false;
+	LastFollowedSimTimeMs = -1.0;
+	Impact = FHitResult();
+}
+
+void FBotaniMoverLandingPredictor::Reset()
+{
+	Invalidate();
+	Launch = FLaunch();
+	NextPredictSimTimeMs = 0.0;
+}
+
+FVector FBotaniMoverLandingPredictor::GetArcLocation(const float Time) const
+{
+	// The velocity is updated before the position each step, so the first step already moves at the launch velocity
+	return Launch.Location
+		+ Launch.Velocity * Time
+		+ 0.5f * Launch.Acceleration * Time * (Time - Launch.StepSeconds);
+}
@@ -0,0 +1,71 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverProbeService.h"
+
+#include "BotaniMoverStats.h"
+#include "Engine/World.h"
+
+void FBotaniMoverProbeService::RequestProbe(
+	UWorld* World,
+	const EBotaniMoverProbe Probe,
+	const int32 ForSimFrame,
+	const FVector& Center,
+	const float Radius,
+	const ECollisionChannel CollisionChannel,
+	const FCollisionQueryParams& QueryParams,
+	const FCollisionResponseParams& ResponseParams)
+{
+	check(World);
+
+	FPendingProbe& PendingProbe = Probes[static_cast<uint8>(Probe)];
+	PendingProbe.Center = Center;
+	PendingProbe.Radius = Radius;
+	PendingProbe.SimFrame = ForSimFrame;
+	PendingProbe.bRetrieved = false;
+
+	// The engine batches all async queries of a frame and runs them off the game thread
+	PendingProbe.Handle = World->AsyncOverlapByChannel(Center, FQuat::Identity, CollisionChannel, FCollisionShape::MakeSphere(Radius), QueryParams, ResponseParams);
+}
+
+bool FBotaniMoverProbeService::TryGetCandidates(
+	UWorld* World,
+	const EBotaniMoverProbe Probe,
+	const int32 SimFrame,
+	const FVector& Center,
+	const float Radius,
+	TConstArrayView<FOverlapResult>& OutCandidates)
+{
+	FPendingProbe& PendingProbe = Probes[static_cast<uint8>(Probe)];
+
+	// The prediction is only usable for the frame it was made for, and only if it still covers the query
+	const bool bPredictionValid = World
+		&& PendingProbe.SimFrame == SimFrame
+		&& (FVector::Dist(PendingProbe.Center, Center) + Radius) <= PendingProbe.Radius;
+
+	if (bPredictionValid && !PendingProbe.bRetrieved && PendingProbe.Handle.IsValid())
+	{
+		PendingProbe.bRetrieved = World->QueryOverlapData(PendingProbe.Handle, PendingProbe.Datum);
+	}
+
+	if (!bPredictionValid || !PendingProbe.bRetrieved)
+	{
+		++NumFallbacks;
+		INC_DWORD_STAT(STAT_BotaniMover_ProbeFallbacks);
+		return false;
+	}
+
+	++NumPrefetchHits;
+	INC_DWORD_STAT(STAT_BotaniMover_ProbePrefetchHits);
+
+	OutCandidates = PendingProbe.Datum.OutOverlaps;
+	return true;
+}
+
+void FBotaniMoverProbeService::Reset()
+{
+	for (FPendingProbe& PendingProbe : Probes)
+	{
+		PendingProbe = FPendingProbe();
+	}
+}
@@ -0,0 +1,95 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverQueryCache.h"
+
+#include "BotaniMoverStats.h"
+#include "MoverComponent.h"
+#include "MoveLibrary/MovementUtils.h"
+
+void FBotaniMoverCollisionParams::Build(const UMoverComponent* MoverComp)
+{
+	AActor* Owner = MoverComp->GetOwner();
+
+	QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(BotaniMoverQuery), false, Owner);
+	ResponseParams = FCollisionResponseParams();
+	CollisionChannel = ECC_Pawn;
+
+	// Child actors move with us, so they are never something we can run on or vault over
+	TArray<AActor*> ChildActors;
+	Owner->GetAllChildActors(ChildActors);
+	QueryParams.AddIgnoredActors(ChildActors);
+
+	// Pick up the updated component's move ignore list and collision responses
+	if (const UPrimitiveComponent* UpdatedPrimitive = Cast<UPrimitiveComponent>(MoverComp->GetUpdatedComponent()))
+	{
+		UMovementUtils::InitCollisionParams(UpdatedPrimitive, QueryParams, ResponseParams);
+		CollisionChannel = UpdatedPrimitive->GetCollisionObjectType();
+	}
+
+	// FWallContact keeps it for the wall friction
+	QueryParams.bReturnPhysicalMaterial = true;
+
+	DynamicResponseParams = ResponseParams;
+	DynamicResponseParams.CollisionResponse.SetResponse(ECC_WorldStatic, ECR_Ignore);
+}
+
+void FBotaniMoverQueryCache::BeginFrame(const int32 InSimFrame)
+{
+	SimFrame = InSimFrame;
+	Invalidate();
+}
+
+void FBotaniMoverQueryCache::Invalidate()
+{
+	Floor.bValid = false;
+	WallProbe.bValid = false;
+	GroundClearance.bValid = false;
+}
+
+template<typename ResultT>
+bool FBotaniMoverQueryCache::TryGet(const TEntry<ResultT>& Entry, const FTransform& Transform, const FVector4f& InParams, ResultT& OutResult)
+{
+	if (Entry.Matches(Transform, InParams))
+	{
+		OutResult = Entry.Result;
+
+		++NumHits;
+		INC_DWORD_STAT(STAT_BotaniMover_QueryCacheHits);
+		return true;
+	}
+
+	++NumMisses;
+	INC_DWORD_STAT(STAT_BotaniMover_QueryCacheMisses);
+	return false;
+}
+
+bool FBotaniMoverQueryCache::TryGetFloor(const FTransform& Transform, const float SweepDistance, const float MaxWalkableSlopeCosine, FFloorCheckResult& OutFloor)
+{
+	return TryGet(Floor, Transform, FVector4f(SweepDistance, MaxWalkableSlopeCosine, 0.f, 0.f), OutFloor);
+}
+
+void FBotaniMoverQueryCache::StoreFloor(const FTransform& Transform, const float SweepDistance, const float MaxWalkableSlopeCosine, const FFloorCheckResult& InFloor)
+{
+	Floor.Store(Transform, FVector4f(SweepDistance, MaxWalkableSlopeCosine, 0.f, 0.f), InFloor);
+}
+
+bool FBotaniMoverQueryCache::TryGetWallProbe(const FTransform& Transform, const float HeadDelta, const float TailDelta, const EBotaniWallRunSide WallSide, FWallProbeResult& OutProbeResult)
+{
+	return TryGet(WallProbe, Transform, FVector4f(HeadDelta, TailDelta, static_cast<float>(WallSide), 0.f), OutProbeResult);
+}
+
+void FBotaniMoverQueryCache::StoreWallProbe(const FTransform& Transform, const float HeadDelta, const float TailDelta, const EBotaniWallRunSide WallSide, const FWallProbeResult& ProbeResult)
+{
+	WallProbe.Store(Transform, FVector4f(HeadDelta, TailDelta, static_cast<float>(WallSide), 0.f), ProbeResult);
+}
+
+bool FBotaniMoverQueryCache::TryGetGroundClearance(const FTransform& Transform, const float MinHeight, const FVector& UpDirection, bool& bOutHighEnough)
+{
+	return TryGet(GroundClearance, Transform, FVector4f(MinHeight, UpDirection.X, UpDirection.Y, UpDirection.Z), bOutHighEnough);
+}
+
+void FBotaniMoverQueryCache::StoreGroundClearance(const FTransform& Transform, const float MinHeight, const FVector& UpDirection, const bool bHighEnough)
+{
+	GroundClearance.Store(Transform, FVector4f(MinHeight, UpDirection.X, UpDirection.Y, UpDirection.Z), bHighEnough);
+}
@@ -0,0 +1,76 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverRestingState.h"
+
+#include "BotaniMoverStats.h"
+#include "Components/PrimitiveComponent.h"
+
+namespace BotaniMover::Resting
+{
+	/** Tolerance for the transform to still count as the one we rest at, anything larger moved us. */
+	constexpr float TransformTolerance = UE_KINDA_SMALL_NUMBER;
+}
+
+bool FBotaniMoverRestingState::AccumulateQuietTick(
+	const FTransform& InTransform,
+	const FFloorCheckResult& InFloor,
+	const ECollisionChannel InCollisionChannel,
+	const int32 EntryTicks)
+{
+	CollisionChannel = InCollisionChannel;
+	if (!IsStaticFloor(InFloor, CollisionChannel))
+	{
+		Wake();
+		return false;
+	}
+
+	// Moving, even slightly, restarts the count
+	if (NumQuietTicks == 0 || !Transform.Equals(InTransform, BotaniMover::Resting::TransformTolerance))
+	{
+		Wake();
+		Transform = InTransform;
+	}
+
+	Floor = InFloor;
+	NumQuietTicks = FMath::Min(NumQuietTicks + 1, EntryTicks);
+	bResting = NumQuietTicks >= EntryTicks;
+
+	return bResting;
+}
+
+bool FBotaniMoverRestingState::IsRestingAt(const FTransform& InTransform) const
+{
+	return bResting
+		&& IsStaticFloor(Floor, CollisionChannel)
+		&& Transform.Equals(InTransform, BotaniMover::Resting::TransformTolerance);
+}
+
+void FBotaniMoverRestingState::Wake()
+{
+	bResting = false;
+	NumQuietTicks = 0;
+}
+
+void FBotaniMoverRestingState::Reset()
+{
+	*this = FBotaniMoverRestingState();
+}
+
+void FBotaniMoverRestingState::RecordRestingTick()
+{
+	++NumRestingTicks;
+	INC_DWORD_STAT(STAT_BotaniMover_RestingTicks);
+}
+
+bool FBotaniMoverRestingState::IsStaticFloor(const FFloorCheckResult& InFloor, const ECollisionChannel InCollisionChannel)
+{
+	// The hit holds a weak pointer, so a destroyed floor shows up as a missing component
+	const UPrimitiveComponent* FloorComponent = InFloor.HitResult.GetComponent();
+	return InFloor.IsWalkableFloor()
+		&& FloorComponent
+		&& FloorComponent->Mobility != EComponentMobility::Movable
+		&& !FloorComponent->IsAnySimulatingPhysics()
+		&& FloorComponent->IsQueryCollisionEnabled()
+		&& FloorComponent->GetCollisionResponseToChannel(InCollisionChannel) == ECR_Block;
+}
@@ -0,0 +1,48 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "BotaniMoverLogChannels.h"
+#include "ScalableFloat.h"
+#include "Engine/CurveTable.h"
+#include "Subsystems/BotaniMoverArchetypeSubsystem.h"
+#include "UObject/UnrealType.h"
+
+namespace BotaniMover::Settings
+{
+	/** Calls the given function for every curve table referenced by a scalable float property of the given object. */
+	inline void ForEachReferencedCurveTable(const UObject* Object, TFunctionRef<void(UCurveTable*)> Func)
+	{
+		if (!IsValid(Object))
+		{
+			return;
+		}
+
+		for (TFieldIterator<FStructProperty> It(Object->GetClass()); It; ++It)
+		{
+			if (It->Struct != FScalableFloat::StaticStruct())
+			{
+				continue;
+			}
+
+			const FScalableFloat* ScalableFloat = It->ContainerPtrToValuePtr<FScalableFloat>(Object);
+			if (UCurveTable* CurveTable = ScalableFloat->Curve.CurveTable)
+			{
+				Func(CurveTable);
+			}
+		}
+	}
+
+	/** Returns true if the given settings may be changed at runtime. Instances shared by an archetype are used by every pawn of it. */
+	inline bool CanModifySettings(const UObject* Settings)
+	{
+		if (UBotaniMoverArchetypeSubsystem::IsSharedInstance(Settings))
+		{
+			BOTANIMOVER_ERROR("Can't change '%s', it is shared by all pawns of its archetype. Push a movement settings modifier on the mover component instead.",
+				*GetPathNameSafe(Settings));
+			return false;
+		}
+
+		return true;
+	}
+}
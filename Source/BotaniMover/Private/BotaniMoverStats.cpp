@@ -0,0 +1,25 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverStats.h"
+
+DEFINE_STAT(STAT_BotaniMover_SharedSettingsSavedMemory);
+DEFINE_STAT(STAT_BotaniMover_SharedSettingsInstances);
+DEFINE_STAT(STAT_BotaniMover_QueryCacheHits);
+DEFINE_STAT(STAT_BotaniMover_QueryCacheMisses);
+DEFINE_STAT(STAT_BotaniMover_ProbePrefetchHits);
+DEFINE_STAT(STAT_BotaniMover_ProbeFallbacks);
+DEFINE_STAT(STAT_BotaniMover_WallProbesSkipped);
+DEFINE_STAT(STAT_BotaniMover_FilteredCandidates);
+DEFINE_STAT(STAT_BotaniMover_WallPlaneReuses);
+DEFINE_STAT(STAT_BotaniMover_GroundMoveSolves);
+DEFINE_STAT(STAT_BotaniMover_GroundMoveSweeps);
+DEFINE_STAT(STAT_BotaniMover_FreeSpaceHits);
+DEFINE_STAT(STAT_BotaniMover_FreeSpaceMisses);
+DEFINE_STAT(STAT_BotaniMover_LandingPredictions);
+DEFINE_STAT(STAT_BotaniMover_LandingFollowedMoves);
+DEFINE_STAT(STAT_BotaniMover_Substeps);
+DEFINE_STAT(STAT_BotaniMover_RestingTicks);
+DEFINE_STAT(STAT_BotaniMover_LODTierChanges);
+DEFINE_STAT(STAT_BotaniMover_BudgetedQueries);
+DEFINE_STAT(STAT_BotaniMover_DeferredQueries);
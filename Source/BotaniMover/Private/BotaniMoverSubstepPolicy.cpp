@@ -0,0 +1,60 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverSubstepPolicy.h"
+
+#include "BotaniMoverSettings.h"
+#include "Components/BotaniMoverComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "MoverComponent.h"
+#include "MoverDataModelTypes.h"
+#include "MoverSimulationTypes.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMoverSubstepPolicy)
+
+float FBotaniMoverSubstepPolicy::ComputeSubstepMs(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, const UMoverComponent* MoverComp) const
+{
+	const float StepMs = TimeStep.StepMs;
+	if (MaxSubsteps <= 1 || !MoverComp || StepMs <= 0.f)
+	{
+		return StepMs;
+	}
+
+	// Lower movement LOD tiers pay a single sweep per move
+	const FBotaniMoverLODTier* LODTier = UBotaniMoverComponent::FindSimulationLODTier(MoverComp);
+	if (LODTier && !LODTier->bAllowSubstepping)
+	{
+		return StepMs;
+	}
+
+	// Layered moves apply their whole effect to each tick they are part of, splitting would apply it again
+	if (StartState.SyncState.LayeredMoves.HasAnyMoves())
+	{
+		return StepMs;
+	}
+
+	// A followed arc doesn't sweep, so there is nothing to gain from splitting it
+	if (UBotaniMoverComponent::IsFollowingLandingPrediction(MoverComp, TimeStep.BaseSimTimeMs))
+	{
+		return StepMs;
+	}
+
+	const FMoverDefaultSyncState* SyncState = StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+	const UPrimitiveComponent* UpdatedPrimitive = Cast<UPrimitiveComponent>(MoverComp->GetUpdatedComponent());
+	if (!SyncState || !UpdatedPrimitive)
+	{
+		return StepMs;
+	}
+
+	const float ShapeRadius = UpdatedPrimitive->GetCollisionShape().GetExtent().X;
+	const float StepDistance = SyncState->GetVelocity_WorldSpace().Size() * StepMs * BotaniMover::Lazy::MsToS;
+
+	return StepMs / ComputeNumSubsteps(StepDistance, ShapeRadius);
+}
+
+int32 FBotaniMoverSubstepPolicy::ComputeNumSubsteps(const float StepDistance, const float ShapeRadius) const
+{
+	const float MaxSubstepDistance = FMath::Max(ShapeRadius * MaxSubstepDistanceFactor, UE_KINDA_SMALL_NUMBER);
+	return FMath::Clamp(FMath::CeilToInt32(StepDistance / MaxSubstepDistance), 1, FMath::Max(MaxSubsteps, 1));
+}
@@ -0,0 +1,56 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverSurfaceFilter.h"
+
+#include "BotaniMoverStats.h"
+#include "CollisionQueryParams.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "GameFramework/Actor.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMoverSurfaceFilter)
+
+bool FBotaniMoverSurfaceFilter::PassesFilter(const UPrimitiveComponent* Component) const
+{
+	if (IsEmpty() || !Component)
+	{
+		return true;
+	}
+
+	auto HasTag = [Component](const FName Tag)
+	{
+		const AActor* Owner = Component->GetOwner();
+		return Component->ComponentHasTag(Tag) || (Owner && Owner->ActorHasTag(Tag));
+	};
+
+	const bool bPasses = (RequiredTag.IsNone() || HasTag(RequiredTag))
+		&& (ExcludedTag.IsNone() || !HasTag(ExcludedTag));
+
+	if (!bPasses)
+	{
+		INC_DWORD_STAT(STAT_BotaniMover_FilteredCandidates);
+	}
+
+	return bPasses;
+}
+
+void FBotaniMoverSurfaceFilter::AddIgnoredComponents(
+	TConstArrayView<FOverlapResult> Candidates,
+	FCollisionQueryParams& InOutQueryParams) const
+{
+	if (IsEmpty())
+	{
+		return;
+	}
+
+	for (const FOverlapResult& Candidate : Candidates)
+	{
+		const UPrimitiveComponent* CandidateComponent = Candidate.GetComponent();
+		if (Candidate.bBlockingHit && CandidateComponent && !PassesFilter(CandidateComponent))
+		{
+			InOutQueryParams.AddIgnoredComponent(CandidateComponent);
+		}
+	}
+}
@@ -0,0 +1,148 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverTagsSyncState.h"
+
+#include "BotaniMoverTags.h"
+#include "GameplayTagSyncState.h"
+#include "MoverSimulationTypes.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMoverTagsSyncState)
+
+namespace BotaniMover::TagBits
+{
+	/** Native tags in bit order. */
+	static const FNativeGameplayTag* const BitTags[NumBits] =
+	{
+		&BotaniGameplayTags::Mover::Modes::TAG_MM_Walking,
+		&BotaniGameplayTags::Mover::Modes::TAG_MM_Sprinting,
+		&BotaniGameplayTags::Mover::Modes::TAG_MM_Crouching,
+		&BotaniGameplayTags::Mover::Modes::TAG_MM_Falling,
+		&BotaniGameplayTags::Mover::Modes::TAG_MM_Sliding,
+		&BotaniGameplayTags::Mover::Modes::TAG_MM_PowerSliding,
+		&BotaniGameplayTags::Mover::Modes::TAG_MM_WallRunning,
+		&BotaniGameplayTags::Mover::Modes::TAG_MM_Grappling,
+		&BotaniGameplayTags::Mover::Restrictions::TAG_Restriction_CannotMove,
+	};
+
+	FGameplayTag GetBitTag(const int32 BitIndex)
+	{
+		return BitTags[BitIndex]->GetTag();
+	}
+
+	uint16 GetTagBit(const FGameplayTag& Tag)
+	{
+		for (int32 Idx = 0; Idx < NumBits; ++Idx)
+		{
+			if (Tag == BitTags[Idx]->GetTag())
+			{
+				return static_cast<uint16>(1 << Idx);
+			}
+		}
+
+		return None;
+	}
+
+	uint16 GetTagBits(const FGameplayTagContainer& Tags)
+	{
+		uint16 Bits = None;
+		for (const FGameplayTag& Tag : Tags)
+		{
+			Bits |= GetTagBit(Tag);
+		}
+
+		return Bits;
+	}
+}
+
+void FBotaniCompiledTagMask::Compile(const FGameplayTagContainer& Tags)
+{
+	Mask = BotaniMover::TagBits::None;
+	bMaskOnly = true;
+	bEmpty = Tags.IsEmpty();
+
+	for (const FGameplayTag& Tag : Tags)
+	{
+		const uint16 Bit = BotaniMover::TagBits::GetTagBit(Tag);
+		Mask |= Bit;
+		bMaskOnly &= (Bit != BotaniMover::TagBits::None);
+	}
+}
+
+bool FBotaniMoverTagsSyncState::HasAllMovementTags(
+	const FMoverSyncState& SyncState,
+	const FBotaniCompiledTagMask& Compiled,
+	const FGameplayTagContainer& Tags)
+{
+	if (Compiled.IsMaskOnly())
+	{
+		if (const FBotaniMoverTagsSyncState* TagBitsState = SyncState.SyncStateCollection.FindDataByType<FBotaniMoverTagsSyncState>())
+		{
+			return (TagBitsState->MovementTagBits & Compiled.GetMask()) == Compiled.GetMask();
+		}
+	}
+
+	const FGameplayTagsSyncState* TagsState = SyncState.SyncStateCollection.FindDataByType<FGameplayTagsSyncState>();
+	return TagsState ? TagsState->GetMovementTags().HasAllExact(Tags) : Tags.IsEmpty();
+}
+
+bool FBotaniMoverTagsSyncState::HasAnyMovementTags(
+	const FMoverSyncState& SyncState,
+	const FBotaniCompiledTagMask& Compiled,
+	const FGameplayTagContainer& Tags)
+{
+	if (Compiled.IsMaskOnly())
+	{
+		if (const FBotaniMoverTagsSyncState* TagBitsState = SyncState.SyncStateCollection.FindDataByType<FBotaniMoverTagsSyncState>())
+		{
+			return (TagBitsState->MovementTagBits & Compiled.GetMask()) != 0;
+		}
+	}
+
+	const FGameplayTagsSyncState* TagsState = SyncState.SyncStateCollection.FindDataByType<FGameplayTagsSyncState>();
+	return TagsState && TagsState->GetMovementTags().HasAnyExact(Tags);
+}
+
+FMoverDataStructBase* FBotaniMoverTagsSyncState::Clone() const
+{
+	FBotaniMoverTagsSyncState* CopyPtr = new FBotaniMoverTagsSyncState(*this);
+	return CopyPtr;
+}
+
+bool FBotaniMoverTagsSyncState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Super::NetSerialize(Ar, Map, bOutSuccess);
+
+	// Only the bits that are actually in use
+	Ar.SerializeBits(&MovementTagBits, BotaniMover::TagBits::NumBits);
+	Ar.SerializeBits(&ModeTagBits, BotaniMover::TagBits::NumBits);
+
+	bOutSuccess = true;
+	return true;
+}
+
+UScriptStruct* FBotaniMoverTagsSyncState::GetScriptStruct() const
+{
+	return StaticStruct();
+}
+
+void FBotaniMoverTagsSyncState::ToString(FAnsiStringBuilderBase& Out) const
+{
+	Super::ToString(Out);
+
+	Out.Appendf("MovementTagBits: 0x%04x\n", MovementTagBits);
+	Out.Appendf("ModeTagBits: 0x%04x\n", ModeTagBits);
+}
+
+bool FBotaniMoverTagsSyncState::ShouldReconcile(const FMoverDataStructBase& AuthorityState) const
+{
+	const FBotaniMoverTagsSyncState& AuthorityTags = static_cast<const FBotaniMoverTagsSyncState&>(AuthorityState);
+	return MovementTagBits != AuthorityTags.MovementTagBits || ModeTagBits != AuthorityTags.ModeTagBits;
+}
+
+void FBotaniMoverTagsSyncState::Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float Pct)
+{
+	// Tags can't be blended, snap to whichever state is closer
+	*this = static_cast<const FBotaniMoverTagsSyncState&>(Pct < 0.5f ? From : To);
+}
@@ -0,0 +1,70 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniTimerSyncState.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniTimerSyncState)
+
+FMoverDataStructBase* FBotaniTimerSyncState::Clone() const
+{
+	FBotaniTimerSyncState* CopyPtr = new FBotaniTimerSyncState(*this);
+	return CopyPtr;
+}
+
+bool FBotaniTimerSyncState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Super::NetSerialize(Ar, Map, bOutSuccess);
+
+	// Only the recorded timers are sent
+	Ar << SetTimersMask;
+
+	for (int32 Idx = 0; Idx < NumTimers; ++Idx)
+	{
+		if (SetTimersMask & (1 << Idx))
+		{
+			uint64 PackedTime = static_cast<uint64>(TimesMs[Idx]);
+			Ar.SerializeIntPacked64(PackedTime);
+			TimesMs[Idx] = static_cast<int64>(PackedTime);
+		}
+		else if (Ar.IsLoading())
+		{
+			TimesMs[Idx] = 0;
+		}
+	}
+
+	bOutSuccess = true;
+	return true;
+}
+
+UScriptStruct* FBotaniTimerSyncState::GetScriptStruct() const
+{
+	return StaticStruct();
+}
+
+void FBotaniTimerSyncState::ToString(FAnsiStringBuilderBase& Out) const
+{
+	Super::ToString(Out);
+
+	const UEnum* TimerEnum = StaticEnum<EBotaniMoverTimer>();
+	for (int32 Idx = 0; Idx < NumTimers; ++Idx)
+	{
+		if (SetTimersMask & (1 << Idx))
+		{
+			Out.Appendf("%s: %lld ms\n", TCHAR_TO_ANSI(*TimerEnum->GetNameStringByValue(Idx)), TimesMs[Idx]);
+		}
+	}
+}
+
+bool FBotaniTimerSyncState::ShouldReconcile(const FMoverDataStructBase& AuthorityState) const
+{
+	const FBotaniTimerSyncState& AuthorityTimers = static_cast<const FBotaniTimerSyncState&>(AuthorityState);
+	return SetTimersMask != AuthorityTimers.SetTimersMask ||
+		FMemory::Memcmp(TimesMs, AuthorityTimers.TimesMs, sizeof(TimesMs)) != 0;
+}
+
+void FBotaniTimerSyncState::Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float Pct)
+{
+	// Timers are discrete edges, snap to whichever state is closer
+	*this = static_cast<const FBotaniTimerSyncState&>(Pct < 0.5f ? From : To);
+}
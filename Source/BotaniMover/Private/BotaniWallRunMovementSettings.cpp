@@ -3,6 +3,9 @@
 
 #include "BotaniWallRunMovementSettings.h"
 
+#include "BotaniMoverSettings.h"
+#include "BotaniMoverSettingsHelpers.h"
+
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniWallRunMovementSettings)
 
@@ -18,7 +21,11 @@ UBotaniWallRunMovementSettings::UBotaniWallRunMovementSettings()
 	, WallRun_GravityScale(1.f)
 	, WallRun_UpwardsGravityScale(4.f)
 	, bResetTimerOnlyOnLand(true)
-	, WallRunSide(Wall_Error)
+	, WallRunSide_DEPRECATED(Wall_Error)
+	, WallTraceChannel(ECC_Camera)
+	, FloorTraceChannel(ECC_Visibility)
+	, WallSurfaceFilter(NAME_None, TEXT("NoWallRun"))
+	, bUseWallPlane(false)
 	, bAlwaysStayOnWall(true)
 	, WallRun_MinRequiredSpeed(500.f)
 	, WallRun_MinRequiredStaticHeight(5.f)
@@ -32,6 +39,124 @@ UBotaniWallRunMovementSettings::UBotaniWallRunMovementSettings()
 	, bWallJumpKeepsPreviousVelocity(true)
 	, bWallJumpKeepsPreviousVerticalVelocity(false)
 	, bDrawWallRunDebug(false)
-	, WallRunTime(0.f)
+	, WallRunTime_DEPRECATED(0.f)
+{
+}
+
+void UBotaniWallRunMovementSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	UpdateResolvedSettings();
+}
+
+void UBotaniWallRunMovementSettings::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	UpdateResolvedSettings();
+}
+
+void UBotaniWallRunMovementSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	UpdateResolvedSettings();
+
+#if WITH_EDITOR
+	BindCurveTableDelegates();
+#endif
+}
+
+void UBotaniWallRunMovementSettings::RebuildResolvedSettings()
+{
+	if (BotaniMover::Settings::CanModifySettings(this))
+	{
+		UpdateResolvedSettings();
+	}
+}
+
+void UBotaniWallRunMovementSettings::UpdateResolvedSettings()
 {
+	const float Level = SettingsLevel;
+	FBotaniResolvedWallRunSettings& Resolved = ResolvedSettings;
+
+	Resolved.WallRun_MaxSpeed = WallRun_MaxSpeed.GetValueAtLevel(Level);
+	Resolved.WallRun_Acceleration = WallRun_Acceleration.GetValueAtLevel(Level);
+	Resolved.WallRun_Deceleration = WallRun_Deceleration.GetValueAtLevel(Level);
+	Resolved.WallRun_PullAwayAngle = WallRun_PullAwayAngle.GetValueAtLevel(Level);
+	Resolved.WallRun_AttractionForceMagnitude = WallRun_AttractionForceMagnitude.GetValueAtLevel(Level);
+	Resolved.WallRun_BrakingDeceleration = WallRun_BrakingDeceleration.GetValueAtLevel(Level);
+	Resolved.WallRun_SurfaceFrictionFactor = WallRun_SurfaceFrictionFactor.GetValueAtLevel(Level);
+	Resolved.WallRun_MinTimeBetweenRuns = WallRun_MinTimeBetweenRuns.GetValueAtLevel(Level);
+	Resolved.WallRun_GravityScale = WallRun_GravityScale.GetValueAtLevel(Level);
+	Resolved.WallRun_UpwardsGravityScale = WallRun_UpwardsGravityScale.GetValueAtLevel(Level);
+	Resolved.WallRun_MinRequiredSpeed = WallRun_MinRequiredSpeed.GetValueAtLevel(Level);
+	Resolved.WallRun_MinRequiredStaticHeight = WallRun_MinRequiredStaticHeight.GetValueAtLevel(Level);
+	Resolved.WallRun_MinRequiredDynamicHeight = WallRun_MinRequiredDynamicHeight.GetValueAtLevel(Level);
+	Resolved.WallRun_MinRequiredAngle = WallRun_MinRequiredAngle.GetValueAtLevel(Level);
+	Resolved.WallRun_MaxVerticalSpeed = WallRun_MaxVerticalSpeed.GetValueAtLevel(Level);
+	Resolved.WallJump_ForceMagnitude = WallJump_ForceMagnitude.GetValueAtLevel(Level);
+
+	// Derived values, so nobody has to do trigonometry per tick
+	Resolved.WallRun_PullAwayAngleSine = FMath::Sin(FMath::DegreesToRadians(Resolved.WallRun_PullAwayAngle));
+	Resolved.WallRun_MinRequiredAngleCosine = FMath::Cos(FMath::DegreesToRadians(Resolved.WallRun_MinRequiredAngle));
+	Resolved.WallRun_MinRequiredSpeedSquared = FMath::Square(Resolved.WallRun_MinRequiredSpeed);
+	Resolved.WallRun_MaxVerticalSpeedSquared = FMath::Square(Resolved.WallRun_MaxVerticalSpeed);
+	Resolved.WallRun_MinTimeBetweenRunsMs = static_cast<float>(Resolved.WallRun_MinTimeBetweenRuns * BotaniMover::Lazy::SToMs);
+	Resolved.WallRun_MaxTimeMs = WallRun_MaxTime.IsSet()
+		? static_cast<float>(WallRun_MaxTime.GetValue().GetValueAtLevel(Level) * BotaniMover::Lazy::SToMs)
+		: -1.f;
+
+	// Bake the gravity curves, so wall running doesn't evaluate rich curves per tick
+	Resolved.WallRun_GravityVelScaleTable.Bake(WallRun_GravityVelScaleCurve.GetRichCurveConst(), 0.f);
+	Resolved.WallRun_GravityTimeScaleTable.Bake(WallRun_GravityTimeScaleCurve.GetRichCurveConst(), 1.f);
+
+	// Compile the tag containers, so the transitions can test them against the tag bits
+	Resolved.WallRunningRequiredTagsMask.Compile(WallRunningRequiredTags);
+	Resolved.WallRunningBlockedTagsMask.Compile(WallRunningBlockedTags);
+}
+
+void UBotaniWallRunMovementSettings::SetSettingsLevel(float InLevel)
+{
+	if (SettingsLevel == InLevel || !BotaniMover::Settings::CanModifySettings(this))
+	{
+		return;
+	}
+
+	SettingsLevel = InLevel;
+	UpdateResolvedSettings();
+}
+
+#if WITH_EDITOR
+void UBotaniWallRunMovementSettings::BindCurveTableDelegates()
+{
+	// Keep the snapshot in sync with curve table edits
+	auto BindCurveTable = [this](UCurveTable* CurveTable)
+	{
+		CurveTable->OnCurveTableChanged().RemoveAll(this);
+		CurveTable->OnCurveTableChanged().AddUObject(this, &ThisClass::HandleCurveTableChanged);
+	};
+
+	BotaniMover::Settings::ForEachReferencedCurveTable(this, BindCurveTable);
+
+	// Optionals aren't picked up by the struct property iteration
+	if (WallRun_MaxTime.IsSet() && WallRun_MaxTime.GetValue().Curve.CurveTable)
+	{
+		BindCurveTable(WallRun_MaxTime.GetValue().Curve.CurveTable);
+	}
+}
+
+void UBotaniWallRunMovementSettings::HandleCurveTableChanged()
+{
+	UpdateResolvedSettings();
+}
+
+void UBotaniWallRunMovementSettings::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	UpdateResolvedSettings();
+	BindCurveTableDelegates();
 }
+#endif
@@ -0,0 +1,198 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "Components/BotaniMoverAbilityMirrorComponent.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "BotaniMoverSettings.h"
+#include "MoverComponent.h"
+#include "Components/BotaniMoverComponent.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMoverAbilityMirrorComponent)
+
+UBotaniMoverAbilityMirrorComponent::UBotaniMoverAbilityMirrorComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void UBotaniMoverAbilityMirrorComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Bind to the owner's ability system, if it already has one
+	if (UAbilitySystemComponent* AbilitySystem = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetOwner()))
+	{
+		BindToAbilitySystem(AbilitySystem);
+	}
+}
+
+void UBotaniMoverAbilityMirrorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindFromAbilitySystem();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UBotaniMoverAbilityMirrorComponent::ProduceInput_Implementation(int32 SimTimeMs, FMoverInputCmdContext& InputCmdResult)
+{
+	WriteAbilityStateInputs(InputCmdResult);
+}
+
+void UBotaniMoverAbilityMirrorComponent::BindToAbilitySystem(UAbilitySystemComponent* InAbilitySystem)
+{
+	if (WeakAbilitySystem.Get() == InAbilitySystem)
+	{
+		return;
+	}
+
+	UnbindFromAbilitySystem();
+
+	if (!IsValid(InAbilitySystem))
+	{
+		return;
+	}
+
+	WeakAbilitySystem = InAbilitySystem;
+
+	// Resolve the stop movement tag, falling back to the one in the mover settings
+	BoundStopMovementTag = StopMovementTag;
+	if (!BoundStopMovementTag.IsValid())
+	{
+		const UMoverComponent* MoverComp = GetOwner()->FindComponentByClass<UMoverComponent>();
+		if (const UBotaniMoverSettings* BotaniMoverSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniMoverSettings>(MoverComp))
+		{
+			BoundStopMovementTag = BotaniMoverSettings->StopMovementTag;
+		}
+	}
+
+	// Listen to the restriction tags
+	if (BoundStopMovementTag.IsValid())
+	{
+		StopMovementTagHandle = InAbilitySystem->RegisterGameplayTagEvent(BoundStopMovementTag, EGameplayTagEventType::NewOrRemoved)
+			.AddUObject(this, &ThisClass::OnStopMovementTagChanged);
+
+		MirroredState.bCannotMove = InAbilitySystem->HasMatchingGameplayTag(BoundStopMovementTag);
+	}
+
+	// Listen to the multiplier attributes
+	if (MaxSpeedMultiplierAttribute.IsValid() && InAbilitySystem->HasAttributeSetForAttribute(MaxSpeedMultiplierAttribute))
+	{
+		MaxSpeedMultiplierHandle = InAbilitySystem->GetGameplayAttributeValueChangeDelegate(MaxSpeedMultiplierAttribute)
+			.AddUObject(this, &ThisClass::OnMaxSpeedMultiplierChanged);
+
+		MirroredState.MaxSpeedMultiplier = InAbilitySystem->GetNumericAttribute(MaxSpeedMultiplierAttribute);
+	}
+
+	if (AccelerationMultiplierAttribute.IsValid() && InAbilitySystem->HasAttributeSetForAttribute(AccelerationMultiplierAttribute))
+	{
+		AccelerationMultiplierHandle = InAbilitySystem->GetGameplayAttributeValueChangeDelegate(AccelerationMultiplierAttribute)
+			.AddUObject(this, &ThisClass::OnAccelerationMultiplierChanged);
+
+		MirroredState.AccelerationMultiplier = InAbilitySystem->GetNumericAttribute(AccelerationMultiplierAttribute);
+	}
+}
+
+void UBotaniMoverAbilityMirrorComponent::UnbindFromAbilitySystem()
+{
+	if (UAbilitySystemComponent* AbilitySystem = WeakAbilitySystem.Get())
+	{
+		if (StopMovementTagHandle.IsValid())
+		{
+			AbilitySystem->UnregisterGameplayTagEvent(StopMovementTagHandle, BoundStopMovementTag, EGameplayTagEventType::NewOrRemoved);
+		}
+
+		if (MaxSpeedMultiplierHandle.IsValid())
+		{
+			AbilitySystem->GetGameplayAttributeValueChangeDelegate(MaxSpeedMultiplierAttribute).Remove(MaxSpeedMultiplierHandle);
+		}
+
+		if (AccelerationMultiplierHandle.IsValid())
+		{
+			AbilitySystem->GetGameplayAttributeValueChangeDelegate(AccelerationMultiplierAttribute).Remove(AccelerationMultiplierHandle);
+		}
+	}
+
+	StopMovementTagHandle.Reset();
+	MaxSpeedMultiplierHandle.Reset();
+	AccelerationMultiplierHandle.Reset();
+
+	WeakAbilitySystem.Reset();
+	BoundStopMovementTag = FGameplayTag::EmptyTag;
+	MirroredState = FBotaniMoverAbilityStateInputs();
+}
+
+void UBotaniMoverAbilityMirrorComponent::WriteAbilityStateInputs(FMoverInputCmdContext& InputCmd) const
+{
+	FBotaniMoverAbilityStateInputs& AbilityStateInputs = InputCmd.InputCollection.FindOrAddMutableDataByType<FBotaniMoverAbilityStateInputs>();
+	AbilityStateInputs.bCannotMove = MirroredState.bCannotMove;
+	AbilityStateInputs.MaxSpeedMultiplier = MirroredState.MaxSpeedMultiplier;
+	AbilityStateInputs.AccelerationMultiplier = MirroredState.AccelerationMultiplier;
+}
+
+void UBotaniMoverAbilityMirrorComponent::ClampToMirroredState(FBotaniMoverAbilityStateInputs& InOutState) const
+{
+	// A client may restrict itself further, but never lift a restriction or speed itself up
+	InOutState.bCannotMove = InOutState.bCannotMove || MirroredState.bCannotMove;
+	InOutState.MaxSpeedMultiplier = FMath::Clamp(InOutState.MaxSpeedMultiplier, 0.f, FMath::Max(MirroredState.MaxSpeedMultiplier, 0.f));
+	InOutState.AccelerationMultiplier = FMath::Clamp(InOutState.AccelerationMultiplier, 0.f, FMath::Max(MirroredState.AccelerationMultiplier, 0.f));
+}
+
+FBotaniMoverAbilityStateInputs FBotaniMoverAbilityStateSource::Resolve(
+	const UMoverComponent* MoverComp,
+	const FMoverInputCmdContext& InputCmd,
+	const FGameplayTag& StopMovementTag)
+{
+	const AActor* Owner = MoverComp ? MoverComp->GetOwner() : nullptr;
+	if (!bLookedUp && Owner)
+	{
+		AbilityMirror = Owner->FindComponentByClass<UBotaniMoverAbilityMirrorComponent>();
+		if (!AbilityMirror.IsValid())
+		{
+			AbilitySystem = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Owner);
+		}
+
+		bLookedUp = true;
+	}
+
+	// The ability state is mirrored into the input command, so we never have to query the ability system here
+	const UBotaniMoverAbilityMirrorComponent* Mirror = AbilityMirror.Get();
+	const FBotaniMoverAbilityStateInputs* AbilityStateInputs = InputCmd.InputCollection.FindDataByType<FBotaniMoverAbilityStateInputs>();
+	if (AbilityStateInputs && Mirror)
+	{
+		FBotaniMoverAbilityStateInputs AbilityState = *AbilityStateInputs;
+
+		// The input command may come from a remote client, so the authority checks it against its own ability system
+		if (MoverComp->GetOwnerRole() == ROLE_Authority)
+		{
+			Mirror->ClampToMirroredState(AbilityState);
+		}
+
+		return AbilityState;
+	}
+
+	// Without a mirror component nothing is mirrored, so query the stop movement tag directly
+	FBotaniMoverAbilityStateInputs AbilityState;
+	if (const UAbilitySystemComponent* AbilitySystemComponent = AbilitySystem.Get())
+	{
+		AbilityState.bCannotMove = StopMovementTag.IsValid() && AbilitySystemComponent->HasMatchingGameplayTag(StopMovementTag);
+	}
+
+	return AbilityState;
+}
+
+void UBotaniMoverAbilityMirrorComponent::OnStopMovementTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	MirroredState.bCannotMove = NewCount > 0;
+}
+
+void UBotaniMoverAbilityMirrorComponent::OnMaxSpeedMultiplierChanged(const FOnAttributeChangeData& ChangeData)
+{
+	MirroredState.MaxSpeedMultiplier = ChangeData.NewValue;
+}
+
+void UBotaniMoverAbilityMirrorComponent::OnAccelerationMultiplierChanged(const FOnAttributeChangeData& ChangeData)
+{
+	MirroredState.AccelerationMultiplier = ChangeData.NewValue;
+}
@@ -3,11 +3,25 @@
 
 #include "Components/BotaniMoverComponent.h"
 
+#include "BotaniCommonMovementSettings.h"
+#include "BotaniMoverLogChannels.h"
 #include "BotaniMoverSettings.h"
+#include "BotaniMoverTags.h"
+#include "BotaniStanceSettings.h"
+#include "BotaniWallRunMovementSettings.h"
+#include "Components/ChildActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameplayTagSyncState.h"
+#include "MoverDataModelTypes.h"
 #include "Modes/BotaniMM_Falling.h"
 #include "Modes/BotaniMM_Walking.h"
 #include "Modes/BotaniMM_WallRunning.h"
 #include "Modifiers/BotaniStanceModifier.h"
+#include "Subsystems/BotaniMoverArchetypeSubsystem.h"
+#include "Subsystems/BotaniWallRunIndexSubsystem.h"
+#include "TimerManager.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMoverComponent)
@@ -31,8 +45,49 @@ UBotaniMoverComponent::UBotaniMoverComponent(const FObjectInitializer& ObjectIni
 		ObjectInitializer.CreateDefaultSubobject<UBotaniMM_WallRunning>(this, "ModeWallRunning"));
 
 	PersistentSyncStateDataTypes.Add(FMoverDataPersistence(FGameplayTagsSyncState::StaticStruct(), false));
+	PersistentSyncStateDataTypes.Add(FMoverDataPersistence(FBotaniTimerSyncState::StaticStruct(), true));
+	PersistentSyncStateDataTypes.Add(FMoverDataPersistence(FBotaniMoverTagsSyncState::StaticStruct(), false));
 
 	StartingMovementMode = DefaultModeNames::Falling;
+
+	// Default movement LOD tiers, full fidelity around players and a cheap simulation in the distance
+	FBotaniMoverLODTier& NearTier = LODTiers.AddDefaulted_GetRef();
+	NearTier.MaxDistance = 3000.f;
+
+	FBotaniMoverLODTier& MidTier = LODTiers.AddDefaulted_GetRef();
+	MidTier.MaxDistance = 8000.f;
+	MidTier.SimTickInterval = 1.f / 30.f;
+	MidTier.bAllowVaulting = false;
+	MidTier.bAllowSubstepping = false;
+
+	FBotaniMoverLODTier& FarTier = LODTiers.AddDefaulted_GetRef();
+	FarTier.SimTickInterval = 0.1f;
+	FarTier.bAllowWallRunning = false;
+	FarTier.bAllowVaulting = false;
+	FarTier.bAllowSubstepping = false;
+}
+
+void UBotaniMoverComponent::OnRegister()
+{
+	// Swap our settings for the archetype's shared instances before the modes cache them
+	if (bShareSettingsWithArchetype && !IsTemplate())
+	{
+		ShareSettingsWithArchetype();
+	}
+
+	Super::OnRegister();
+
+	// Shared settings are (re-)created during registration
+	RefreshSettingsRegistry();
+}
+
+void UBotaniMoverComponent::OnUnregister()
+{
+	// Drop the cached settings, they might be recreated on the next registration
+	SettingsRegistry = FBotaniSharedSettingsRegistry();
+	ModeTagBitsCache.Reset();
+
+	Super::OnUnregister();
 }
 
 void UBotaniMoverComponent::BeginPlay()
@@ -40,6 +95,152 @@ void UBotaniMoverComponent::BeginPlay()
 	Super::BeginPlay();
 
 	OnHandlerSettingChanged();
+
+	OnPreSimulationTick.AddUniqueDynamic(this, &ThisClass::OnRollbackPreSimulationTick);
+	OnPreSimulationTick.AddUniqueDynamic(this, &ThisClass::OnTimerPreSimulationTick);
+	OnPreSimulationTick.AddUniqueDynamic(this, &ThisClass::OnQueryCachePreSimulationTick);
+	OnPostMovement.AddUniqueDynamic(this, &ThisClass::OnTimerPostMovement);
+	OnPostMovement.AddUniqueDynamic(this, &ThisClass::OnTagsPostMovement);
+	OnPostMovement.AddUniqueDynamic(this, &ThisClass::OnProbesPostMovement);
+	OnPostMovement.AddUniqueDynamic(this, &ThisClass::OnFreeSpacePostMovement);
+	OnPostMovement.AddUniqueDynamic(this, &ThisClass::OnLandingPostMovement);
+
+	// Keep the collision params in sync with the updated component's collision settings
+	if (UPrimitiveComponent* UpdatedPrimitive = Cast<UPrimitiveComponent>(GetUpdatedComponent()))
+	{
+		UpdatedPrimitive->OnComponentCollisionSettingsChangedEvent.AddUObject(this, &ThisClass::OnUpdatedComponentCollisionSettingsChanged);
+		UpdatedPrimitive->OnComponentBeginOverlap.AddUniqueDynamic(this, &ThisClass::OnRestingBeginOverlap);
+		CollisionSettingsSource = UpdatedPrimitive;
+	}
+
+	CollisionParamsSignature = ComputeAttachmentSignature();
+	InvalidateCollisionParams();
+
+	// Select the movement LOD tiers periodically, staggered so pawns spawned together don't all update in the same frame
+	if (const UActorComponent* BackendComp = Cast<UActorComponent>(BackendLiaisonComp.GetObject()))
+	{
+		BaseSimTickInterval = BackendComp->GetComponentTickInterval();
+	}
+
+	if (bUseMovementLOD && !LODTiers.IsEmpty())
+	{
+		UpdateMovementLOD();
+		GetWorld()->GetTimerManager().SetTimer(LODTimerHandle, this, &ThisClass::UpdateMovementLOD,
+			LODUpdateInterval, true, FMath::FRandRange(0.5f, 1.f) * LODUpdateInterval);
+	}
+}
+
+void UBotaniMoverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UPrimitiveComponent* UpdatedPrimitive = CollisionSettingsSource.Get())
+	{
+		UpdatedPrimitive->OnComponentCollisionSettingsChangedEvent.RemoveAll(this);
+		UpdatedPrimitive->OnComponentBeginOverlap.RemoveDynamic(this, &ThisClass::OnRestingBeginOverlap);
+	}
+
+	OnPreSimulationTick.RemoveDynamic(this, &ThisClass::OnRollbackPreSimulationTick);
+	OnPreSimulationTick.RemoveDynamic(this, &ThisClass::OnTimerPreSimulationTick);
+	OnPreSimulationTick.RemoveDynamic(this, &ThisClass::OnQueryCachePreSimulationTick);
+	OnPostMovement.RemoveDynamic(this, &ThisClass::OnTimerPostMovement);
+	OnPostMovement.RemoveDynamic(this, &ThisClass::OnTagsPostMovement);
+	OnPostMovement.RemoveDynamic(this, &ThisClass::OnProbesPostMovement);
+	OnPostMovement.RemoveDynamic(this, &ThisClass::OnFreeSpacePostMovement);
+	OnPostMovement.RemoveDynamic(this, &ThisClass::OnLandingPostMovement);
+
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(LODTimerHandle);
+	}
+
+	CollisionSettingsSource.Reset();
+	LODSelector.Reset();
+	QueryBudgetState = FBotaniMoverQueryBudgetState();
+	ProbeService.Reset();
+	FreeSpaceBubble.Reset();
+	LandingPredictor.Reset();
+	RestingState.Reset();
+	LastTickSimTimeMs = TNumericLimits<double>::Lowest();
+	ModifierEffectiveSimTimeMs = 0.0;
+	MovementSettingsModifierHistory.Reset();
+	PendingTimerEdges.Reset();
+	bInSimulationTick = false;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UBotaniMoverComponent::ShareSettingsWithArchetype()
+{
+	const UBotaniMoverComponent* Archetype = Cast<UBotaniMoverComponent>(GetArchetype());
+	if (!Archetype || Archetype == this)
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	if (UBotaniMoverArchetypeSubsystem* ArchetypeSubsystem = World ? World->GetSubsystem<UBotaniMoverArchetypeSubsystem>() : nullptr)
+	{
+		SharedSettingsSavedBytes += ArchetypeSubsystem->ShareSettingsWithArchetype(Archetype->SharedSettings, SharedSettings);
+	}
+}
+
+void UBotaniMoverComponent::RefreshSettingsRegistry()
+{
+	SettingsRegistry.MoverSettings = FindSharedSettings<UBotaniMoverSettings>();
+	SettingsRegistry.MovementSettings = FindSharedSettings<UBotaniCommonMovementSettings>();
+	SettingsRegistry.WallRunSettings = FindSharedSettings<UBotaniWallRunMovementSettings>();
+	SettingsRegistry.StanceSettings = FindSharedSettings<UBotaniStanceSettings>();
+	SettingsRegistry.bResolved = true;
+}
+
+void UBotaniMoverComponent::PushMovementSettingsModifier(FName Source, const TArray<FBotaniMovementSettingsDelta>& Deltas, int32 Priority)
+{
+	MovementSettingsModifiers.Push(Source, Deltas, Priority);
+	MovementSettingsModifierHistory.Record(ModifierEffectiveSimTimeMs, MovementSettingsModifiers, ModifierHistoryDuration * 1000.0);
+	WakeFromRest();
+}
+
+bool UBotaniMoverComponent::PopMovementSettingsModifier(FName Source)
+{
+	if (!MovementSettingsModifiers.Pop(Source))
+	{
+		return false;
+	}
+
+	MovementSettingsModifierHistory.Record(ModifierEffectiveSimTimeMs, MovementSettingsModifiers, ModifierHistoryDuration * 1000.0);
+	WakeFromRest();
+	return true;
+}
+
+const FBotaniResolvedMovementSettings& UBotaniMoverComponent::GetEffectiveMovementSettings() const
+{
+	static const FBotaniResolvedMovementSettings EmptySettings;
+
+	const UBotaniCommonMovementSettings* BaseSettings = GetBotaniSettings<UBotaniCommonMovementSettings>();
+	if (!ensure(BaseSettings))
+	{
+		return EmptySettings;
+	}
+
+	// Skip the stack entirely if nobody is overriding anything
+	if (MovementSettingsModifiers.IsEmpty())
+	{
+		return BaseSettings->GetResolvedSettings();
+	}
+
+	return MovementSettingsModifiers.Resolve(*BaseSettings);
+}
+
+const FBotaniResolvedMovementSettings& UBotaniMoverComponent::GetEffectiveMovementSettings(
+	const UMoverComponent* MoverComp,
+	const UBotaniCommonMovementSettings* BaseSettings)
+{
+	if (const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp))
+	{
+		return BotaniMoverComp->GetEffectiveMovementSettings();
+	}
+
+	check(BaseSettings);
+	return BaseSettings->GetResolvedSettings();
 }
 
 bool UBotaniMoverComponent::GetHandleStanceChanges() const
@@ -58,7 +259,26 @@ void UBotaniMoverComponent::SetHandleStanceChanges(bool bInHandleStanceChanges)
 
 bool UBotaniMoverComponent::IsWallRunning() const
 {
-	return HasGameplayTag(BotaniGameplayTags::Mover::Modes::TAG_MM_WallRunning, true);
+	return HasAnyTagBits(BotaniMover::TagBits::WallRunning);
+}
+
+bool UBotaniMoverComponent::HasAnyTagBits(const uint16 Bits) const
+{
+	if (const FBotaniMoverTagsSyncState* TagBitsState = GetSyncState().SyncStateCollection.FindDataByType<FBotaniMoverTagsSyncState>())
+	{
+		return TagBitsState->HasAnyTagBits(Bits);
+	}
+
+	// Nothing simulated yet, fall back to the tag queries
+	for (int32 Idx = 0; Idx < BotaniMover::TagBits::NumBits; ++Idx)
+	{
+		if ((Bits & (1 << Idx)) && HasGameplayTag(BotaniMover::TagBits::GetBitTag(Idx), true))
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
 void UBotaniMoverComponent::OnMoverPreSimulationTick(
@@ -94,6 +314,8 @@ void UBotaniMoverComponent::OnMoverPreSimulationTick(
 		// Check if the stance has changed
 		if (OldActiveStance != NewActiveStance)
 		{
+			// A new stance changes the capsule, so the floor we rest on has to be found again
+			WakeFromRest();
 			OnStanceChanged.Broadcast(OldActiveStance, NewActiveStance);
 		}
 	}
@@ -110,3 +332,780 @@ void UBotaniMoverComponent::OnHandlerSettingChanged()
 		OnPreSimulationTick.RemoveDynamic(this, &ThisClass::OnMoverPreSimulationTick);
 	}
 }
+
+void UBotaniMoverComponent::QueueTimerEdge(const EBotaniMoverTimer Timer)
+{
+	QueueTimerEdge(Timer, TimerEdgeSimTimeMs);
+}
+
+void UBotaniMoverComponent::QueueTimerEdge(const EBotaniMoverTimer Timer, const double SimTimeMs)
+{
+	// Edges queued between ticks would not be simulated again after a correction, so they aren't predictable
+	if (!bInSimulationTick)
+	{
+		BOTANIMOVER_WARN("%s: Timer edges can only be queued during a simulation tick, ignoring timer %d", *GetNameSafe(GetOwner()), static_cast<int32>(Timer));
+		return;
+	}
+
+	PendingTimerEdges.SetTimeMs(Timer, FBotaniTimerSyncState::ToTimeMs(SimTimeMs));
+	SetTimerEdgeSimTime(SimTimeMs);
+}
+
+void UBotaniMoverComponent::QueueTimerEdge(UMoverComponent* MoverComp, const EBotaniMoverTimer Timer)
+{
+	if (UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp))
+	{
+		BotaniMoverComp->QueueTimerEdge(Timer);
+	}
+}
+
+void UBotaniMoverComponent::QueueTimerEdge(UMoverComponent* MoverComp, const EBotaniMoverTimer Timer, const double SimTimeMs)
+{
+	if (UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp))
+	{
+		BotaniMoverComp->QueueTimerEdge(Timer, SimTimeMs);
+	}
+}
+
+void UBotaniMoverComponent::SetTimerEdgeSimTime(const double SimTimeMs)
+{
+	// Sub-steps only move forward within a tick
+	TimerEdgeSimTimeMs = FMath::Max(TimerEdgeSimTimeMs, SimTimeMs);
+}
+
+void UBotaniMoverComponent::SetTimerEdgeSimTime(UMoverComponent* MoverComp, const double SimTimeMs)
+{
+	if (UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp))
+	{
+		BotaniMoverComp->SetTimerEdgeSimTime(SimTimeMs);
+	}
+}
+
+void UBotaniMoverComponent::CommitTimerEdges(FMoverSyncState& SyncState)
+{
+	if (PendingTimerEdges.IsEmpty())
+	{
+		return;
+	}
+
+	FBotaniTimerSyncState& OutTimers = SyncState.SyncStateCollection.FindOrAddMutableDataByType<FBotaniTimerSyncState>();
+	OutTimers.Apply(PendingTimerEdges);
+
+	PendingTimerEdges.Reset();
+}
+
+int64 UBotaniMoverComponent::GetTimerElapsedMs(
+	const FMoverSyncState& StartSyncState,
+	const EBotaniMoverTimer Timer,
+	const double SimTimeMs,
+	const int64 Fallback) const
+{
+	// Edges from this tick win, they haven't made it into the sync state yet
+	if (PendingTimerEdges.HasTimer(Timer))
+	{
+		return PendingTimerEdges.GetElapsedMs(Timer, SimTimeMs, Fallback);
+	}
+
+	const FBotaniTimerSyncState* Timers = StartSyncState.SyncStateCollection.FindDataByType<FBotaniTimerSyncState>();
+	return Timers ? Timers->GetElapsedMs(Timer, SimTimeMs, Fallback) : Fallback;
+}
+
+int64 UBotaniMoverComponent::GetTimerElapsedMs(
+	const UMoverComponent* MoverComp,
+	const FMoverSyncState& StartSyncState,
+	const EBotaniMoverTimer Timer,
+	const double SimTimeMs,
+	const int64 Fallback)
+{
+	if (const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp))
+	{
+		return BotaniMoverComp->GetTimerElapsedMs(StartSyncState, Timer, SimTimeMs, Fallback);
+	}
+
+	const FBotaniTimerSyncState* Timers = StartSyncState.SyncStateCollection.FindDataByType<FBotaniTimerSyncState>();
+	return Timers ? Timers->GetElapsedMs(Timer, SimTimeMs, Fallback) : Fallback;
+}
+
+void UBotaniMoverComponent::OnRollbackPreSimulationTick(
+	const FMoverTimeStep& TimeStep,
+	const FMoverInputCmdContext& InputCmd)
+{
+	// Simulation time only goes back when ticks are simulated again, e.g. after a correction
+	if (TimeStep.BaseSimTimeMs <= LastTickSimTimeMs)
+	{
+		HandleSimulationRollback(TimeStep.BaseSimTimeMs);
+	}
+
+	LastTickSimTimeMs = TimeStep.BaseSimTimeMs;
+
+	// Modifier changes made from now on, during this tick or until the next one, affect the following ticks
+	ModifierEffectiveSimTimeMs = TimeStep.BaseSimTimeMs + TimeStep.StepMs;
+}
+
+void UBotaniMoverComponent::HandleSimulationRollback(const double SimTimeMs)
+{
+	// We may have started resting in a future that is simulated again, and maybe differently
+	RestingState.Wake();
+
+	// Edges are per tick scratch, the committed ones are rolled back with the sync state
+	PendingTimerEdges.Reset();
+
+	// The arc was cast from a state the correction replaced
+	LandingPredictor.Reset();
+
+	// Modifiers changed by the ticks we simulate again are pushed again by them
+	if (!MovementSettingsModifierHistory.Restore(SimTimeMs, MovementSettingsModifiers))
+	{
+		BOTANIMOVER_WARN("%s: Can't rewind the movement settings modifiers to %.0fms, keeping the current ones", *GetNameSafe(GetOwner()), SimTimeMs);
+	}
+}
+
+void UBotaniMoverComponent::OnTimerPreSimulationTick(
+	const FMoverTimeStep& TimeStep,
+	const FMoverInputCmdContext& InputCmd)
+{
+	// Anything still pending belongs to a tick that never got committed
+	CurrentSimTimeMs = TimeStep.BaseSimTimeMs;
+	TimerEdgeSimTimeMs = TimeStep.BaseSimTimeMs;
+	PendingTimerEdges.Reset();
+	bInSimulationTick = true;
+}
+
+FBotaniMoverQueryCache* UBotaniMoverComponent::FindQueryCache(const UMoverComponent* MoverComp)
+{
+	const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	return BotaniMoverComp ? &BotaniMoverComp->GetQueryCache() : nullptr;
+}
+
+const FBotaniMoverCollisionParams& UBotaniMoverComponent::GetCollisionParams() const
+{
+	if (bCollisionParamsDirty)
+	{
+		CollisionParams.Build(this);
+		bCollisionParamsDirty = false;
+	}
+
+	return CollisionParams;
+}
+
+const FBotaniMoverCollisionParams& UBotaniMoverComponent::FindCollisionParams(
+	const UMoverComponent* MoverComp,
+	FBotaniMoverCollisionParams& Scratch)
+{
+	if (const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp))
+	{
+		return BotaniMoverComp->GetCollisionParams();
+	}
+
+	Scratch.Build(MoverComp);
+	return Scratch;
+}
+
+FBotaniMoverProbeService* UBotaniMoverComponent::FindProbeService(const UMoverComponent* MoverComp)
+{
+	const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	return BotaniMoverComp ? &BotaniMoverComp->GetProbeService() : nullptr;
+}
+
+void UBotaniMoverComponent::RequestPrefetchProbe(
+	const EBotaniMoverProbe Probe,
+	const int32 ForSimFrame,
+	const FVector& Center,
+	const float Radius,
+	const ECollisionChannel CollisionChannel,
+	const FCollisionResponseParams& ResponseParams)
+{
+	UWorld* World = GetWorld();
+	if (!bPrefetchAirborneProbes || !World)
+	{
+		return;
+	}
+
+	// A skipped prefetch only falls back to the synchronous probe, so it can wait for its share of the query budget
+	if (!UBotaniMoverQueryBudgetSubsystem::TryAcquireOptionalQueries(this))
+	{
+		return;
+	}
+
+	ProbeService.RequestProbe(World, Probe, ForSimFrame, Center, Radius + AsyncProbeMargin, CollisionChannel, GetCollisionParams().QueryParams, ResponseParams);
+}
+
+bool UBotaniMoverComponent::CanMoveWithoutSweep(
+	const FVector& Delta,
+	const FVector& SupportNormal,
+	const float SupportGap)
+{
+	UWorld* World = GetWorld();
+	const UPrimitiveComponent* UpdatedPrimitive = Cast<UPrimitiveComponent>(GetUpdatedComponent());
+	if (!bUseFreeSpaceBubble || !World || !UpdatedPrimitive)
+	{
+		return false;
+	}
+
+	// The bubble is a box aligned with the up direction, so it only fits an upright capsule
+	const FCollisionShape CollisionShape = UpdatedPrimitive->GetCollisionShape();
+	const FVector UpDirection = GetUpDirection();
+	if (!CollisionShape.IsCapsule() || (UpdatedPrimitive->GetUpVector() | UpDirection) < 1.f - UE_KINDA_SMALL_NUMBER)
+	{
+		FreeSpaceBubble.RecordMiss();
+		return false;
+	}
+
+	const FVector Location = UpdatedPrimitive->GetComponentLocation();
+	const FBotaniMoverCollisionParams& Params = GetCollisionParams();
+	if (FreeSpaceBubble.Validate(World, CurrentSimTimeMs) && FreeSpaceBubble.Contains(Location, Delta))
+	{
+		if (FreeSpaceBubble.IsMoveClearOfDynamics(World, Location, Delta, Params.CollisionChannel, Params.QueryParams, Params.DynamicResponseParams))
+		{
+			FreeSpaceBubble.RecordHit();
+			return true;
+		}
+
+		FreeSpaceBubble.RecordMiss();
+		return false;
+	}
+
+	// We left the bubble or lost it, so try to establish a new one around where we are now
+	if (FreeSpaceBubble.CanEstablish(CurrentSimTimeMs))
+	{
+		FBotaniMoverFreeSpaceBubble::FPlacement Placement;
+		Placement.Location = Location;
+		Placement.UpDirection = UpDirection;
+		Placement.CapsuleRadius = CollisionShape.GetCapsuleRadius();
+		Placement.CapsuleHalfHeight = CollisionShape.GetCapsuleHalfHeight();
+		Placement.SupportNormal = SupportNormal;
+		Placement.SupportGap = SupportGap;
+
+		// Establishing checked dynamic objects too, and nothing moved since
+		if (FreeSpaceBubble.Establish(World, Placement, FreeSpaceBubbleMargin,
+				CurrentSimTimeMs, FreeSpaceBubbleLifetime * BotaniMover::Lazy::SToMs, FreeSpaceBubbleRetryInterval * BotaniMover::Lazy::SToMs,
+				Params.CollisionChannel, Params.QueryParams, Params.ResponseParams)
+			&& FreeSpaceBubble.Contains(Location, Delta))
+		{
+			FreeSpaceBubble.RecordHit();
+			return true;
+		}
+	}
+
+	FreeSpaceBubble.RecordMiss();
+	return false;
+}
+
+bool UBotaniMoverComponent::CanMoveWithoutSweep(
+	UMoverComponent* MoverComp,
+	const FVector& Delta,
+	const FVector& SupportNormal,
+	const float SupportGap)
+{
+	UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	return BotaniMoverComp && BotaniMoverComp->CanMoveWithoutSweep(Delta, SupportNormal, SupportGap);
+}
+
+bool UBotaniMoverComponent::CanFallWithoutSweep(
+	const double StartSimTimeMs,
+	const FVector& StartVelocity,
+	const FVector& MoveVelocity,
+	const FVector& MoveInput,
+	const float DeltaSeconds) const
+{
+	UWorld* World = GetWorld();
+	const UPrimitiveComponent* UpdatedPrimitive = Cast<UPrimitiveComponent>(GetUpdatedComponent());
+	if (!bPredictLandings || !bPrefetchAirborneProbes || !World || !UpdatedPrimitive || DeltaSeconds <= 0.f)
+	{
+		return false;
+	}
+
+	const FCollisionShape CollisionShape = UpdatedPrimitive->GetCollisionShape();
+	if (!CollisionShape.IsCapsule())
+	{
+		return false;
+	}
+
+	const FVector Gravity = GetGravityAcceleration();
+	const FVector Location = UpdatedPrimitive->GetComponentLocation();
+	const double EndSimTimeMs = StartSimTimeMs + DeltaSeconds * BotaniMover::Lazy::SToMs;
+
+	// A different gravity or air control input bends the arc differently
+	if (LandingPredictor.IsValid() && !LandingPredictor.Matches(Gravity, MoveInput))
+	{
+		LandingPredictor.Invalidate();
+	}
+
+	const FBotaniMoverCollisionParams& Params = GetCollisionParams();
+	bool bDynamicsChecked = false;
+
+	if (LandingPredictor.IsValid())
+	{
+		// The static world was checked when the arc was cast, but dynamic objects may have moved onto it since
+		FVector StepCenter;
+		float StepRadius;
+		LandingPredictor.GetStepBounds(StartSimTimeMs, DeltaSeconds, StepCenter, StepRadius);
+
+		TConstArrayView<FOverlapResult> Candidates;
+		if (ProbeService.TryGetCandidates(World, EBotaniMoverProbe::Landing, QueryCache.GetSimFrame(), StepCenter, StepRadius, Candidates))
+		{
+			bDynamicsChecked = true;
+
+			for (const FOverlapResult& Candidate : Candidates)
+			{
+				const UPrimitiveComponent* CandidateComponent = Candidate.GetComponent();
+				// Stationary components can still be moved by gameplay, only fully static ones were vouched for by the cast
+				if (Candidate.bBlockingHit && CandidateComponent && (CandidateComponent->Mobility != EComponentMobility::Static || CandidateComponent->IsAnySimulatingPhysics()))
+				{
+					LandingPredictor.Invalidate();
+					break;
+				}
+			}
+		}
+	}
+	else if (LandingPredictor.CanPredict(StartSimTimeMs))
+	{
+		FBotaniMoverLandingPredictor::FLaunch Launch;
+		Launch.Location = Location;
+		Launch.Rotation = UpdatedPrimitive->GetComponentQuat();
+		Launch.Velocity = MoveVelocity;
+		Launch.Acceleration = (MoveVelocity - StartVelocity) / DeltaSeconds;
+		Launch.Gravity = Gravity;
+		Launch.MoveInput = MoveInput;
+		Launch.CollisionShape = CollisionShape;
+		Launch.SimTimeMs = StartSimTimeMs;
+		Launch.StepSeconds = DeltaSeconds;
+
+		// Casting the arc just checked everything along it, dynamic objects included
+		bDynamicsChecked = LandingPredictor.Predict(World, Launch,
+			LandingPredictionTolerance, LandingPredictionHorizon, LandingPredictionMaxSagitta, LandingPredictionRetryInterval * BotaniMover::Lazy::SToMs,
+			Params.CollisionChannel, Params.QueryParams, Params.ResponseParams);
+	}
+
+	if (!LandingPredictor.IsValid())
+	{
+		return false;
+	}
+
+	// Strayed from the arc or got close to the impact, the next tick casts a new arc
+	if (!LandingPredictor.CanFollow(Location, Location + MoveVelocity * DeltaSeconds, StartSimTimeMs, EndSimTimeMs))
+	{
+		LandingPredictor.Invalidate();
+		return false;
+	}
+
+	// Without the dynamic check the move has to sweep, but the arc stays valid
+	if (!bDynamicsChecked)
+	{
+		return false;
+	}
+
+	LandingPredictor.RecordFollowed(EndSimTimeMs);
+	return true;
+}
+
+bool UBotaniMoverComponent::CanFallWithoutSweep(
+	const UMoverComponent* MoverComp,
+	const double StartSimTimeMs,
+	const FVector& StartVelocity,
+	const FVector& MoveVelocity,
+	const FVector& MoveInput,
+	const float DeltaSeconds)
+{
+	const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	return BotaniMoverComp && BotaniMoverComp->CanFallWithoutSweep(StartSimTimeMs, StartVelocity, MoveVelocity, MoveInput, DeltaSeconds);
+}
+
+bool UBotaniMoverComponent::IsFollowingLandingPrediction(const UMoverComponent* MoverComp, const double SimTimeMs)
+{
+	const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	return BotaniMoverComp && BotaniMoverComp->LandingPredictor.ContinuesFrom(SimTimeMs);
+}
+
+FBotaniMoverRestingState* UBotaniMoverComponent::FindRestingState(const UMoverComponent* MoverComp)
+{
+	const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	return BotaniMoverComp && BotaniMoverComp->bUseRestingState ? &BotaniMoverComp->RestingState : nullptr;
+}
+
+bool UBotaniMoverComponent::AccumulateQuietTick(const FFloorCheckResult& Floor) const
+{
+	const USceneComponent* UpdatedComp = GetUpdatedComponent();
+	if (!bUseRestingState || !UpdatedComp)
+	{
+		return false;
+	}
+
+	return RestingState.AccumulateQuietTick(UpdatedComp->GetComponentTransform(), Floor, GetCollisionParams().CollisionChannel, RestingEntryTicks);
+}
+
+bool UBotaniMoverComponent::IsResting() const
+{
+	const USceneComponent* UpdatedComp = GetUpdatedComponent();
+	return bUseRestingState && UpdatedComp && RestingState.IsRestingAt(UpdatedComp->GetComponentTransform());
+}
+
+void UBotaniMoverComponent::WakeFromRest()
+{
+	RestingState.Wake();
+}
+
+FBotaniMoverQueryBudgetState* UBotaniMoverComponent::FindQueryBudgetState(const UMoverComponent* MoverComp)
+{
+	const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	return BotaniMoverComp ? &BotaniMoverComp->QueryBudgetState : nullptr;
+}
+
+const FBotaniMoverLODTier* UBotaniMoverComponent::FindLODTier(const UMoverComponent* MoverComp)
+{
+	const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	if (!BotaniMoverComp || !BotaniMoverComp->bUseMovementLOD)
+	{
+		return nullptr;
+	}
+
+	const int32 Tier = BotaniMoverComp->LODSelector.GetTier();
+	return BotaniMoverComp->LODTiers.IsValidIndex(Tier) ? &BotaniMoverComp->LODTiers[Tier] : nullptr;
+}
+
+const FBotaniMoverLODTier* UBotaniMoverComponent::FindSimulationLODTier(const UMoverComponent* MoverComp)
+{
+	// Another peer would pick its own tier, and simulate something else than the authority
+	if (!MoverComp || MoverComp->GetOwnerRole() != ROLE_Authority)
+	{
+		return nullptr;
+	}
+
+	return FindLODTier(MoverComp);
+}
+
+int32 UBotaniMoverComponent::GetMovementLODTier() const
+{
+	return bUseMovementLOD && LODTiers.IsValidIndex(LODSelector.GetTier()) ? LODSelector.GetTier() : INDEX_NONE;
+}
+
+void UBotaniMoverComponent::UpdateMovementLOD()
+{
+	const UWorld* World = GetWorld();
+	if (!bUseMovementLOD || !World || LODTiers.IsEmpty())
+	{
+		return;
+	}
+
+	// Only the authority lowers the fidelity, other peers would pick their tiers from their own view points and frame times
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	bool bTierChanged = false;
+
+	// Players are what everyone else is measured against, so they always get the full fidelity
+	const APawn* PawnOwner = GetOwner<APawn>();
+	if (PawnOwner && PawnOwner->IsPlayerControlled())
+	{
+		bTierChanged = LODSelector.Force(0, World->GetTimeSeconds());
+	}
+	else
+	{
+		FBotaniMoverLODInputs Inputs;
+		FindNearestPlayer(Inputs.NearestPlayerDistance, Inputs.bNetRelevant);
+
+		// Only a dedicated server's game thread time measures the simulation, elsewhere it includes rendering, editor and loading hitches
+		if (World->GetNetMode() == NM_DedicatedServer)
+		{
+			// A single long frame shouldn't demote anyone
+			SmoothedFrameTimeMs = FMath::Lerp(SmoothedFrameTimeMs, static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime)), 0.25f);
+
+			Inputs.FrameTimeMs = SmoothedFrameTimeMs;
+			Inputs.FrameTimeBudgetMs = LODFrameTimeBudget;
+		}
+
+		Inputs.TimeSeconds = World->GetTimeSeconds();
+
+		bTierChanged = LODSelector.Update(LODTiers, Inputs, LODHysteresis, LODMinDwellTime);
+	}
+
+	if (bTierChanged)
+	{
+		ApplyMovementLODTier();
+	}
+}
+
+void UBotaniMoverComponent::ApplyMovementLODTier()
+{
+	// Proxies keep the rate they were set up with, the authority's corrections reach them at its rate anyway
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	const FBotaniMoverLODTier* Tier = FindLODTier(this);
+
+	// The sim rate follows the tick of the backend, for backends that simulate on their own tick
+	if (UActorComponent* BackendComp = Cast<UActorComponent>(BackendLiaisonComp.GetObject()))
+	{
+		BackendComp->SetComponentTickInterval(FMath::Max(BaseSimTickInterval, Tier ? Tier->SimTickInterval : 0.f));
+	}
+}
+
+void UBotaniMoverComponent::FindNearestPlayer(float& OutDistance, bool& bOutNetRelevant) const
+{
+	const AActor* Owner = GetOwner();
+	const UWorld* World = GetWorld();
+
+	OutDistance = UE_BIG_NUMBER;
+
+	// Relevancy only means something to a server
+	const ENetMode NetMode = World ? World->GetNetMode() : NM_Standalone;
+	const bool bCheckRelevancy = NetMode == NM_DedicatedServer || NetMode == NM_ListenServer;
+	bOutNetRelevant = !bCheckRelevancy;
+
+	if (!Owner || !World)
+	{
+		return;
+	}
+
+	const FVector Location = Owner->GetActorLocation();
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		OutDistance = FMath::Min(OutDistance, static_cast<float>(FVector::Dist(Location, ViewLocation)));
+
+		if (!bOutNetRelevant)
+		{
+			bOutNetRelevant = Owner->IsNetRelevantFor(PlayerController, PlayerController->GetViewTarget(), ViewLocation);
+		}
+	}
+}
+
+void UBotaniMoverComponent::InvalidateCollisionParams()
+{
+	bCollisionParamsDirty = true;
+}
+
+void UBotaniMoverComponent::OnUpdatedComponentCollisionSettingsChanged(UPrimitiveComponent* ChangedComponent)
+{
+	InvalidateCollisionParams();
+	WakeFromRest();
+}
+
+void UBotaniMoverComponent::OnRestingBeginOverlap(
+	UPrimitiveComponent* OverlappedComponent,
+	AActor* OtherActor,
+	UPrimitiveComponent* OtherComp,
+	int32 OtherBodyIndex,
+	bool bFromSweep,
+	const FHitResult& SweepResult)
+{
+	WakeFromRest();
+}
+
+uint32 UBotaniMoverComponent::ComputeAttachmentSignature() const
+{
+	const AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return 0;
+	}
+
+	// Hash exactly what the collision params ignore: our child actors and the updated component's move ignore lists
+	// Nested child actors are spawned along with their parent, so a new one always comes with a new direct child actor
+	uint32 Signature = GetTypeHash(GetUpdatedComponent());
+	Owner->ForEachComponent<UChildActorComponent>(false, [&Signature](const UChildActorComponent* ChildActorComponent)
+	{
+		Signature = HashCombineFast(Signature, GetTypeHash(ChildActorComponent->GetChildActor()));
+	});
+
+	if (const UPrimitiveComponent* UpdatedPrimitive = Cast<UPrimitiveComponent>(GetUpdatedComponent()))
+	{
+		for (const AActor* IgnoredActor : UpdatedPrimitive->GetMoveIgnoreActors())
+		{
+			Signature = HashCombineFast(Signature, GetTypeHash(IgnoredActor));
+		}
+
+		for (const UPrimitiveComponent* IgnoredComponent : UpdatedPrimitive->GetMoveIgnoreComponents())
+		{
+			Signature = HashCombineFast(Signature, GetTypeHash(IgnoredComponent));
+		}
+	}
+
+	return Signature;
+}
+
+int64 UBotaniMoverComponent::GetQueryCacheHits() const
+{
+	return static_cast<int64>(QueryCache.GetNumHits());
+}
+
+int64 UBotaniMoverComponent::GetQueryCacheMisses() const
+{
+	return static_cast<int64>(QueryCache.GetNumMisses());
+}
+
+int64 UBotaniMoverComponent::GetFreeSpaceHits() const
+{
+	return static_cast<int64>(FreeSpaceBubble.GetNumHits());
+}
+
+int64 UBotaniMoverComponent::GetFreeSpaceMisses() const
+{
+	return static_cast<int64>(FreeSpaceBubble.GetNumMisses());
+}
+
+int64 UBotaniMoverComponent::GetRestingTicks() const
+{
+	return static_cast<int64>(RestingState.GetNumRestingTicks());
+}
+
+void UBotaniMoverComponent::OnQueryCachePreSimulationTick(
+	const FMoverTimeStep& TimeStep,
+	const FMoverInputCmdContext& InputCmd)
+{
+	// The world may have changed since the last frame, so nothing carries over
+	QueryCache.BeginFrame(TimeStep.ServerFrame);
+
+	// Rebuild the collision params once a child actor or a move ignore list changed
+	// The collision settings themselves are caught by OnUpdatedComponentCollisionSettingsChanged
+	const uint32 AttachmentSignature = ComputeAttachmentSignature();
+	if (AttachmentSignature != CollisionParamsSignature)
+	{
+		CollisionParamsSignature = AttachmentSignature;
+		InvalidateCollisionParams();
+	}
+}
+
+void UBotaniMoverComponent::OnProbesPostMovement(
+	const FMoverTimeStep& TimeStep,
+	FMoverSyncState& SyncState,
+	FMoverAuxStateContext& AuxState)
+{
+	if (!bPrefetchAirborneProbes)
+	{
+		return;
+	}
+
+	// Walls only matter while we're in the air or already on one
+	const UBotaniMoverSettings* BotaniMoverSettings = FindBotaniSettings<UBotaniMoverSettings>(this);
+	const bool bAirborne = BotaniMoverSettings && SyncState.MovementMode == BotaniMoverSettings->AirMovementModeName;
+	if (!bAirborne && SyncState.MovementMode != BotaniMover::ModeNames::WallRunning)
+	{
+		return;
+	}
+
+	// Lower movement LOD tiers don't start wall runs, so there is nothing to probe for until we're on a wall
+	const FBotaniMoverLODTier* LODTier = FindSimulationLODTier(this);
+	if (bAirborne && LODTier && !LODTier->bAllowWallRunning)
+	{
+		return;
+	}
+
+	const UBotaniWallRunMovementSettings* WallRunSettings = FindBotaniSettings<UBotaniWallRunMovementSettings>(this);
+	const FMoverDefaultSyncState* DefaultSyncState = SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+	if (!WallRunSettings || !DefaultSyncState)
+	{
+		return;
+	}
+
+	// Predict where the next frame will probe from, assuming it's as long as this one
+	const FVector PredictedLocation = DefaultSyncState->GetLocation_WorldSpace() + DefaultSyncState->GetVelocity_WorldSpace() * (TimeStep.StepMs * 0.001f);
+	const float ProbeRadius = FMath::Sqrt(FMath::Square(WallRunSettings->WallTraceVectorsHeadDelta) + FMath::Square(WallRunSettings->WallTraceVectorsTailDelta));
+
+	// Nothing to prefetch if the baked wall run index already rules out any wall there
+	if (UBotaniWallRunIndexSubsystem::CanSkipWallProbe(GetWorld(), PredictedLocation, ProbeRadius + AsyncProbeMargin, WallRunSettings->WallTraceChannel, GetOwner()))
+	{
+		return;
+	}
+
+	RequestPrefetchProbe(EBotaniMoverProbe::Wall, TimeStep.ServerFrame + 1, PredictedLocation, ProbeRadius, WallRunSettings->WallTraceChannel);
+}
+
+void UBotaniMoverComponent::OnFreeSpacePostMovement(
+	const FMoverTimeStep& TimeStep,
+	FMoverSyncState& SyncState,
+	FMoverAuxStateContext& AuxState)
+{
+	UWorld* World = GetWorld();
+	if (!bUseFreeSpaceBubble || !World || !FreeSpaceBubble.IsValid())
+	{
+		return;
+	}
+
+	// Dynamic objects may move into the bubble at any time, so it's checked again before every move
+	const FBotaniMoverCollisionParams& Params = GetCollisionParams();
+	FreeSpaceBubble.RequestRecheck(World, Params.CollisionChannel, Params.QueryParams, Params.ResponseParams);
+}
+
+void UBotaniMoverComponent::OnLandingPostMovement(
+	const FMoverTimeStep& TimeStep,
+	FMoverSyncState& SyncState,
+	FMoverAuxStateContext& AuxState)
+{
+	if (!LandingPredictor.IsValid())
+	{
+		return;
+	}
+
+	// Landing, wall running or anything else ends the fall the arc was predicted for
+	const UBotaniMoverSettings* BotaniMoverSettings = FindBotaniSettings<UBotaniMoverSettings>(this);
+	if (!BotaniMoverSettings || SyncState.MovementMode != BotaniMoverSettings->AirMovementModeName)
+	{
+		LandingPredictor.Invalidate();
+		return;
+	}
+
+	// Check the next step of the arc for dynamic objects, assuming it's as long as this one
+	const double NextSimTimeMs = TimeStep.BaseSimTimeMs + TimeStep.StepMs;
+	FVector StepCenter;
+	float StepRadius;
+	LandingPredictor.GetStepBounds(NextSimTimeMs, TimeStep.StepMs * BotaniMover::Lazy::MsToS, StepCenter, StepRadius);
+
+	RequestPrefetchProbe(EBotaniMoverProbe::Landing, TimeStep.ServerFrame + 1, StepCenter, StepRadius, GetCollisionParams().CollisionChannel, GetCollisionParams().ResponseParams);
+}
+
+void UBotaniMoverComponent::OnTimerPostMovement(
+	const FMoverTimeStep& TimeStep,
+	FMoverSyncState& SyncState,
+	FMoverAuxStateContext& AuxState)
+{
+	CommitTimerEdges(SyncState);
+	bInSimulationTick = false;
+}
+
+void UBotaniMoverComponent::OnTagsPostMovement(
+	const FMoverTimeStep& TimeStep,
+	FMoverSyncState& SyncState,
+	FMoverAuxStateContext& AuxState)
+{
+	const FGameplayTagsSyncState* TagsState = SyncState.SyncStateCollection.FindDataByType<FGameplayTagsSyncState>();
+	const uint16 MovementTagBits = TagsState ? BotaniMover::TagBits::GetTagBits(TagsState->GetMovementTags()) : BotaniMover::TagBits::None;
+
+	FBotaniMoverTagsSyncState& OutTagBits = SyncState.SyncStateCollection.FindOrAddMutableDataByType<FBotaniMoverTagsSyncState>();
+	OutTagBits.SetTagBits(MovementTagBits, GetModeTagBits(SyncState.MovementMode));
+}
+
+uint16 UBotaniMoverComponent::GetModeTagBits(const FName ModeName)
+{
+	if (const uint16* CachedBits = ModeTagBitsCache.Find(ModeName))
+	{
+		return *CachedBits;
+	}
+
+	uint16 ModeBits = BotaniMover::TagBits::None;
+	if (const UBaseMovementMode* Mode = MovementModes.FindRef(ModeName))
+	{
+		for (int32 Idx = 0; Idx < BotaniMover::TagBits::NumBits; ++Idx)
+		{
+			if (Mode->HasGameplayTag(BotaniMover::TagBits::GetBitTag(Idx), true))
+			{
+				ModeBits |= (1 << Idx);
+			}
+		}
+	}
+
+	ModeTagBitsCache.Add(ModeName, ModeBits);
+	return ModeBits;
+}
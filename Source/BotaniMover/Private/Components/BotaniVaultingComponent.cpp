@@ -6,9 +6,11 @@
 #include "BotaniMoverAbilityInputs.h"
 #include "MotionWarpingComponent.h"
 #include "MoverComponent.h"
+#include "MoverDataModelTypes.h"
 #include "Components/BotaniMoverComponent.h"
 #include "DefaultMovementSet/Settings/CommonLegacyMovementSettings.h"
 #include "MoveLibrary/VaultingQueryUtils.h"
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
 
 #if WITH_EDITOR
 #include "Misc/DataValidation.h"
@@ -31,6 +33,8 @@ void UBotaniVaultingComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	RebuildResolvedVaultingValues();
+
 	// Grab the mover component on the owning pawn
 	const APawn* Pawn = GetPawn<APawn>();
 	check(IsValid(Pawn));
@@ -41,6 +45,7 @@ void UBotaniVaultingComponent::BeginPlay()
 	WeakMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
 
 	MoverComp->OnPreSimulationTick.AddDynamic(this, &ThisClass::OnMoverPreSimulationTick);
+	MoverComp->OnPostMovement.AddDynamic(this, &ThisClass::OnMoverPostMovement);
 }
 
 void UBotaniVaultingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -50,6 +55,7 @@ void UBotaniVaultingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	if (UBotaniMoverComponent* BotaniMover = GetMoverComponent())
 	{
 		BotaniMover->OnPreSimulationTick.RemoveAll(this);
+		BotaniMover->OnPostMovement.RemoveAll(this);
 	}
 }
 
@@ -87,6 +93,18 @@ UBotaniMoverComponent* UBotaniVaultingComponent::GetMoverComponent() const
 	return WeakMoverComp.Get();
 }
 
+void UBotaniVaultingComponent::RebuildResolvedVaultingValues()
+{
+	// Steeper slopes have smaller cosines, so the max angle is the lower bound
+	ResolvedVaultSlopeRangeCosine = FFloatRange::Inclusive(
+		FMath::Cos(FMath::DegreesToRadians(MaxVaultingSlopeAngle.GetValue())),
+		FMath::Cos(FMath::DegreesToRadians(MinVaultingSlopeAngle.GetValue())));
+
+	ResolvedVaultingTraceDistance = VaultingTraceDistance.GetValue();
+	ResolvedMinVaultingHeight = MinVaultingHeight.GetValue();
+	ResolvedMaxVaultingHeight = MaxVaultingHeight.GetValue();
+}
+
 void UBotaniVaultingComponent::OnMoverPreSimulationTick(
 	const FMoverTimeStep& TimeStep,
 	const FMoverInputCmdContext& InputCmd)
@@ -103,6 +121,13 @@ void UBotaniVaultingComponent::OnMoverPreSimulationTick(
 		return;
 	}
 
+	// Lower movement LOD tiers don't scan for vaulting paths
+	const FBotaniMoverLODTier* LODTier = UBotaniMoverComponent::FindSimulationLODTier(BotaniMover);
+	if (LODTier && !LODTier->bAllowVaulting)
+	{
+		return;
+	}
+
 	// Get the pawn
 	const APawn* Pawn = BotaniMover->GetOwner<APawn>();
 	if (!IsValid(Pawn))
@@ -121,25 +146,31 @@ void UBotaniVaultingComponent::OnMoverPreSimulationTick(
 		return;
 	}
 
-	// Find a vaulting path
-	FFloatRange VaultSlopeRangeCosine;
-	VaultSlopeRangeCosine.SetLowerBoundValue(FMath::Cos(MinVaultingSlopeAngle.GetValue()));
-	VaultSlopeRangeCosine.SetUpperBoundValue(FMath::Cos(MaxVaultingSlopeAngle.GetValue()));
+	// Vaulting is optional, far pawns may have to wait a few frames for their share of the query budget
+	// A deferred scan queues no vault, and a resimulated tick replays the original decision
+	if (!UBotaniMoverQueryBudgetSubsystem::TryAcquireOptionalSimQueries(BotaniMover, TimeStep.BaseSimTimeMs, NumVaultingSamples))
+	{
+		return;
+	}
 
+	// Find a vaulting path
 	FMovingComponentSet MovingComps;
 	MovingComps.SetFrom(BotaniMover);
 
 	FVaultingPathCheckResult VaultingPathCheck;
 	UVaultingQueryUtils::FindVaultingPath(
 		MovingComps,
-		MaxVaultingHeight.GetValue(),
-		MinVaultingHeight.GetValue(),
-		VaultingTraceDistance.GetValue(),
+		ResolvedMaxVaultingHeight,
+		ResolvedMinVaultingHeight,
+		ResolvedVaultingTraceDistance,
 		NumVaultingSamples,
 		Pawn->GetActorLocation(),
 		Pawn->GetActorRotation(),
-		VaultSlopeRangeCosine,
-		VaultingPathCheck);
+		ResolvedVaultSlopeRangeCosine,
+		VaultingSurfaceFilter,
+		VaultingPathCheck,
+		TimeStep.ServerFrame,
+		bUseVaultingTraceChannel ? VaultingTraceChannel.GetValue() : ECC_MAX);
 
 	if (!VaultingPathCheck.IsValidVaultingPath())
 	{
@@ -154,7 +185,7 @@ void UBotaniVaultingComponent::OnMoverPreSimulationTick(
 	}
 
 	// Queue falling movement mode
-	const UBotaniMoverSettings* BotaniMoverSettings = BotaniMover->FindSharedSettings<UBotaniMoverSettings>();
+	const UBotaniMoverSettings* BotaniMoverSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniMoverSettings>(BotaniMover);
 	check(BotaniMoverSettings);
 
 	BotaniMover->QueueNextMode(BotaniMoverSettings->AirMovementModeName, false);
@@ -168,6 +199,46 @@ void UBotaniVaultingComponent::OnMoverPreSimulationTick(
 	OnVaultingStarted.Broadcast(VaultingPathCheck);
 }
 
+void UBotaniVaultingComponent::OnMoverPostMovement(
+	const FMoverTimeStep& TimeStep,
+	FMoverSyncState& SyncState,
+	FMoverAuxStateContext& AuxState)
+{
+	UBotaniMoverComponent* BotaniMover = GetMoverComponent();
+	if (!IsValid(BotaniMover))
+	{
+		return;
+	}
+
+	// We only vault while airborne, so only prefetch then
+	const UBotaniMoverSettings* BotaniMoverSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniMoverSettings>(BotaniMover);
+	if (!BotaniMoverSettings || SyncState.MovementMode != BotaniMoverSettings->AirMovementModeName)
+	{
+		return;
+	}
+
+	const FMoverDefaultSyncState* DefaultSyncState = SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+	if (!DefaultSyncState)
+	{
+		return;
+	}
+
+	// Predict where the next frame will look for a vaulting path from
+	const FVector PredictedLocation = DefaultSyncState->GetLocation_WorldSpace() + DefaultSyncState->GetVelocity_WorldSpace() * (TimeStep.StepMs * 0.001f);
+	const float ProbeRadius = UVaultingQueryUtils::GetVaultingProbeRadius(BotaniMover->GetUpdatedComponent(), ResolvedMaxVaultingHeight, ResolvedVaultingTraceDistance);
+
+	if (bUseVaultingTraceChannel)
+	{
+		BotaniMover->RequestPrefetchProbe(EBotaniMoverProbe::Vault, TimeStep.ServerFrame + 1, PredictedLocation, ProbeRadius, VaultingTraceChannel);
+	}
+	else
+	{
+		const FBotaniMoverCollisionParams& CollisionParams = BotaniMover->GetCollisionParams();
+		BotaniMover->RequestPrefetchProbe(EBotaniMoverProbe::Vault, TimeStep.ServerFrame + 1, PredictedLocation, ProbeRadius,
+			CollisionParams.CollisionChannel, CollisionParams.ResponseParams);
+	}
+}
+
 #if WITH_EDITOR
 #undef LOCTEXT_NAMESPACE
 #endif
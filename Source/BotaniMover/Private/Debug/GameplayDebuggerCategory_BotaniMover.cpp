@@ -6,6 +6,7 @@
 #if WITH_GAMEPLAY_DEBUGGER
 
 #include "BotaniMoverSettings.h"
+#include "BotaniTimerSyncState.h"
 #include "MoverComponent.h"
 #include "Engine/Engine.h"
 #include "Engine/Font.h"
@@ -164,36 +165,35 @@ void FGameplayDebuggerCategory_BotaniMover::CollectData(
 			DataPack.SuggestedModeName = DefaultInputs->SuggestedMovementMode.ToString();
 		}
 
-		if (const UMoverBlackboard* SimBlackboard = MyMoverComponent->GetSimBlackboard())
-		{
-			CollectBlackboardDebugData(DataPack, SimBlackboard);
-		}
+		CollectTimerDebugData(DataPack, SyncState, MyMoverComponent->GetLastTimeStep().BaseSimTimeMs);
 	}
 }
 
-void FGameplayDebuggerCategory_BotaniMover::CollectBlackboardDebugData(
+void FGameplayDebuggerCategory_BotaniMover::CollectTimerDebugData(
 	FRepData& InOutDataPack,
-	const UMoverBlackboard* SimBlackboard)
+	const FMoverSyncState& SyncState,
+	const double SimTimeMs)
 {
-	auto AddFloatValue = [&MyDataPack=InOutDataPack, &MySimBlackboard=SimBlackboard]
-		(FName BlackboardKey)
-		{
-			float Value = 0.f;
-			if (MySimBlackboard->TryGet<float>(BlackboardKey, Value))
-			{
-				// Add the key and value to the data pack
-				// Format: "KeyName: Value (Value in seconds)"
-				MyDataPack.BlackboardData.Add(
-					BlackboardKey.ToString(),
-					FString::Printf(TEXT("%f\t\t{grey}(%.2fs)"), Value, Value * BotaniMover::Lazy::MsToS));
-			}
-		};
+	const FBotaniTimerSyncState* Timers = SyncState.SyncStateCollection.FindDataByType<FBotaniTimerSyncState>();
+	if (!Timers)
+	{
+		return;
+	}
+
+	for (int32 Idx = 0; Idx < FBotaniTimerSyncState::NumTimers; ++Idx)
+	{
+		const EBotaniMoverTimer Timer = static_cast<EBotaniMoverTimer>(Idx);
 
-	AddFloatValue(BotaniMover::Blackboard::LastFallTime);
-	AddFloatValue(BotaniMover::Blackboard::LastJumpTime);
-	AddFloatValue(BotaniMover::Blackboard::LastWallRunTime);
-	AddFloatValue(BotaniMover::Blackboard::LastWallRunStartTime);
-	AddFloatValue(BotaniMover::Blackboard::LastWallJumpTime);
+		int64 TimeMs = 0;
+		if (Timers->TryGetTimeMs(Timer, TimeMs))
+		{
+			// Add the timer and value to the data pack
+			// Format: "TimerName: Value (Elapsed in seconds)"
+			InOutDataPack.TimerData.Add(
+				StaticEnum<EBotaniMoverTimer>()->GetNameStringByValue(Idx),
+				FString::Printf(TEXT("%lld\t\t{grey}(%.2fs ago)"), TimeMs, Timers->GetElapsedMs(Timer, SimTimeMs) * BotaniMover::Lazy::MsToS));
+		}
+	}
 }
 
 void FGameplayDebuggerCategory_BotaniMover::DrawData(
@@ -239,11 +239,11 @@ void FGameplayDebuggerCategory_BotaniMover::DrawData(
 		*FString::JoinBy(DataPack.SyncStateDataTypes, TEXT(","), [](FString SyncStateTypeAsString) { return SyncStateTypeAsString; })
 		);
 
-	// Blackboard data
-	if (DataPack.BlackboardData.Num() > 0)
+	// Timer data
+	if (DataPack.TimerData.Num() > 0)
 	{
-		CanvasContext.Printf(TEXT("\n\n{yellow}Blackboard Data: {white}\n%s"),
-			*FString::JoinBy(DataPack.BlackboardData, TEXT("\n"), [](const TPair<FString, FString>& KeyValuePair)
+		CanvasContext.Printf(TEXT("\n\n{yellow}Timers: {white}\n%s"),
+			*FString::JoinBy(DataPack.TimerData, TEXT("\n"), [](const TPair<FString, FString>& KeyValuePair)
 			{
 				return FString::Printf(TEXT("{grey}%s: {white}%s"), *KeyValuePair.Key, *KeyValuePair.Value);
 			}));
@@ -394,7 +394,7 @@ void FGameplayDebuggerCategory_BotaniMover::FRepData::Serialize(FArchive& Ar)
 	Ar << MoveInput;
 	Ar << OrientIntentDir;
 	Ar << SuggestedModeName;
-	Ar << BlackboardData;
+	Ar << TimerData;
 }
 
 
@@ -7,9 +7,11 @@
 #include "CoreMinimal.h"
 #include "GameplayDebuggerCategory.h"
 
+struct FMoverSyncState;
+
 /**
- * Pretty much a copy of FGameplayDebuggerCategory_Mover, however now also with Blackboard data,
- * it was annoying to not see what was going on at the blackboard.
+ * Pretty much a copy of FGameplayDebuggerCategory_Mover, however now also with the Botani timers,
+ * it was annoying to not see what was going on with them.
  *
  * NOTE: You should disable the engine "Mover" category in the Gameplay Debugger settings.
  */
@@ -57,8 +59,8 @@ protected:
 		FVector OrientIntentDir;
 		FString SuggestedModeName;
 
-		// Blackboard data
-		TMap<FString, FString> BlackboardData;
+		// Timer data
+		TMap<FString, FString> TimerData;
 
 	public:
 		void Serialize(FArchive& Ar);
@@ -71,7 +73,7 @@ private:
 
 
 	// This method is the almost sole reason for this entire class to exist.
-	void CollectBlackboardDebugData(FRepData& InOutDataPack, const class UMoverBlackboard* SimBlackboard);
+	void CollectTimerDebugData(FRepData& InOutDataPack, const FMoverSyncState& SyncState, double SimTimeMs);
 };
 
 #endif
@@ -0,0 +1,36 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "IBotaniMoverPhysicalMaterial.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(IBotaniMoverPhysicalMaterial)
+
+void FBotaniPhysicalMaterialMovementProperties::Apply(float& InOutFriction, float& InOutAcceleration, float& InOutDeceleration) const
+{
+	InOutFriction = FrictionSource ? FrictionSource->CalculateFrictionCoefficient(InOutFriction) : InOutFriction * FrictionScale + FrictionOffset;
+	InOutAcceleration = bOverrideAcceleration ? AccelerationOverride : InOutAcceleration;
+	InOutDeceleration = bOverrideDeceleration ? DecelerationOverride : InOutDeceleration;
+}
+
+FBotaniPhysicalMaterialMovementProperties IBotaniMoverPhysicalMaterial::GetMovementProperties() const
+{
+	FBotaniPhysicalMaterialMovementProperties Properties;
+
+	// The friction may be any function of the input friction, so only the material itself can compute it
+	Properties.FrictionSource = this;
+
+	if (const TOptional<float> AccelerationOverride = GetAccelerationOverride(); AccelerationOverride.IsSet())
+	{
+		Properties.AccelerationOverride = AccelerationOverride.GetValue();
+		Properties.bOverrideAcceleration = true;
+	}
+
+	if (const TOptional<float> DecelerationOverride = GetDecelerationOverride(); DecelerationOverride.IsSet())
+	{
+		Properties.DecelerationOverride = DecelerationOverride.GetValue();
+		Properties.bOverrideDeceleration = true;
+	}
+
+	return Properties;
+}
@@ -5,9 +5,9 @@
 
 #include "BotaniCommonMovementSettings.h"
 #include "BotaniMoverSettings.h"
-#include "CommonBlackboard.h"
 #include "CommonMoverComponent.h"
 #include "MoverComponent.h"
+#include "Components/BotaniMoverComponent.h"
 #include "MoveLibrary/AirMovementUtils.h"
 #include "MoveLibrary/MovementUtils.h"
 
@@ -41,10 +41,11 @@ bool FBotaniLM_Jump::GenerateMove(
 	FProposedMove& OutProposedMove)
 {
 	// Grab required data
-	const UBotaniCommonMovementSettings* BotaniMovementSettings = MoverComp->FindSharedSettings<UBotaniCommonMovementSettings>();
+	const UBotaniCommonMovementSettings* BotaniMovementSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniCommonMovementSettings>(MoverComp);
 	check(BotaniMovementSettings);
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(MoverComp, BotaniMovementSettings);
 
-	const UBotaniMoverSettings* BotaniMoverSettings = MoverComp->FindSharedSettings<UBotaniMoverSettings>();
+	const UBotaniMoverSettings* BotaniMoverSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniMoverSettings>(MoverComp);
 	check(BotaniMoverSettings);
 
 	const FMoverDefaultSyncState* SyncState = StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
@@ -169,10 +170,10 @@ bool FBotaniLM_Jump::GenerateMove(
 		// Add velocity change due to gravity
 		OutProposedMove.LinearVelocity += UMovementUtils::ComputeVelocityFromGravity(MoverComp->GetGravityAcceleration(), Params.DeltaSeconds);
 
-		// Save the fall time to the blackboard
+		// Record the fall time
 		if (TimeStep.BaseSimTimeMs == StartSimTimeMs)
 		{
-			SimBlackboard->Set(CommonBlackboard::LastFallTime, StartSimTimeMs);
+			UBotaniMoverComponent::QueueTimerEdge(const_cast<UMoverComponent*>(MoverComp), EBotaniMoverTimer::LastFall, TimeStep.BaseSimTimeMs);
 		}
 	}
 	else
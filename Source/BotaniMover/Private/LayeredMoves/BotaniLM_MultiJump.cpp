@@ -10,6 +10,7 @@
 #include "MoverComponent.h"
 #include "MoverDataModelTypes.h"
 #include "MoverSimulationTypes.h"
+#include "Components/BotaniMoverComponent.h"
 #include "MoveLibrary/FloorQueryUtils.h"
 #include "MoveLibrary/MoverBlackboard.h"
 
@@ -74,7 +75,7 @@ bool FBotaniLM_MultiJump::PerformJump(
 	FProposedMove& OutProposedMove)
 {
 	TimeOfLastJumpMS = TimeStep.BaseSimTimeMs;
-	if (const TObjectPtr<const UBotaniMoverSettings> BotaniMoverSettings = MoverComp->FindSharedSettings<UBotaniMoverSettings>())
+	if (const TObjectPtr<const UBotaniMoverSettings> BotaniMoverSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniMoverSettings>(MoverComp))
 	{
 		OutProposedMove.PreferredMode = BotaniMoverSettings->AirMovementModeName;
 	}
@@ -158,7 +159,7 @@ bool FBotaniLM_MultiJump::GenerateMove(
 	UMoverBlackboard* SimBlackboard,
 	FProposedMove& OutProposedMove)
 {
-	const UBotaniMoverSettings* BotaniMoverSettings = MoverComp->FindSharedSettings<UBotaniMoverSettings>();
+	const UBotaniMoverSettings* BotaniMoverSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniMoverSettings>(MoverComp);
 	check(BotaniMoverSettings);
 
 	const FMoverDefaultSyncState* SyncState = StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
@@ -5,11 +5,10 @@
 
 #include "MoverComponent.h"
 
-#include "AbilitySystemComponent.h"
-#include "AbilitySystemGlobals.h"
-
 #include "BotaniCommonMovementSettings.h"
 #include "BotaniMoverSettings.h"
+#include "BotaniMoverStats.h"
+#include "Components/BotaniMoverComponent.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMM_Base)
@@ -25,13 +24,16 @@ void UBotaniMM_Base::OnRegistered(const FName ModeName)
 {
 	Super::OnRegistered(ModeName);
 
+	// The owner's components may have changed since we were last registered
+	AbilityStateSource.Reset();
+
 	// Get the botani mover settings
-	BotaniMoverSettings = GetMoverComponent()->FindSharedSettings<UBotaniMoverSettings>();
+	BotaniMoverSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniMoverSettings>(GetMoverComponent());
 	ensureMsgf(BotaniMoverSettings, TEXT("Failed to find instance of BotaniMoverSettings on %s. Movement may not function properly."),
 		*GetPathNameSafe(this));
 
 	// Get the common movement settings
-	BotaniMovementSettings = GetMoverComponent()->FindSharedSettings<UBotaniCommonMovementSettings>();
+	BotaniMovementSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniCommonMovementSettings>(GetMoverComponent());
 	ensureMsgf(BotaniMovementSettings, TEXT("Failed to find instance of BotaniCommonMovementSettings on %s. Movement may not function properly."),
 		*GetPathNameSafe(this));
 }
@@ -44,5 +46,55 @@ void UBotaniMM_Base::OnUnregistered()
 	// Release the common movement settings pointer
 	BotaniMovementSettings = nullptr;
 
+	AbilityStateSource.Reset();
+
 	Super::OnUnregistered();
 }
+
+bool UBotaniMM_Base::PrepareSimulationData(const FSimulationTickParams& Params)
+{
+	if (!Super::PrepareSimulationData(Params))
+	{
+		return false;
+	}
+
+	// Only simulate the first sub-step, the refunded remainder makes the state machine run us again for the next one
+	const float SubstepMs = SubstepPolicy.ComputeSubstepMs(Params.StartState, Params.TimeStep, GetMoverComponent());
+	UnusedStepMs = Params.TimeStep.StepMs - SubstepMs;
+	SubstepStartSimTimeMs = Params.TimeStep.BaseSimTimeMs;
+	DeltaMs = SubstepMs;
+	DeltaTime = SubstepMs * BotaniMover::Lazy::MsToS;
+
+	// A mode change out of this sub-step takes effect at its end
+	UBotaniMoverComponent::SetTimerEdgeSimTime(GetMoverComponent(), Params.TimeStep.BaseSimTimeMs + SubstepMs);
+
+	if (UnusedStepMs > 0.f)
+	{
+		INC_DWORD_STAT(STAT_BotaniMover_Substeps);
+	}
+
+	return true;
+}
+
+FBotaniMoverAbilityStateInputs UBotaniMM_Base::GetAbilityState(const FMoverTickStartData& StartState) const
+{
+	return AbilityStateSource.Resolve(GetMoverComponent(), StartState.InputCmd,
+		BotaniMoverSettings ? BotaniMoverSettings->StopMovementTag : FGameplayTag());
+}
+
+void UBotaniMM_Base::ApplyAbilityState(
+	const FMoverTickStartData& StartState,
+	float& InOutMaxSpeed,
+	float& InOutAcceleration,
+	FVector& InOutMoveInput) const
+{
+	const FBotaniMoverAbilityStateInputs AbilityState = GetAbilityState(StartState);
+	InOutMaxSpeed *= AbilityState.MaxSpeedMultiplier;
+	InOutAcceleration *= AbilityState.AccelerationMultiplier;
+
+	// Zeroing the max speed would brake us in the air, so only take away the control
+	if (AbilityState.bCannotMove)
+	{
+		InOutMoveInput = FVector::ZeroVector;
+	}
+}
@@ -16,6 +16,8 @@
 #include "MoveLibrary/FloorQueryUtils.h"
 #include "MoveLibrary/GroundMovementUtils.h"
 #include "MoveLibrary/MovementUtils.h"
+#include "Misc/ScopeExit.h"
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMM_Falling)
@@ -26,7 +28,9 @@ UBotaniMM_Falling::UBotaniMM_Falling(const FObjectInitializer& ObjectInitializer
 	SharedSettingsClasses.Add(UBotaniMoverSettings::StaticClass());
 
 	bCancelVerticalSpeedOnLanding = false;
-	EffectiveVelocity = FVector::ZeroVector;
+
+	// Falls reach high speeds, so they split into up to 4 sub-steps of one capsule radius each
+	SubstepPolicy.MaxSubsteps = 4;
 
 	ModeTag = BotaniGameplayTags::Mover::Modes::TAG_MM_Falling;
 	GameplayTags.AddTag(Mover_IsInAir);
@@ -34,6 +38,14 @@ UBotaniMM_Falling::UBotaniMM_Falling(const FObjectInitializer& ObjectInitializer
 	GameplayTags.AddTag(Mover_SkipAnimRootMotion);
 }
 
+void UBotaniMM_Falling::Activate()
+{
+	Super::Activate();
+
+	// This is where we start falling
+	UBotaniMoverComponent::QueueTimerEdge(GetMoverComponent<UMoverComponent>(), EBotaniMoverTimer::LastFall);
+}
+
 void UBotaniMM_Falling::Deactivate()
 {
 	Super::Deactivate();
@@ -42,7 +54,6 @@ void UBotaniMM_Falling::Deactivate()
 	UMoverBlackboard* Blackboard = GetMoverComponent<UMoverComponent>()->GetSimBlackboard_Mutable();
 	if (IsValid(Blackboard))
 	{
-		Blackboard->Invalidate(BotaniMover::Blackboard::LastFallTime);
 		Blackboard->Invalidate(BotaniMover::Blackboard::LastGrappleTime);
 	}*/
 }
@@ -68,6 +79,9 @@ void UBotaniMM_Falling::GenerateMove_Implementation(
 	UBotaniMoverComponent* BotaniMover = Cast<UBotaniMoverComponent>(GetMoverComponent());
 	check(BotaniMover);
 
+	// Get the effective movement settings
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(BotaniMover, BotaniMovementSettings);
+
 	// If movement is disabled, do nothing
 	if (BotaniMover->IsMovementDisabled())
 	{
@@ -80,14 +94,9 @@ void UBotaniMM_Falling::GenerateMove_Implementation(
 	FVector UpDirection = BotaniMover->GetUpDirection();
 
 	// Get timings
-	const float DeltaSeconds = TimeStep.StepMs * 0.001f;
-	float LastFallTime = 0.f;
-	float TimeFalling = 1000.f;
-
-	if (Blackboard->TryGet(BotaniMover::Blackboard::LastFallTime, LastFallTime))
-	{
-		TimeFalling = (TimeStep.BaseSimTimeMs - LastFallTime) * 0.001f;
-	}
+	const float DeltaSeconds = SubstepPolicy.ComputeSubstepMs(StartState, TimeStep, BotaniMover) * BotaniMover::Lazy::MsToS;
+	const float TimeFalling = UBotaniMoverComponent::GetTimerElapsedMs(
+		BotaniMover, StartState.SyncState, EBotaniMoverTimer::LastFall, TimeStep.BaseSimTimeMs, 1000000) * 0.001f;
 
 	// We don't want velocity limits to take the falling velocity component into account, since it is handled
 	// separately by the terminal velocity of the environment.
@@ -162,7 +171,8 @@ void UBotaniMM_Falling::GenerateMove_Implementation(
 		Params.bUseAccelerationForVelocityMove = BotaniMovementSettings->bUseAccelerationForVelocityIntent;
 	}
 
-	// Apply the air control
+	// Apply the mirrored ability state, then the air control
+	ApplyAbilityState(StartState, Params.MaxSpeed, Params.Acceleration, Params.MoveInput);
 	Params.MoveInput *= AirControl;
 
 	if (!bGliding)
@@ -253,6 +263,10 @@ bool UBotaniMM_Falling::PrepareSimulationData(const FSimulationTickParams& Param
 void UBotaniMM_Falling::ApplyMovement(FMoverTickEndData& OutputState)
 {
 	UMoverComponent* MoverComponent = GetMoverComponent();
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(MoverComponent, BotaniMovementSettings);
+
+	// Hand the following sub-steps back to the state machine, whichever way we leave
+	ON_SCOPE_EXIT { OutputState.MovementEndState.RemainingMs += UnusedStepMs; };
 
 	// Initialize our fall data
 	FCommonMoveData FallData;
@@ -263,9 +277,13 @@ void UBotaniMM_Falling::ApplyMovement(FMoverTickEndData& OutputState)
 	// Cache the prior velocity
 	const FVector PriorFallingVelocity = StartingSyncState->GetVelocity_WorldSpace();
 
-	// Invalidate the previous floor
-	SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);
-	SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+	// Invalidate the previous floor.
+	// While we keep following a predicted arc nothing can have set a floor, so it's already invalid
+	if (!UBotaniMoverComponent::IsFollowingLandingPrediction(MoverComponent, SubstepStartSimTimeMs))
+	{
+		SimBlackboard->Invalidate(CommonBlackboard::LastFloorResult);
+		SimBlackboard->Invalidate(CommonBlackboard::LastFoundDynamicMovementBase);
+	}
 
 	// Calculate our new rotation
 	bool bOrientationChanged = CalculateOrientationChange(FallData.TargetOrientQuat);
@@ -273,12 +291,16 @@ void UBotaniMM_Falling::ApplyMovement(FMoverTickEndData& OutputState)
 	const FVector StartingFallingVelocity = StartingSyncState->GetVelocity_WorldSpace();
 	const FVector UpDirection = MoverComponent->GetUpDirection();
 
-	// Move
+	// Move, without a sweep if we follow the predicted arc or stay inside free space
+	const bool bSweep =
+		!UBotaniMoverComponent::CanFallWithoutSweep(MoverComponent, SubstepStartSimTimeMs, StartingFallingVelocity, ProposedMove->LinearVelocity, ProposedMove->DirectionIntent, DeltaTime)
+		&& !UBotaniMoverComponent::CanMoveWithoutSweep(MoverComponent, FallData.CurrentMoveDelta);
+	UBotaniMoverQueryBudgetSubsystem::RecordQueries(MoverComponent, EBotaniMoverQuery::Move, bSweep ? 1 : 0);
 	UMovementUtils::TrySafeMoveUpdatedComponent(
 		MovingComponentSet,
 		FallData.CurrentMoveDelta,
 		FallData.TargetOrientQuat,
-		true,
+		bSweep,
 		FallData.MoveHitResult,
 		ETeleportType::None,
 		FallData.MoveRecord);
@@ -324,14 +346,14 @@ void UBotaniMM_Falling::ApplyMovement(FMoverTickEndData& OutputState)
 			MovingComponentSet.UpdatedPrimitive->GetComponentLocation(),
 			FallData.MoveHitResult,
 			BotaniMovementSettings->FloorSweepDistance,
-			BotaniMovementSettings->MaxWalkSlopeAngleCosine.GetValue(),
+			GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
 			LandingFloor))
 		{
 			// Try to adjust our location so we don't get stuck in the floor
 			UGroundMovementUtils::TryMoveToAdjustHeightAboveFloor(
 				MoverComponent,
 				LandingFloor,
-				BotaniMovementSettings->MaxWalkSlopeAngleCosine.GetValue(),
+				GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
 				FallData.MoveRecord);
 
 			CaptureFinalState(LandingFloor, DeltaTime * FallData.PercentTimeAppliedSoFar, OutputState, FallData.MoveRecord);
@@ -356,7 +378,7 @@ void UBotaniMM_Falling::ApplyMovement(FMoverTickEndData& OutputState)
 			FallData.MoveHitResult,
 			true,
 			BotaniMovementSettings->FloorSweepDistance,
-			BotaniMovementSettings->MaxWalkSlopeAngleCosine.GetValue(),
+			GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
 			LandingFloor,
 			FallData.MoveRecord);
 
@@ -370,7 +392,7 @@ void UBotaniMM_Falling::ApplyMovement(FMoverTickEndData& OutputState)
 			UGroundMovementUtils::TryMoveToAdjustHeightAboveFloor(
 				MoverComponent,
 				LandingFloor,
-				BotaniMovementSettings->MaxWalkSlopeAngleCosine.GetValue(),
+				GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
 				FallData.MoveRecord);
 
 			// Capture the final state and handle landing
@@ -388,29 +410,6 @@ void UBotaniMM_Falling::ApplyMovement(FMoverTickEndData& OutputState)
 	CaptureFinalState(LandingFloor, DeltaTime * FallData.PercentTimeAppliedSoFar, OutputState, FallData.MoveRecord);
 }
 
-void UBotaniMM_Falling::PostMove(FMoverTickEndData& OutputState)
-{
-	Super::PostMove(OutputState);
-
-	// Get the timings
-	float LastFallTime = 0.f;
-	float LastJumpTime = 0.f;
-	float TimeFalling = 1000.f;
-
-	if (IsValid(SimBlackboard))
-	{
-		if (SimBlackboard->TryGet<float>(BotaniMover::Blackboard::LastFallTime, LastFallTime))
-		{
-			TimeFalling = CurrentSimulationTime - LastFallTime;
-		}
-
-		if (SimBlackboard->TryGet<float>(BotaniMover::Blackboard::LastJumpTime, LastJumpTime))
-		{
-
-		}
-	}
-}
-
 void UBotaniMM_Falling::CaptureFinalState(
 	const FFloorCheckResult& FloorResult,
 	float DeltaSecondsUsed,
@@ -419,9 +418,6 @@ void UBotaniMM_Falling::CaptureFinalState(
 {
 	const FVector FinalLocation = MovingComponentSet.UpdatedPrimitive->GetComponentLocation();
 
-	// Save the current time as the last fall time
-	SimBlackboard->Set<float>(BotaniMover::Blackboard::LastFallTime, CurrentSimulationTime);
-
 	// Check for refunds
 	// If we have this amount of time (or more) remaining, give it to the next simulation step.
 	constexpr float MinRemainingSecondsToRefund = 0.0001f;
@@ -438,7 +434,7 @@ void UBotaniMM_Falling::CaptureFinalState(
 
 	Record.SetDeltaSeconds(DeltaSecondsUsed);
 
-	EffectiveVelocity = Record.GetRelevantVelocity();
+	FVector EffectiveVelocity = Record.GetRelevantVelocity();
 	// TODO: Update Main/large movement record with substeps from our local record
 
 	FRelativeBaseInfo MovementBaseInfo;
@@ -3,14 +3,21 @@
 
 #include "Modes/BotaniMM_GroundBase.h"
 
-#include "AbilitySystemComponent.h"
-#include "AbilitySystemGlobals.h"
 #include "BotaniCommonMovementSettings.h"
-
+#include "BotaniMoverAbilityStateInputs.h"
+#include "BotaniMoverRestingState.h"
 #include "BotaniMoverSettings.h"
+#include "BotaniMoverStats.h"
 #include "CommonMoverComponent.h"
-#include "IBotaniMoverPhysicalMaterial.h"
+#include "Components/BotaniMoverComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "MoveLibrary/FloorQueryUtils.h"
 #include "MoveLibrary/GroundMovementUtils.h"
+#include "MoveLibrary/MovementUtils.h"
+#include "Misc/ScopeExit.h"
+#include "MoverDataModelTypes.h"
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
+#include "Subsystems/BotaniPhysicalMaterialSubsystem.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMM_GroundBase)
@@ -21,19 +28,26 @@ UBotaniMM_GroundBase::UBotaniMM_GroundBase(const FObjectInitializer& ObjectIniti
 	SharedSettingsClasses.Add(UBotaniMoverSettings::StaticClass());
 	SharedSettingsClasses.Add(UBotaniCommonMovementSettings::StaticClass());
 	GameplayTags.AddTag(Mover_IsOnGround);
+
+	// Ground moves are bounded by the max speed, so only sprints over a radius per tick get a second floor check
+	SubstepPolicy.MaxSubsteps = 2;
+	SubstepPolicy.MinMoveDistance = 0.01f;
 }
 
 void UBotaniMM_GroundBase::OnRegistered(const FName ModeName)
 {
 	Super::OnRegistered(ModeName);
 
+	// The owner's components may have changed since we were last registered
+	AbilityStateSource.Reset();
+
 	// Get the botani mover settings
-	BotaniMoverSettings = GetMoverComponent()->FindSharedSettings<UBotaniMoverSettings>();
+	BotaniMoverSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniMoverSettings>(GetMoverComponent());
 	ensureMsgf(BotaniMoverSettings, TEXT("Failed to find instance of BotaniMoverSettings on %s. Movement may not function properly."),
 		*GetPathNameSafe(this));
 
 	// Get the common movement settings
-	BotaniMovementSettings = GetMoverComponent()->FindSharedSettings<UBotaniCommonMovementSettings>();
+	BotaniMovementSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniCommonMovementSettings>(GetMoverComponent());
 	ensureMsgf(BotaniMovementSettings, TEXT("Failed to find instance of BotaniCommonMovementSettings on %s. Movement may not function properly."),
 		*GetPathNameSafe(this));
 }
@@ -46,11 +60,73 @@ void UBotaniMM_GroundBase::OnUnregistered()
 	// Release the common movement settings pointer
 	BotaniMovementSettings = nullptr;
 
+	AbilityStateSource.Reset();
+
 	Super::OnUnregistered();
 }
 
+void UBotaniMM_GroundBase::Deactivate()
+{
+	if (FBotaniMoverRestingState* RestingState = UBotaniMoverComponent::FindRestingState(GetMoverComponent()))
+	{
+		RestingState->Wake();
+	}
+
+	Super::Deactivate();
+}
+
+bool UBotaniMM_GroundBase::PrepareSimulationData(const FSimulationTickParams& Params)
+{
+	if (!Super::PrepareSimulationData(Params))
+	{
+		return false;
+	}
+
+	// Anything asking us to move wakes us up, otherwise we keep resting as long as nothing moved us
+	FBotaniMoverRestingState* RestingState = UBotaniMoverComponent::FindRestingState(GetMoverComponent());
+	bQuietThisTick = RestingState && IsQuiet(Params.StartState);
+	bRestingThisTick = bQuietThisTick && RestingState->IsRestingAt(MovingComponentSet.UpdatedComponent->GetComponentTransform());
+	if (RestingState && !bQuietThisTick)
+	{
+		RestingState->Wake();
+	}
+
+	// Only simulate the first sub-step, the refunded remainder makes the state machine run us again for the next one
+	const float SubstepMs = SubstepPolicy.ComputeSubstepMs(Params.StartState, Params.TimeStep, GetMoverComponent());
+	UnusedStepMs = Params.TimeStep.StepMs - SubstepMs;
+	DeltaMs = SubstepMs;
+	DeltaTime = SubstepMs * BotaniMover::Lazy::MsToS;
+
+	// A mode change out of this sub-step takes effect at its end
+	UBotaniMoverComponent::SetTimerEdgeSimTime(GetMoverComponent(), Params.TimeStep.BaseSimTimeMs + SubstepMs);
+
+	if (UnusedStepMs > 0.f)
+	{
+		INC_DWORD_STAT(STAT_BotaniMover_Substeps);
+	}
+
+	return true;
+}
+
 void UBotaniMM_GroundBase::ApplyMovement(FMoverTickEndData& OutputState)
 {
+	// Get the effective movement settings
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(GetMoverComponent(), BotaniMovementSettings);
+
+	// Resting on a static floor, nothing has changed since the last tick, so we keep the floor we rest on
+	FBotaniMoverRestingState* RestingState = UBotaniMoverComponent::FindRestingState(GetMoverComponent());
+	if (bRestingThisTick && RestingState)
+	{
+		FMovementRecord RestingRecord;
+		RestingRecord.SetDeltaSeconds(DeltaTime);
+
+		CurrentFloor = RestingState->GetFloor();
+		RestingState->RecordRestingTick();
+
+		CaptureFinalState(CurrentFloor, false, RestingRecord);
+		return;
+	}
+
 	// Ensure we have cached floor information before moving
 	ValidateFloor(
 		BotaniMovementSettings->FloorSweepDistance,
@@ -65,6 +141,9 @@ void UBotaniMM_GroundBase::ApplyMovement(FMoverTickEndData& OutputState)
 	// Initialize the move record
 	WalkData.MoveRecord.SetDeltaSeconds(DeltaTime);
 
+	// Hand the following sub-steps back to the state machine, whichever way we leave
+	ON_SCOPE_EXIT { OutputState.MovementEndState.RemainingMs += UnusedStepMs; };
+
 	// Apply any movement from a dynamic base
 	bool bDidMoveAlongWithBase = ApplyDynamicFloorMovement(OutputState, WalkData.MoveRecord);
 
@@ -90,105 +169,387 @@ void UBotaniMM_GroundBase::ApplyMovement(FMoverTickEndData& OutputState)
 		WalkData.TargetOrientQuat = FRotationMatrix::MakeFromZX(UpDirection, WalkData.TargetOrientQuat.GetForwardVector()).ToQuat();
 	}
 
-	// Floor check result passed to step-up suboperations, so we can use their final floor results if they did a test
-	FOptionalFloorCheckResult StepUpFloorResult;
-
-	// Are we moving or re-orienting?
-	if (!WalkData.CurrentMoveDelta.IsNearlyZero() ||bIsOrientationChanging)
+	// Are we moving or re-orienting? Negligible moves are merged into the idle path
+	if (!SubstepPolicy.IsNegligibleMove(WalkData.CurrentMoveDelta) || bIsOrientationChanging)
 	{
 		// We are about to move !
 		bDidAttemptMovement = true;
 
+		// Move, step and slide, then find the floor we've ended up on
+		const FBotaniGroundMoveSolveResult SolveResult = SolveGroundMove(WalkData);
+		INC_DWORD_STAT_BY(STAT_BotaniMover_GroundMoveSweeps, SolveResult.NumSweeps);
+		INC_DWORD_STAT(STAT_BotaniMover_GroundMoveSolves);
+		UBotaniMoverQueryBudgetSubsystem::RecordQueries(GetMoverComponent(), EBotaniMoverQuery::Move, SolveResult.NumSweeps);
+
+		// Check if we're falling
+		if (!SolveResult.bDepenetrated && HandleFalling(
+			OutputState,
+			WalkData.MoveRecord,
+			CurrentFloor.HitResult,
+			DeltaMs * WalkData.PercentTimeAppliedSoFar))
+		{
+			// Handle falling captured our output state, so we can return
+			return;
+		}
+	}
+	else
+	{
+		// We don't need to move this frame, but we may still need to adjust to the floor
+		// Search for the floor we're standing on
+		FindFloorCached(
+			BotaniMovementSettings->FloorSweepDistance,
+			GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
+			CurrentFloor);
+
+		// Copy the current floor hit result
+		WalkData.MoveHitResult = CurrentFloor.HitResult;
+
+		// Check if we need to adjust to depenetrate from the floor
+		bool bAdjustedToFloor = ApplyIdleCorrections(WalkData);
+
+		// Check if we're falling
+		if (HandleFalling(OutputState, WalkData.MoveRecord, CurrentFloor.HitResult, DeltaMs * WalkData.PercentTimeAppliedSoFar))
+		{
+			// Handle falling captured our output state, so we can return
+			return;
+		}
+
+		// Start resting once we stayed quiet on a static floor for a few ticks
+		if (RestingState)
+		{
+			if (bQuietThisTick && !bDidMoveAlongWithBase && !bAdjustedToFloor)
+			{
+				UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(GetMoverComponent());
+				BotaniMoverComp->AccumulateQuietTick(CurrentFloor);
+			}
+			else
+			{
+				RestingState->Wake();
+			}
+		}
+	}
+
+	// Capture the final movement state
+	CaptureFinalState(CurrentFloor, bDidAttemptMovement, WalkData.MoveRecord);
+}
+
+FBotaniGroundMoveSolveResult UBotaniMM_GroundBase::SolveGroundMove(FCommonMoveData& WalkData)
+{
+	// Get the effective movement settings
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(GetMoverComponent(), BotaniMovementSettings);
+
+	const float MaxWalkSlopeCosine = GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine);
+	FBotaniGroundMoveSolveResult Result;
+
+	// Static floors support the free space bubble, it rests on top of them
+	const UPrimitiveComponent* FloorComponent = CurrentFloor.HitResult.GetComponent();
+	const bool bStaticFloor = CurrentFloor.IsWalkableFloor() && FloorComponent && !FloorComponent->IsAnySimulatingPhysics() && FloorComponent->Mobility != EComponentMobility::Movable;
+
+	bool bMovedFreely = false;
+	if (UBotaniMoverComponent::CanMoveWithoutSweep(
+		GetMoverComponent(),
+		WalkData.CurrentMoveDelta,
+		bStaticFloor ? MutableMoverComponent->GetUpDirection() : FVector::ZeroVector,
+		bStaticFloor ? CurrentFloor.FloorDist : 0.f))
+	{
+		// Nothing to collide with in here, so the first move can't be blocked
+		UMovementUtils::TrySafeMoveUpdatedComponent(
+			MovingComponentSet,
+			WalkData.CurrentMoveDelta,
+			WalkData.TargetOrientQuat,
+			false,
+			WalkData.MoveHitResult,
+			ETeleportType::None,
+			WalkData.MoveRecord);
+
+		WalkData.PercentTimeAppliedSoFar = 1.f;
+		bMovedFreely = true;
+	}
+	else
+	{
 		// Apply the first move.
 		// This will catch any potential collisions or initial penetration
-		bool bMovedFreely = ApplyFirstMove(WalkData);
+		bMovedFreely = ApplyFirstMove(WalkData);
+		++Result.NumSweeps;
+	}
 
+	// Floor check result passed to step-up suboperations, so we can use their final floor results if they did a test
+	FOptionalFloorCheckResult StepUpFloorResult;
+
+	// Everything but the floor search only resolves a blocking hit of the first move
+	if (!bMovedFreely && WalkData.MoveHitResult.IsValidBlockingHit())
+	{
 		// Apply any depenetration in case we started in the frame stuck.
 		// This will include any catch-up from the first move
-		bool bDepenetration = ApplyDepenetrationOnFirstMove(WalkData);
+		if (WalkData.MoveHitResult.bStartPenetrating)
+		{
+			Result.bDepenetrated = ApplyDepenetrationOnFirstMove(WalkData);
+			++Result.NumSweeps;
 
-		if (!bDepenetration)
+			if (Result.bDepenetrated)
+			{
+				// Depenetrating is all we do this frame, the floor is validated again next tick
+				return Result;
+			}
+		}
+
+		// If we hit a walkable ramp, deflect the rest of the move onto it
+		if (ApplyRampMove(WalkData, MaxWalkSlopeCosine))
 		{
-			// If no depenetration was done, we can check for a ramp
-			bool bMovedUpRamp = ApplyRampMove(
-				WalkData,
-				GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine));
+			++Result.NumSweeps;
+		}
 
+		// Only a move that is still blocked can step up or slide
+		if (WalkData.MoveHitResult.IsValidBlockingHit())
+		{
 			// Attempt to move up any climbable obstacles
-			bool bSteppedUp = ApplyStepUpMove(
+			Result.bSteppedUp = TryStepUp(
 				WalkData,
 				StepUpFloorResult,
-				GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
-				GetBotaniMoverFloatProp(MaxStepHeight), BotaniMovementSettings->FloorSweepDistance);
+				MaxWalkSlopeCosine,
+				GetBotaniMoverFloatProp(MaxStepHeight), BotaniMovementSettings->FloorSweepDistance,
+				Result.NumSweeps);
 
 			// Did we fail to step up?
-			bool bSlidAlongWall = false;
-			if (bSteppedUp)
+			if (!Result.bSteppedUp)
 			{
 				// Attempt to slide along an unclimbable obstacle
-				bSlidAlongWall = ApplySlideAlongWall(
+				ApplySlideAlongWall(
 					WalkData,
-					GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
+					MaxWalkSlopeCosine,
 					GetBotaniMoverFloatProp(MaxStepHeight));
+				++Result.NumSweeps;
 			}
+		}
+	}
 
-			// Search for the floor we've ended up on
-			UFloorQueryUtils::FindFloor(
-				MovingComponentSet,
+	// The step up already tested the floor from where we are now, so only search it if we have to
+	if (Result.bSteppedUp && StepUpFloorResult.bHasFloorResult)
+	{
+		CurrentFloor = StepUpFloorResult.FloorTestResult;
+		Result.bReusedStepUpFloor = true;
+
+		if (FBotaniMoverQueryCache* QueryCache = UBotaniMoverComponent::FindQueryCache(GetMoverComponent()))
+		{
+			QueryCache->StoreFloor(
+				MovingComponentSet.UpdatedComponent->GetComponentTransform(),
 				BotaniMovementSettings->FloorSweepDistance,
-				GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
-				MovingComponentSet.UpdatedPrimitive->GetComponentLocation(),
+				MaxWalkSlopeCosine,
 				CurrentFloor);
-
-			// Adjust vertically so we remain in contact with the floor
-			bool bAdjustedToFloor = ApplyFloorHeightAdjustment(
-				WalkData,
-				GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine));
-
-			// Check if we're falling
-			if (HandleFalling(
-				OutputState,
-				WalkData.MoveRecord,
-				CurrentFloor.HitResult,
-				DeltaMs * WalkData.PercentTimeAppliedSoFar))
-			{
-				// Handle falling captured our output state, so we can return
-				return;
-			}
 		}
 	}
-	else
+	else if (FindFloorCached(BotaniMovementSettings->FloorSweepDistance, MaxWalkSlopeCosine, CurrentFloor))
 	{
-		// We don't need to move this frame, but we may still need to adjust to the floor
-		// Search for the floor we're standing on
-		UFloorQueryUtils::FindFloor(
-			MovingComponentSet,
-			BotaniMovementSettings->FloorSweepDistance,
-			GetBotaniMoverFloatProp(MaxWalkSlopeAngleCosine),
-			MovingComponentSet.UpdatedPrimitive->GetComponentLocation(),
-			CurrentFloor);
+		++Result.NumSweeps;
+	}
 
-		// Copy the current floor hit result
-		WalkData.MoveHitResult = CurrentFloor.HitResult;
+	// Adjust vertically so we remain in contact with the floor
+	if (CurrentFloor.IsWalkableFloor() && ApplyFloorHeightAdjustment(WalkData, MaxWalkSlopeCosine))
+	{
+		++Result.NumSweeps;
+	}
 
-		// Check if we need to adjust to depenetrate from the floor
-		bool bAdjustedToFloor = ApplyIdleCorrections(WalkData);
+	return Result;
+}
 
-		// Check if we're falling
-		if (HandleFalling(OutputState, WalkData.MoveRecord, CurrentFloor.HitResult, DeltaMs * WalkData.PercentTimeAppliedSoFar))
-		{
-			// Handle falling captured our output state, so we can return
-			return;
-		}
+bool UBotaniMM_GroundBase::IsQuiet(const FMoverTickStartData& StartState) const
+{
+	// Layered moves are how jumps, launches and other movement effects get into the simulation
+	if (StartState.SyncState.LayeredMoves.HasAnyMoves())
+	{
+		return false;
 	}
 
-	// Capture the final movement state
-	CaptureFinalState(CurrentFloor, bDidAttemptMovement, WalkData.MoveRecord);
+	const FMoverDefaultSyncState* StartSyncState = StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
+	if (!StartSyncState || !StartSyncState->GetVelocity_WorldSpace().IsNearlyZero())
+	{
+		return false;
+	}
+
+	const FCharacterDefaultInputs* MoveKinematicInputs = StartState.InputCmd.InputCollection.FindDataByType<FCharacterDefaultInputs>();
+	if (!MoveKinematicInputs)
+	{
+		return true;
+	}
+
+	if (!MoveKinematicInputs->GetMoveInput().IsNearlyZero() || MoveKinematicInputs->bIsJumpJustPressed || MoveKinematicInputs->bIsJumpPressed)
+	{
+		return false;
+	}
+
+	// An orientation intent only counts as input if it would turn us
+	if (MoveKinematicInputs->OrientationIntent.IsNearlyZero())
+	{
+		return true;
+	}
+
+	const FRotator IntendedOrientation = UMovementUtils::ApplyGravityToOrientationIntent(
+		MoveKinematicInputs->GetOrientationIntentDir_WorldSpace().ToOrientationRotator(),
+		GetMoverComponent()->GetWorldToGravityTransform(),
+		BotaniMovementSettings->bShouldRemainUpright);
+
+	return IntendedOrientation.Equals(StartSyncState->GetOrientation_WorldSpace());
+}
+
+bool UBotaniMM_GroundBase::CanKeepResting(const FMoverTickStartData& StartState) const
+{
+	const UMoverComponent* MoverComp = GetMoverComponent();
+	const FBotaniMoverRestingState* RestingState = UBotaniMoverComponent::FindRestingState(MoverComp);
+	const USceneComponent* UpdatedComponent = MoverComp->GetUpdatedComponent();
+
+	return RestingState
+		&& UpdatedComponent
+		&& RestingState->IsRestingAt(UpdatedComponent->GetComponentTransform())
+		&& IsQuiet(StartState);
 }
 
 void UBotaniMM_GroundBase::ValidateFloor(float FloorSweepDistance, float MaxWalkableSlopeCosine)
 {
+	// Reuse the floor if it was already found from this transform during this frame
+	FBotaniMoverQueryCache* QueryCache = UBotaniMoverComponent::FindQueryCache(GetMoverComponent());
+	const FTransform& ComponentTransform = MovingComponentSet.UpdatedComponent->GetComponentTransform();
+	if (QueryCache && QueryCache->TryGetFloor(ComponentTransform, FloorSweepDistance, MaxWalkableSlopeCosine, CurrentFloor))
+	{
+		return;
+	}
+
 	Super::ValidateFloor(FloorSweepDistance, MaxWalkableSlopeCosine);
+	UBotaniMoverQueryBudgetSubsystem::RecordQueries(GetMoverComponent(), EBotaniMoverQuery::Floor);
+
+	if (QueryCache)
+	{
+		QueryCache->StoreFloor(ComponentTransform, FloorSweepDistance, MaxWalkableSlopeCosine, CurrentFloor);
+	}
+}
+
+bool UBotaniMM_GroundBase::FindFloorCached(
+	const float FloorSweepDistance,
+	const float MaxWalkableSlopeCosine,
+	FFloorCheckResult& OutFloor) const
+{
+	FBotaniMoverQueryCache* QueryCache = UBotaniMoverComponent::FindQueryCache(GetMoverComponent());
+	const FTransform& ComponentTransform = MovingComponentSet.UpdatedComponent->GetComponentTransform();
+	if (QueryCache && QueryCache->TryGetFloor(ComponentTransform, FloorSweepDistance, MaxWalkableSlopeCosine, OutFloor))
+	{
+		return false;
+	}
+
+	UFloorQueryUtils::FindFloor(
+		MovingComponentSet,
+		FloorSweepDistance,
+		MaxWalkableSlopeCosine,
+		MovingComponentSet.UpdatedPrimitive->GetComponentLocation(),
+		OutFloor);
+	UBotaniMoverQueryBudgetSubsystem::RecordQueries(GetMoverComponent(), EBotaniMoverQuery::Floor);
+
+	if (QueryCache)
+	{
+		QueryCache->StoreFloor(ComponentTransform, FloorSweepDistance, MaxWalkableSlopeCosine, OutFloor);
+	}
+
+	return true;
+}
+
+bool UBotaniMM_GroundBase::TryStepUp(
+	FCommonMoveData& WalkData,
+	FOptionalFloorCheckResult& OutStepUpFloor,
+	const float MaxWalkSlopeCosine,
+	const float MaxStepHeight,
+	const float FloorSweepDistance,
+	int32& InOutNumSweeps)
+{
+	USceneComponent* UpdatedComponent = MovingComponentSet.UpdatedComponent.Get();
+	const UPrimitiveComponent* UpdatedPrimitive = MovingComponentSet.UpdatedPrimitive.Get();
+	const FHitResult BlockingHit = WalkData.MoveHitResult;
+	if (!UpdatedComponent || !UpdatedPrimitive || MaxStepHeight <= 0.f || !BlockingHit.IsValidBlockingHit())
+	{
+		return false;
+	}
+
+	// Some components opt out of being stepped on
+	const UPrimitiveComponent* HitComponent = BlockingHit.GetComponent();
+	if (HitComponent && HitComponent->CanCharacterStepUpOn == ECB_No)
+	{
+		return false;
+	}
+
+	// Anything hit above the step height is too high to step onto
+	const FVector UpDirection = MutableMoverComponent->GetUpDirection();
+	const FVector StartLocation = UpdatedComponent->GetComponentLocation();
+	const float FeetHeight = (StartLocation | UpDirection) - UpdatedPrimitive->GetCollisionShape().GetExtent().Z;
+	if ((BlockingHit.ImpactPoint | UpDirection) - FeetHeight > MaxStepHeight)
+	{
+		return false;
+	}
+
+	FScopedMovementUpdate ScopedStepUp(UpdatedComponent, EScopedUpdate::DeferredUpdates);
+	const FQuat Rotation = UpdatedComponent->GetComponentQuat();
+
+	// Up
+	FHitResult UpHit(1.f);
+	UMovementUtils::TrySafeMoveUpdatedComponent(MovingComponentSet, UpDirection * MaxStepHeight, Rotation, true, UpHit, ETeleportType::None, WalkData.MoveRecord);
+	++InOutNumSweeps;
+
+	if (UpHit.bStartPenetrating)
+	{
+		ScopedStepUp.RevertMove();
+		return false;
+	}
+
+	// Forward, by what is left of the move
+	const FVector ForwardDelta = WalkData.CurrentMoveDelta * (1.f - BlockingHit.Time);
+	FHitResult ForwardHit(1.f);
+	UMovementUtils::TrySafeMoveUpdatedComponent(MovingComponentSet, ForwardDelta, Rotation, true, ForwardHit, ETeleportType::None, WalkData.MoveRecord);
+	++InOutNumSweeps;
+
+	if (ForwardHit.bStartPenetrating || (ForwardHit.bBlockingHit && ForwardHit.Time <= 0.f))
+	{
+		ScopedStepUp.RevertMove();
+		return false;
+	}
+
+	// Down, far enough to reach the floor on top of the step
+	FHitResult DownHit(1.f);
+	UMovementUtils::TrySafeMoveUpdatedComponent(MovingComponentSet, -UpDirection * (MaxStepHeight + FloorSweepDistance), Rotation, true, DownHit, ETeleportType::None, WalkData.MoveRecord);
+	++InOutNumSweeps;
+
+	if (DownHit.bStartPenetrating)
+	{
+		ScopedStepUp.RevertMove();
+		return false;
+	}
+
+	if (DownHit.IsValidBlockingHit())
+	{
+		// The step turned out to be higher than we can step
+		if ((DownHit.ImpactPoint | UpDirection) - FeetHeight > MaxStepHeight)
+		{
+			ScopedStepUp.RevertMove();
+			return false;
+		}
+
+		// Don't end up on an unwalkable surface above where we started
+		const bool bWalkable = (DownHit.ImpactNormal | UpDirection) >= MaxWalkSlopeCosine;
+		if (!bWalkable && ((DownHit.Location - StartLocation) | UpDirection) > UE_KINDA_SMALL_NUMBER)
+		{
+			ScopedStepUp.RevertMove();
+			return false;
+		}
+
+		// Test the floor from here, so the solve doesn't have to search it again
+		UFloorQueryUtils::FindFloor(
+			MovingComponentSet,
+			FloorSweepDistance,
+			MaxWalkSlopeCosine,
+			UpdatedComponent->GetComponentLocation(),
+			OutStepUpFloor.FloorTestResult);
+		OutStepUpFloor.bHasFloorResult = true;
+		++InOutNumSweeps;
+	}
+
+	WalkData.PercentTimeAppliedSoFar = 1.f;
+	WalkData.MoveHitResult = ForwardHit;
+	return true;
 }
 
 void UBotaniMM_GroundBase::ApplyPhysicalGroundFriction(
@@ -196,12 +557,11 @@ void UBotaniMM_GroundBase::ApplyPhysicalGroundFriction(
 	const FFloorCheckResult& FloorToUse,
 	const bool bOverrideFriction) const
 {
-	if (const IBotaniMoverPhysicalMaterial* MoverPhysMat
-		= Cast<IBotaniMoverPhysicalMaterial>(FloorToUse.HitResult.PhysMaterial.Get()))
+	// The material properties are static, so they are looked up from the precomputed table
+	if (const FBotaniPhysicalMaterialMovementProperties* MaterialProperties
+		= UBotaniPhysicalMaterialSubsystem::FindMovementProperties(FloorToUse.HitResult.PhysMaterial.Get()))
 	{
-		MoveParams.Friction = MoverPhysMat->CalculateFrictionCoefficient(MoveParams.Friction);
-		MoveParams.Acceleration = MoverPhysMat->GetAccelerationOverride().Get(MoveParams.Acceleration);
-		MoveParams.Deceleration = MoverPhysMat->GetDecelerationOverride().Get(MoveParams.Deceleration);
+		MaterialProperties->Apply(MoveParams.Friction, MoveParams.Acceleration, MoveParams.Deceleration);
 	}
 }
 
@@ -209,34 +569,26 @@ float UBotaniMM_GroundBase::GetEffectiveMaxSpeed(
 	const float& InMaxSpeed,
 	const FMoverTickStartData& StartState) const
 {
-	if (const UAbilitySystemComponent* AbilitySystem = GetAbilitySystemComponent())
+	const FBotaniMoverAbilityStateInputs AbilityState = GetAbilityState(StartState);
+
+	// If the stop movement tag is active, we can't move
+	if (AbilityState.bCannotMove)
 	{
-		// If the stop movement tag is active, we can't move
-		if (AbilitySystem->HasMatchingGameplayTag(BotaniMoverSettings->StopMovementTag))
-		{
-			return 0.f;
-		}
+		return 0.f;
 	}
 
-	// Otherwise, return the input max speed
-	return InMaxSpeed;
+	return InMaxSpeed * AbilityState.MaxSpeedMultiplier;
 }
 
-UAbilitySystemComponent* UBotaniMM_GroundBase::GetAbilitySystemComponent() const
+float UBotaniMM_GroundBase::GetEffectiveAcceleration(
+	const float& InAcceleration,
+	const FMoverTickStartData& StartState) const
 {
-	UBotaniMM_GroundBase* MutableThis = const_cast<UBotaniMM_GroundBase*>(this);
-	if (!MutableThis->AbilitySystemComponent.IsValid() && GetMoverComponent())
-	{
-		if (const AActor* Owner = GetMoverComponent()->GetOwner())
-		{
-			if (UAbilitySystemComponent* AbilitySystem =
-				UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Owner))
-			{
-
-				MutableThis->AbilitySystemComponent = AbilitySystem;
-			}
-		}
-	}
+	return InAcceleration * GetAbilityState(StartState).AccelerationMultiplier;
+}
 
-	return MutableThis->AbilitySystemComponent.Get();
+FBotaniMoverAbilityStateInputs UBotaniMM_GroundBase::GetAbilityState(const FMoverTickStartData& StartState) const
+{
+	return AbilityStateSource.Resolve(GetMoverComponent(), StartState.InputCmd,
+		BotaniMoverSettings ? BotaniMoverSettings->StopMovementTag : FGameplayTag());
 }
@@ -35,7 +35,6 @@ void UBotaniMM_Walking::GenerateMove_Implementation(
 	// Get the inputs
 	const FCharacterDefaultInputs* MoveKinematicInputs = StartState.InputCmd.InputCollection.FindDataByType<FCharacterDefaultInputs>();
 	const FBotaniMoverInputs* BotaniInputs = StartState.InputCmd.InputCollection.FindDataByType<FBotaniMoverInputs>();
-	const FBotaniMoverAbilityInputs* BotaniAbilityInputs = StartState.InputCmd.InputCollection.FindDataByType<FBotaniMoverAbilityInputs>();
 
 	// Get the sync states
 	const FMoverDefaultSyncState* StartSyncState = StartState.SyncState.SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
@@ -49,11 +48,21 @@ void UBotaniMM_Walking::GenerateMove_Implementation(
 	UBotaniMoverComponent* BotaniMover = Cast<UBotaniMoverComponent>(GetMoverComponent());
 	check(BotaniMover);
 
+	// A resting pawn has nothing to move, so the ground move params don't need to be built
+	if (CanKeepResting(StartState))
+	{
+		OutProposedMove = FProposedMove();
+		return;
+	}
+
+	// Get the effective movement settings
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(BotaniMover, BotaniMovementSettings);
+
 	// D: what is up ??
 	FVector UpDirection = BotaniMover->GetUpDirection();
 
 	// Get timings
-	const float DeltaSeconds = TimeStep.StepMs * BotaniMover::Lazy::MsToS;
+	const float DeltaSeconds = SubstepPolicy.ComputeSubstepMs(StartState, TimeStep, BotaniMover) * BotaniMover::Lazy::MsToS;
 
 	// Start filling up our move params
 	FFloorCheckResult LastFloorResult;
@@ -126,7 +135,7 @@ void UBotaniMM_Walking::GenerateMove_Implementation(
 	Params.UpDirection = UpDirection;
 	Params.bUseAccelerationForVelocityMove = BotaniMovementSettings->bUseAccelerationForVelocityIntent;
 
-	const bool bSprinting = BotaniAbilityInputs && BotaniAbilityInputs->bIsSprintPressed;
+	const bool bSprinting = IsSprintRequested(StartState.InputCmd);
 
 	// Decide whether to use walk or sprinting params
 	if (bSprinting)
@@ -135,7 +144,7 @@ void UBotaniMM_Walking::GenerateMove_Implementation(
 		Params.TurningRate = GetBotaniMoverFloatProp(SprintTurningRate);
 		Params.TurningBoost = GetBotaniMoverFloatProp(SprintTurningBoost);
 		Params.MaxSpeed = GetEffectiveMaxSpeed(GetBotaniMoverFloatProp(MaxSprintSpeed) * SlopeBoost, StartState);
-		Params.Acceleration = GetBotaniMoverFloatProp(SprintAcceleration) * SlopeBoost;
+		Params.Acceleration = GetEffectiveAcceleration(GetBotaniMoverFloatProp(SprintAcceleration) * SlopeBoost, StartState);
 		Params.Deceleration = GetBotaniMoverFloatProp(SprintDeceleration);
 	}
 	else
@@ -144,7 +153,7 @@ void UBotaniMM_Walking::GenerateMove_Implementation(
 		Params.TurningRate = GetBotaniMoverFloatProp(TurningRate);
 		Params.TurningBoost = GetBotaniMoverFloatProp(TurningBoost);
 		Params.MaxSpeed = GetEffectiveMaxSpeed(GetBotaniMoverFloatProp(MaxSpeed) * SlopeBoost, StartState);
-		Params.Acceleration = GetBotaniMoverFloatProp(Acceleration) * SlopeBoost;
+		Params.Acceleration = GetEffectiveAcceleration(GetBotaniMoverFloatProp(Acceleration) * SlopeBoost, StartState);
 		Params.Deceleration = GetBotaniMoverFloatProp(Deceleration);
 	}
 
@@ -171,15 +180,35 @@ void UBotaniMM_Walking::GenerateMove_Implementation(
 	OutProposedMove = UGroundMovementUtils::ComputeControlledGroundMove(Params);
 }
 
+bool UBotaniMM_Walking::PrepareSimulationData(const FSimulationTickParams& Params)
+{
+	if (!Super::PrepareSimulationData(Params))
+	{
+		return false;
+	}
+
+	bSprintingThisTick = IsSprintRequested(Params.StartState.InputCmd);
+	return true;
+}
+
+bool UBotaniMM_Walking::IsSprintRequested(const FMoverInputCmdContext& InputCmd)
+{
+	const FBotaniMoverAbilityInputs* BotaniAbilityInputs = InputCmd.InputCollection.FindDataByType<FBotaniMoverAbilityInputs>();
+	return BotaniAbilityInputs && BotaniAbilityInputs->bIsSprintPressed;
+}
+
 void UBotaniMM_Walking::PostMove(FMoverTickEndData& OutputState)
 {
 	Super::PostMove(OutputState);
 
 	// Add the sprinting tag if necessary
-	OutTagsSyncState->AddTag(SprintingTag);
+	if (bSprintingThisTick)
+	{
+		OutTagsSyncState->AddTag(SprintingTag);
+	}
 
 	// Have we started sprinting?
-	if (OutTagsSyncState->HasTagExact(SprintingTag)
+	if (bSprintingThisTick
 		&& !TagsSyncState->HasTagExact(SprintingTag))
 	{
 		// Send the sprinting event
@@ -192,7 +221,7 @@ void UBotaniMM_Walking::PostMove(FMoverTickEndData& OutputState)
 		}
 	}
 	// Are we done sprinting?
-	else if (!OutTagsSyncState->HasTagExact(SprintingTag) &&
+	else if (!bSprintingThisTick &&
 		TagsSyncState->HasTagExact(SprintingTag))
 	{
 		// Send the sprinting end event
@@ -9,11 +9,14 @@
 #include "BotaniMoverSettings.h"
 #include "BotaniMoverVLogHelpers.h"
 #include "BotaniWallRunMovementSettings.h"
-#include "IBotaniMoverPhysicalMaterial.h"
 #include "MoverComponent.h"
 #include "Components/BotaniMoverComponent.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "Misc/ScopeExit.h"
+#include "MoveLibrary/AirMovementUtils.h"
 #include "MoveLibrary/MovementUtils.h"
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
+#include "Subsystems/BotaniPhysicalMaterialSubsystem.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMM_WallRunning)
@@ -26,12 +29,40 @@ UBotaniMM_WallRunning::UBotaniMM_WallRunning(const FObjectInitializer& ObjectIni
 	ModeTag = BotaniGameplayTags::Mover::Modes::TAG_MM_WallRunning;
 	GameplayTags.AddTag(Mover_IsOnGround);
 
-	EffectiveVelocity = FVector::ZeroVector;
+	// Wall runs are fast, but the wall keeps them from covering much more than a radius per tick
+	SubstepPolicy.MaxSubsteps = 3;
+}
+
+void UBotaniMM_WallRunning::OnRegistered(const FName ModeName)
+{
+	Super::OnRegistered(ModeName);
+
+	// Get the wall run settings
+	BotaniWallRunSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniWallRunMovementSettings>(GetMoverComponent());
+	ensureMsgf(BotaniWallRunSettings, TEXT("Failed to find instance of BotaniWallRunMovementSettings on %s. Movement may not function properly."),
+		*GetPathNameSafe(this));
+}
+
+void UBotaniMM_WallRunning::OnUnregistered()
+{
+	// Release the wall run settings pointer
+	BotaniWallRunSettings = nullptr;
+
+	Super::OnUnregistered();
 }
 
 void UBotaniMM_WallRunning::Deactivate()
 {
 	Super::Deactivate();
+
+	// This is where the wall run cooldown starts
+	UBotaniMoverComponent::QueueTimerEdge(GetMoverComponent<UMoverComponent>(), EBotaniMoverTimer::LastWallRun);
+
+	// The next wall run captures its own wall plane
+	if (UMoverBlackboard* Blackboard = GetMoverComponent<UMoverComponent>()->GetSimBlackboard_Mutable())
+	{
+		Blackboard->Invalidate(BotaniMover::Blackboard::LastWallPlane);
+	}
 }
 
 bool UBotaniMM_WallRunning::PrepareSimulationData(const FSimulationTickParams& Params)
@@ -41,15 +72,6 @@ bool UBotaniMM_WallRunning::PrepareSimulationData(const FSimulationTickParams& P
 		return false;
 	}
 
-	// Get the time
-	float LastWallTime = 0.f;
-	float TimeSinceLastWallJump = 1000.f;
-
-	if (SimBlackboard->TryGet<float>(BotaniMover::Blackboard::LastWallRunTime, LastWallTime))
-	{
-
-	}
-
 	return true;
 }
 
@@ -74,8 +96,10 @@ void UBotaniMM_WallRunning::GenerateMove_Implementation(
 	UBotaniMoverComponent* BotaniMover = Cast<UBotaniMoverComponent>(GetMoverComponent());
 	check(BotaniMover);
 
-	// Get the wall running settings
-	const UBotaniWallRunMovementSettings* BotaniWallRunSettings = BotaniMover->FindSharedSettings<UBotaniWallRunMovementSettings>();
+	// Get the effective movement settings
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(BotaniMover, BotaniMovementSettings);
+
+	// The wall running settings are cached on registration
 	check(BotaniWallRunSettings);
 
 	// If movement is disabled, do nothing
@@ -90,14 +114,9 @@ void UBotaniMM_WallRunning::GenerateMove_Implementation(
 	FVector UpDirection = BotaniMover->GetUpDirection();
 
 	// Get timings
-	const float DeltaSeconds = TimeStep.StepMs * BotaniMover::Lazy::MsToS;
-	float LastWallTime = 0.f;
-	float TimeWallRunning = 1000.f;
-
-	if (Blackboard->TryGet<float>(BotaniMover::Blackboard::LastWallRunTime, LastWallTime))
-	{
-		TimeWallRunning = (TimeStep.BaseSimTimeMs - LastWallTime) * BotaniMover::Lazy::MsToS;
-	}
+	const float DeltaSeconds = SubstepPolicy.ComputeSubstepMs(StartState, TimeStep, BotaniMover) * BotaniMover::Lazy::MsToS;
+	const float TimeWallRunning = UBotaniMoverComponent::GetTimerElapsedMs(
+		BotaniMover, StartState.SyncState, EBotaniMoverTimer::LastWallRunStart, TimeStep.BaseSimTimeMs, 0) * BotaniMover::Lazy::MsToS;
 
 	// We don't want velocity limits to take the falling velocity component into account, since it is handled
 	// separately by the terminal velocity of the environment.
@@ -112,7 +131,7 @@ void UBotaniMM_WallRunning::GenerateMove_Implementation(
 	if (Blackboard->TryGet<FWallCheckResult>(BotaniMover::Blackboard::LastWallResult, LastWallResult)
 		&& LastWallResult.IsRunAbleWall())
 	{
-		WallNormal = LastWallResult.GetHitResult().ImpactNormal;
+		WallNormal = LastWallResult.GetContact().GetNormal();
 	}
 	else
 	{
@@ -177,6 +196,7 @@ void UBotaniMM_WallRunning::GenerateMove_Implementation(
 	Params.Acceleration = GetBotaniWallRunFloatProp(WallRun_Acceleration);
 	Params.MaxSpeed = GetBotaniWallRunFloatProp(WallRun_MaxSpeed);
 	Params.bUseAccelerationForVelocityMove = BotaniMovementSettings->bUseAccelerationForVelocityIntent;
+	ApplyAbilityState(StartState, Params.MaxSpeed, Params.Acceleration, Params.MoveInput);
 
 	// Apply the acceleration based on the friction
 	const bool bIsMovingTooFast = Params.MoveInput.SizeSquared() <= 0.f
@@ -218,33 +238,15 @@ void UBotaniMM_WallRunning::GenerateMove_Implementation(
 		?	GetBotaniWallRunFloatProp(WallRun_UpwardsGravityScale)
 		:	GetBotaniWallRunFloatProp(WallRun_GravityScale);
 
-	{ // Apply the gravity scale based on the players' velocity
-		float GravityScale = 0.f;
-		const FRichCurve* GravityVelScaleCurve = BotaniWallRunSettings->WallRun_GravityVelScaleCurve.GetRichCurveConst();
-		if (GravityVelScaleCurve && GravityVelScaleCurve->HasAnyData())
-		{
-			GravityScale = GravityVelScaleCurve->Eval(bIsVelocityUpwards ? 0.f : TangentAccel);
-		}
+	// Apply the gravity scale based on the players' velocity and how long we have been wall running, in a single pass
+	const float GravityScale = UWallRunningMovementUtils::ComputeWallRunGravityScale(
+		BotaniWallRunSettings,
+		bIsVelocityUpwards ? 0.f : TangentAccel,
+		TimeWallRunning);
 
-		DeltaVelocity += UMovementUtils::ComputeVelocityFromGravity(
-				BotaniMover->GetGravityAcceleration() * GravityScale * OverallGravityScale,
-				DeltaSeconds);
-	}
-
-	{ // Apply the gravity scale based on how long we have been wall running
-		float GravityScale = 0.f;
-		const FRichCurve* GravityScaleCurve = BotaniWallRunSettings->WallRun_GravityTimeScaleCurve.GetRichCurveConst();
-		if (GravityScaleCurve && GravityScaleCurve->HasAnyData())
-		{
-			GravityScale *= GravityScaleCurve->Eval(TimeWallRunning);
-		}
-
-		DeltaVelocity += UMovementUtils::ComputeVelocityFromGravity(
-				BotaniMover->GetGravityAcceleration() * GravityScale * OverallGravityScale,
-				DeltaSeconds);
-	}
-
-	UE_LOG(LogBotaniMover, Display, TEXT("Delta Vel: %s"), *DeltaVelocity.ToString());
+	DeltaVelocity += UMovementUtils::ComputeVelocityFromGravity(
+		BotaniMover->GetGravityAcceleration() * GravityScale * OverallGravityScale,
+		DeltaSeconds);
 
 	//@TODO: Terminal speed ?
 	if (false)
@@ -265,12 +267,11 @@ void UBotaniMM_WallRunning::ApplyPhysicalWallFriction(
 	const FWallCheckResult& FloorToUse,
 	const bool bOverrideFriction) const
 {
-	if (const IBotaniMoverPhysicalMaterial* MoverPhysMat
-		= Cast<IBotaniMoverPhysicalMaterial>(FloorToUse.GetHitResult().PhysMaterial.Get()))
+	// The material properties are static, so they are looked up from the precomputed table
+	if (const FBotaniPhysicalMaterialMovementProperties* MaterialProperties
+		= UBotaniPhysicalMaterialSubsystem::FindMovementProperties(FloorToUse.GetContact().GetPhysMaterial()))
 	{
-		MoveParams.Friction = MoverPhysMat->CalculateFrictionCoefficient(MoveParams.Friction);
-		MoveParams.Acceleration = MoverPhysMat->GetAccelerationOverride().Get(MoveParams.Acceleration);
-		MoveParams.Deceleration = MoverPhysMat->GetDecelerationOverride().Get(MoveParams.Deceleration);
+		MaterialProperties->Apply(MoveParams.Friction, MoveParams.Acceleration, MoveParams.Deceleration);
 	}
 }
 
@@ -283,10 +284,12 @@ void UBotaniMM_WallRunning::ApplyMovement(FMoverTickEndData& OutputState)
 	// What is up ??
 	const FVector UpDirection = MoverComponent->GetUpDirection();
 
-	// Get the settings
-	const UBotaniWallRunMovementSettings* BotaniWallRunSettings = MoverComponent->FindSharedSettings<UBotaniWallRunMovementSettings>();
+	// The wall running settings are cached on registration
 	check(BotaniWallRunSettings);
 
+	// Hand the following sub-steps back to the state machine, whichever way we leave
+	ON_SCOPE_EXIT { OutputState.MovementEndState.RemainingMs += UnusedStepMs; };
+
 	// Initialize our wall running data
 	FCommonMoveData WallRunData;
 	WallRunData.MoveRecord.SetDeltaSeconds(DeltaTime);
@@ -301,8 +304,9 @@ void UBotaniMM_WallRunning::ApplyMovement(FMoverTickEndData& OutputState)
 		ensure(false);
 	}
 
+	const FWallContact& WallContact = CurrentWall.GetContact();
 	const FVector WallTangent = FVector::VectorPlaneProject(
-		CurrentWall.GetHitResult().ImpactNormal,
+		WallContact.GetNormal(),
 		UpDirection).GetSafeNormal();
 
 	//@TODO: Maybe make sure the target orient quat is only along the up direction?
@@ -327,8 +331,8 @@ void UBotaniMM_WallRunning::ApplyMovement(FMoverTickEndData& OutputState)
 			10.f);
 
 		UKismetSystemLibrary::DrawDebugArrow(this,
-				CurrentWall.GetHitResult().Location,
-				CurrentWall.GetHitResult().Location + CurrentWall.GetHitResult().Normal * 100.f,
+				WallContact.GetImpactPoint(),
+				WallContact.GetImpactPoint() + WallContact.GetNormal() * 100.f,
 				2.f,
 				FLinearColor::Green,
 				10.f);
@@ -348,37 +352,91 @@ void UBotaniMM_WallRunning::ApplyMovement(FMoverTickEndData& OutputState)
 	}
 #endif
 
-	// Attempt first move
+	const float WallDot = FVector::DotProduct(WallContact.GetNormal(), UpDirection);
+
+	// Normal and gap of a static, planar wall the free space bubble may rest on
+	FVector SupportNormal = FVector::ZeroVector;
+	float SupportGap = 0.f;
+
+	// Fold the wall attraction into the move, so the pawn is moved and pulled onto the wall by a single sweep
+	if (WallDot >= 0.f)
+	{
+		// Prefer the captured wall plane, it stays exact while we run along it
+		FBotaniWallPlane WallPlane;
+		const bool bHasWallPlane = SimBlackboard->TryGet<FBotaniWallPlane>(BotaniMover::Blackboard::LastWallPlane, WallPlane) && WallPlane.IsValid();
+		const FVector WallNormal = bHasWallPlane ? WallPlane.GetNormal() : WallContact.GetNormal();
+
+		// Never pull further than the gap between the capsule and the wall, minus the skin we keep to it
+		const float PawnRadius = MovingComponentSet.UpdatedPrimitive->GetCollisionShape().GetExtent().X;
+		// The contact's distance is along the probe's trace vector, so measure the gap along the normal ourselves
+		const FVector Location = MovingComponentSet.UpdatedComponent->GetComponentLocation();
+		const float WallDistance = bHasWallPlane
+			? WallPlane.GetDistance(Location)
+			: (Location - WallContact.GetImpactPoint()) | WallNormal;
+		const float WallGap = WallDistance - PawnRadius;
+		const float AttractionDistance = FMath::Clamp(
+			WallGap - BotaniWallRunSettings->WallRunSkinWidth,
+			0.f,
+			GetBotaniWallRunFloatProp(WallRun_AttractionForceMagnitude) * DeltaTime);
+
+		WallRunData.CurrentMoveDelta = FVector::VectorPlaneProject(WallRunData.CurrentMoveDelta, WallNormal)
+			- WallNormal * AttractionDistance;
+
+		const UPrimitiveComponent* WallComponent = WallContact.GetComponent();
+		if (bHasWallPlane && WallComponent && WallComponent->Mobility != EComponentMobility::Movable)
+		{
+			SupportNormal = WallNormal;
+			SupportGap = WallGap;
+		}
+	}
+
+	// Move, without a sweep if we stay inside free space
+	const bool bSweep = !UBotaniMoverComponent::CanMoveWithoutSweep(MoverComponent, WallRunData.CurrentMoveDelta, SupportNormal, SupportGap);
+	UBotaniMoverQueryBudgetSubsystem::RecordQueries(MoverComponent, EBotaniMoverQuery::Move, bSweep ? 1 : 0);
 	UMovementUtils::TrySafeMoveUpdatedComponent(
 		MovingComponentSet,
 		WallRunData.CurrentMoveDelta,
 		WallRunData.TargetOrientQuat,
-		true,
+		bSweep,
 		WallRunData.MoveHitResult,
 		ETeleportType::None,
 		WallRunData.MoveRecord);
 
-	const float WallDot = FVector::DotProduct(CurrentWall.GetHitResult().Normal, UpDirection);
-
-	// Apply the wall attraction force to make the player stick onto the wall
-	if (WallDot >= 0.f)
+	// Have we hit something?
+	if (WallRunData.MoveHitResult.IsValidBlockingHit() &&
+		MovingComponentSet.UpdatedPrimitive.IsValid())
 	{
-		const FVector WallAttractionForce =(
-				-CurrentWall.GetHitResult().Normal *
-				GetBotaniWallRunFloatProp(WallRun_AttractionForceMagnitude) *
-				DeltaTime);
+		// Update the time applied so far
+		WallRunData.PercentTimeAppliedSoFar = UpdateTimePercentAppliedSoFar(
+			WallRunData.PercentTimeAppliedSoFar,
+			WallRunData.MoveHitResult.Time);
+
+		// Tell the mover component to handle the impact, unless it's just the wall we are running on
+		if (WallRunData.MoveHitResult.GetComponent() != WallContact.GetComponent())
+		{
+			FMoverOnImpactParams ImpactParams(BotaniMover::ModeNames::WallRunning, WallRunData.MoveHitResult, WallRunData.CurrentMoveDelta);
+			MoverComponent->HandleImpact(ImpactParams);
+		}
 
-		UMovementUtils::TrySafeMoveUpdatedComponent(
+		// Slide along whatever blocked us with the rest of the move
+		const float PercentAppliedOfRemaining = UMovementUtils::TryMoveToSlideAlongSurface(
 			MovingComponentSet,
-			WallAttractionForce,
+			WallRunData.CurrentMoveDelta,
+			1.f - WallRunData.MoveHitResult.Time,
 			WallRunData.TargetOrientQuat,
-			true,
+			WallRunData.MoveHitResult.Normal,
 			WallRunData.MoveHitResult,
-			ETeleportType::None,
+			true,
 			WallRunData.MoveRecord);
 
-		GEngine->AddOnScreenDebugMessage(1112, 1.f, FColor::Blue,
-		FString::Printf(TEXT("Attraction Force: %s"), *WallAttractionForce.ToCompactString()));
+		WallRunData.PercentTimeAppliedSoFar = UpdateTimePercentAppliedSoFar(
+			WallRunData.PercentTimeAppliedSoFar,
+			PercentAppliedOfRemaining);
+	}
+	else
+	{
+		// This indicates an unimpeded full move
+		WallRunData.PercentTimeAppliedSoFar = 1.f;
 	}
 
 	CaptureFinalState(CurrentWall, DeltaTime * WallRunData.PercentTimeAppliedSoFar, OutputState, WallRunData.MoveRecord);
@@ -397,27 +455,24 @@ void UBotaniMM_WallRunning::CaptureFinalState(
 {
 	const FVector FinalLocation = MovingComponentSet.UpdatedPrimitive->GetComponentLocation();
 
-	// Save the current time as the last wall run time
-	SimBlackboard->Set<float>(BotaniMover::Blackboard::LastWallRunTime, CurrentSimulationTime);
-
-	/*// Check for refunds
+	// Check for refunds
 	// If we have this amount of time (or more) remaining, give it to the next simulation step.
 	constexpr float MinRemainingSecondsToRefund = 0.0001f;
 
 	if ((DeltaTime - DeltaSecondsUsed) >= MinRemainingSecondsToRefund)
 	{
 		const float PctOfTimeRemaining = (1.f - (DeltaSecondsUsed / DeltaTime));
-		TickEndData.MovementEndState.RemainingMs = PctOfTimeRemaining * DeltaTime * 1000.f;
+		TickEndData.MovementEndState.RemainingMs = PctOfTimeRemaining * DeltaTime * BotaniMover::Lazy::SToMs;
 	}
 	else
 	{
 		TickEndData.MovementEndState.RemainingMs = 0.f;
 	}
 
-	Record.SetDeltaSeconds(DeltaSecondsUsed);*/
+	Record.SetDeltaSeconds(DeltaSecondsUsed);
 
 	OutDefaultSyncState->SetTransforms_WorldSpace(
-			MovingComponentSet.UpdatedComponent->GetComponentLocation(),
+			FinalLocation,
 			MovingComponentSet.UpdatedComponent->GetComponentRotation(),
 			Record.GetRelevantVelocity(),
 			nullptr);
@@ -10,6 +10,7 @@
 #include "CommonMoverComponent.h"
 #include "MoverComponent.h"
 #include "MoverTypes.h"
+#include "Components/BotaniMoverComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "DefaultMovementSet/InstantMovementEffects/BasicInstantMovementEffects.h"
 #include "MoveLibrary/MovementUtils.h"
@@ -17,6 +18,8 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniStanceModifier)
 
+const FName FBotaniStanceModifier::MovementSettingsModifierSource = TEXT("Stance");
+
 FBotaniStanceModifier::FBotaniStanceModifier()
 {
 	ActiveStance = EBotaniStanceMode::Crouch;
@@ -50,7 +53,7 @@ void FBotaniStanceModifier::OnStart(
 	const FMoverSyncState& SyncState,
 	const FMoverAuxStateContext& AuxState)
 {
-	const UBotaniStanceSettings* StanceSettings = MoverComp->FindSharedSettings<UBotaniStanceSettings>();
+	const UBotaniStanceSettings* StanceSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniStanceSettings>(MoverComp);
 	if (!IsValid(StanceSettings))
 	{
 		BOTANIMOVER_ERROR("Botani Stance Modifier: No valid BotaniStanceSettings found on MoverComponent %s", *MoverComp->GetName());
@@ -175,10 +178,11 @@ bool FBotaniStanceModifier::CanExpand(const UMoverComponent* MoverComp) const
 
 	float HalfHeightDelta = StandingHalfHeight - CurrentHalfHeight;
 
-	// Perform a capsule trace to check if we can expand the capsule without colliding with anything
-	FCollisionQueryParams CapsuleParams(SCENE_QUERY_STAT(CrouchTrace), false, MoverComp->GetOwner());
-	FCollisionResponseParams ResponseParam;
-	UMovementUtils::InitCollisionParams(UpdatedCompAsPrimitive, CapsuleParams, ResponseParam);
+	// Perform a capsule overlap to check if we can expand the capsule without colliding with anything
+	// The collision params are cached on the mover component, so this doesn't build them every check
+	FBotaniMoverCollisionParams ScratchParams;
+	const FBotaniMoverCollisionParams& CollisionParams = UBotaniMoverComponent::FindCollisionParams(MoverComp, ScratchParams);
+	const UWorld* World = MoverComp->GetWorld();
 
 	const FMoverDefaultSyncState* SyncState = MoverComp->GetSyncState().SyncStateCollection.FindDataByType<FMoverDefaultSyncState>();
 
@@ -190,7 +194,6 @@ bool FBotaniStanceModifier::CanExpand(const UMoverComponent* MoverComp) const
 
 	// TODO: Compensate for the difference between current capsule size and standing size
 	FCollisionShape StandingCapsuleShape = FCollisionShape::MakeCapsule(PawnRadius, StandingHalfHeight);
-	const ECollisionChannel CollisionChannel = UpdatedCompAsPrimitive->GetCollisionObjectType();
 	bool bEncroached = true;
 
 	// TODO: We may need to expand this check to look at more than just the initial overlap - see CMC Uncrouch for details
@@ -198,13 +201,13 @@ bool FBotaniStanceModifier::CanExpand(const UMoverComponent* MoverComp) const
 	if (!ShouldExpandingMaintainBase(CommonMover))
 	{
 		// Expand in place
-		bEncroached = UMovementUtils::OverlapTest(UpdatedComponent, UpdatedCompAsPrimitive, PawnLocation, PawnRot, CollisionChannel, StandingCapsuleShape, MoverComp->GetOwner());
+		bEncroached = World->OverlapBlockingTestByChannel(PawnLocation, PawnRot, CollisionParams.CollisionChannel, StandingCapsuleShape, CollisionParams.QueryParams, CollisionParams.ResponseParams);
 	}
 	else
 	{
 		// Expand while keeping base location the same.
 		FVector StandingLocation = PawnLocation + (HalfHeightDelta + .01f) * MoverComp->GetUpDirection();
-		bEncroached = UMovementUtils::OverlapTest(UpdatedComponent, UpdatedCompAsPrimitive, StandingLocation, PawnRot, CollisionChannel, StandingCapsuleShape, MoverComp->GetOwner());
+		bEncroached = World->OverlapBlockingTestByChannel(StandingLocation, PawnRot, CollisionParams.CollisionChannel, StandingCapsuleShape, CollisionParams.QueryParams, CollisionParams.ResponseParams);
 	}
 
 	return !bEncroached;
@@ -266,19 +269,26 @@ void FBotaniStanceModifier::AdjustCapsule(
 
 void FBotaniStanceModifier::ApplyMovementSettings(UMoverComponent* MoverComp)
 {
+	UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	if (!BotaniMoverComp)
+	{
+		BOTANIMOVER_WARN("Botani Stance Modifier: %s is not a BotaniMoverComponent, movement settings won't be modified", *GetNameSafe(MoverComp));
+		return;
+	}
+
 	switch (ActiveStance)
 	{
 	default:
 	case EBotaniStanceMode::Crouch:
 		{
-			if (const UBotaniStanceSettings* StanceSettings = MoverComp->FindSharedSettings<UBotaniStanceSettings>())
+			if (const UBotaniStanceSettings* StanceSettings = BotaniMoverComp->GetBotaniSettings<UBotaniStanceSettings>())
 			{
-				// Update relevant movement settings
-				if (UBotaniCommonMovementSettings* BotaniMovementSettings = MoverComp->FindSharedSettings_Mutable<UBotaniCommonMovementSettings>())
+				// Override the relevant movement settings while crouched
+				BotaniMoverComp->PushMovementSettingsModifier(MovementSettingsModifierSource,
 				{
-					BotaniMovementSettings->Acceleration = StanceSettings->CrouchingMaxAcceleration;
-					BotaniMovementSettings->MaxSpeed = StanceSettings->CrouchingMaxSpeed;
-				}
+					FBotaniMovementSettingsDelta(GET_MEMBER_NAME_CHECKED(FBotaniResolvedMovementSettings, Acceleration), EBotaniSettingsModifierOp::Override, StanceSettings->CrouchingMaxAcceleration),
+					FBotaniMovementSettingsDelta(GET_MEMBER_NAME_CHECKED(FBotaniResolvedMovementSettings, MaxSpeed), EBotaniSettingsModifierOp::Override, StanceSettings->CrouchingMaxSpeed),
+				});
 			}
 
 			break;
@@ -294,16 +304,9 @@ void FBotaniStanceModifier::ApplyMovementSettings(UMoverComponent* MoverComp)
 
 void FBotaniStanceModifier::RevertMovementSettings(UMoverComponent* MoverComp)
 {
-	if (const UMoverComponent* CDOMoverComp = UMovementUtils::GetOriginalComponentType<UMoverComponent>(MoverComp->GetOwner()))
+	// Drop our overrides, the shared settings were never touched
+	if (UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp))
 	{
-		const UBotaniCommonMovementSettings* OriginalBotaniMovementSettings = CDOMoverComp->FindSharedSettings<UBotaniCommonMovementSettings>();
-		UBotaniCommonMovementSettings* BotaniMovementSettings = MoverComp->FindSharedSettings_Mutable<UBotaniCommonMovementSettings>();
-
-		// Revert movement settings back to original settings
-		if (BotaniMovementSettings && OriginalBotaniMovementSettings)
-		{
-			BotaniMovementSettings->Acceleration = OriginalBotaniMovementSettings->Acceleration;
-			BotaniMovementSettings->MaxSpeed = OriginalBotaniMovementSettings->MaxSpeed;
-		}
+		BotaniMoverComp->PopMovementSettingsModifier(MovementSettingsModifierSource);
 	}
 }
@@ -0,0 +1,84 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "MoveLibrary/BotaniCurveLookupTable.h"
+
+#include "Curves/RichCurve.h"
+
+void FBotaniCurveLookupTable::Bake(const FRichCurve* Curve, float InDefaultValue)
+{
+	DefaultValue = InDefaultValue;
+	bHasData = Curve && Curve->HasAnyData();
+
+	if (!bHasData)
+	{
+		MinTime = 0.f;
+		InvSampleStep = 0.f;
+		return;
+	}
+
+	float MaxTime = 0.f;
+	Curve->GetTimeRange(MinTime, MaxTime);
+
+	const float TimeRange = MaxTime - MinTime;
+	const float SampleStep = TimeRange / static_cast<float>(NumSamples - 1);
+	InvSampleStep = (SampleStep > UE_SMALL_NUMBER) ? (1.f / SampleStep) : 0.f;
+
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+	{
+		Samples[SampleIndex] = Curve->Eval(MinTime + (SampleStep * SampleIndex), InDefaultValue);
+	}
+}
+
+void FBotaniCurveLookupTable::EvalBatch(TConstArrayView<float> InTimes, TArrayView<float> OutValues) const
+{
+	check(InTimes.Num() == OutValues.Num());
+
+	const int32 NumValues = InTimes.Num();
+	if (!bHasData)
+	{
+		for (int32 Index = 0; Index < NumValues; Index++)
+		{
+			OutValues[Index] = DefaultValue;
+		}
+		return;
+	}
+
+	const VectorRegister4Float MinTimeVec = VectorSetFloat1(MinTime);
+	const VectorRegister4Float InvSampleStepVec = VectorSetFloat1(InvSampleStep);
+	const VectorRegister4Float MaxSampleCoordVec = VectorSetFloat1(static_cast<float>(NumSamples - 1));
+	const VectorRegister4Float MaxLowerIndexVec = VectorSetFloat1(static_cast<float>(NumSamples - 2));
+
+	// Four values at a time, only the sample gather itself is scalar
+	int32 Index = 0;
+	for (; Index + 4 <= NumValues; Index += 4)
+	{
+		VectorRegister4Float SampleCoord = VectorMultiply(VectorSubtract(VectorLoad(&InTimes[Index]), MinTimeVec), InvSampleStepVec);
+		SampleCoord = VectorMin(VectorMax(SampleCoord, VectorZeroFloat()), MaxSampleCoordVec);
+
+		const VectorRegister4Float LowerIndex = VectorMin(VectorFloor(SampleCoord), MaxLowerIndexVec);
+		const VectorRegister4Float Alpha = VectorSubtract(SampleCoord, LowerIndex);
+
+		alignas(16) float LowerIndices[4];
+		VectorStoreAligned(LowerIndex, LowerIndices);
+
+		alignas(16) float LowerSamples[4];
+		alignas(16) float UpperSamples[4];
+		for (int32 Lane = 0; Lane < 4; Lane++)
+		{
+			const int32 SampleIndex = static_cast<int32>(LowerIndices[Lane]);
+			LowerSamples[Lane] = Samples[SampleIndex];
+			UpperSamples[Lane] = Samples[SampleIndex + 1];
+		}
+
+		const VectorRegister4Float LowerVec = VectorLoadAligned(LowerSamples);
+		const VectorRegister4Float UpperVec = VectorLoadAligned(UpperSamples);
+		VectorStore(VectorMultiplyAdd(VectorSubtract(UpperVec, LowerVec), Alpha, LowerVec), &OutValues[Index]);
+	}
+
+	// Remaining tail
+	for (; Index < NumValues; Index++)
+	{
+		OutValues[Index] = Eval(InTimes[Index]);
+	}
+}
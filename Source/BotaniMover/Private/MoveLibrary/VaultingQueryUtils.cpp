@@ -3,10 +3,12 @@
 
 #include "MoveLibrary/VaultingQueryUtils.h"
 
+#include "BotaniMoverProbeService.h"
 #include "Components/BotaniMoverComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SphereComponent.h"
-#include "MoveLibrary/MovementUtils.h"
+#include "Engine/OverlapResult.h"
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(VaultingQueryUtils)
@@ -31,7 +33,10 @@ void UVaultingQueryUtils::FindVaultingPath(
 	const FVector& Location,
 	const FRotator& Rotation,
 	const FFloatRange& VaultingSlopeCosineRange,
-	FVaultingPathCheckResult& OutVaultingResult)
+	const FBotaniMoverSurfaceFilter& SurfaceFilter,
+	FVaultingPathCheckResult& OutVaultingResult,
+	int32 SimFrame,
+	ECollisionChannel TraceChannel)
 {
 	// Reset our vaulting data
 	OutVaultingResult.Clear();
@@ -41,37 +46,75 @@ void UVaultingQueryUtils::FindVaultingPath(
 		return;
 	}
 
-	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(FindVaultingPath), false, MovingComps.UpdatedPrimitive->GetOwner());
+	// Use the collision params cached on the mover component
+	FBotaniMoverCollisionParams ScratchParams;
+	const FBotaniMoverCollisionParams& CollisionParams = UBotaniMoverComponent::FindCollisionParams(MovingComps.MoverComponent.Get(), ScratchParams);
+	const FCollisionQueryParams& QueryParams = CollisionParams.QueryParams;
 
-	FCollisionResponseParams ResponseParams;
-	UMovementUtils::InitCollisionParams(MovingComps.UpdatedPrimitive.Get(), QueryParams, ResponseParams);
-	const ECollisionChannel CollisionChannel = MovingComps.UpdatedPrimitive->GetCollisionObjectType();
+	// The pawn's responses only make sense on the pawn's own channel
+	const bool bUsePawnChannel = (TraceChannel == ECC_MAX || TraceChannel == CollisionParams.CollisionChannel);
+	const FCollisionResponseParams& ResponseParams = bUsePawnChannel ? CollisionParams.ResponseParams : FCollisionResponseParams::DefaultResponseParam;
+	const ECollisionChannel CollisionChannel = bUsePawnChannel ? CollisionParams.CollisionChannel : TraceChannel;
 
 
 	float PawnRadius = 0.0f;
 	float PawnHalfHeight = 0.0f;
 	FVector UpDirection = MovingComps.MoverComponent->GetUpDirection();
-
-	// This is kinda bada, but for vaulting pawns i guess capsules or spheres are the most common components.
-	if (UCapsuleComponent* CapsuleComponent = Cast<UCapsuleComponent>(MovingComps.UpdatedComponent))
-	{
-		CapsuleComponent->GetScaledCapsuleSize(PawnRadius, PawnHalfHeight);
-	}
-	else if (USphereComponent* SphereComponent = Cast<USphereComponent>(MovingComps.UpdatedComponent))
-	{
-		PawnRadius = SphereComponent->GetScaledSphereRadius();
-		PawnHalfHeight = SphereComponent->GetScaledSphereRadius();
-	}
-	else
-	{
-		// Default to a reasonable size if no capsule or sphere component is found
-		PawnRadius = 34.f; // Default radius for a humanoid character
-		PawnHalfHeight = 88.f; // Default half-height for a humanoid character
-	}
+	GetPawnCollisionSize(MovingComps.UpdatedComponent, PawnRadius, PawnHalfHeight);
 
 	// Perform the line trace(s)
 	if (VaultSweepDistance > 0.f && VaultingSamples > 0)
 	{
+		UWorld* World = MovingComps.UpdatedComponent->GetWorld();
+
+		// Use the candidates prefetched by the last frame, if they still contain all samples
+		TConstArrayView<FOverlapResult> Candidates;
+		const float ProbeRadius = GetVaultingProbeRadius(MovingComps.UpdatedComponent, MaxVaultHeight, VaultSweepDistance);
+		FBotaniMoverProbeService* ProbeService = UBotaniMoverComponent::FindProbeService(MovingComps.MoverComponent.Get());
+		bool bUseCandidates = ProbeService && SimFrame != INDEX_NONE
+			&& ProbeService->TryGetCandidates(World, EBotaniMoverProbe::Vault, SimFrame, Location, ProbeRadius, Candidates);
+
+		// A scene trace can't skip filtered components, so find the candidates once and only trace the ones that pass
+		TArray<FOverlapResult> FilterOverlaps;
+		if (!bUseCandidates && !SurfaceFilter.IsEmpty())
+		{
+			World->OverlapMultiByChannel(FilterOverlaps, Location, FQuat::Identity, CollisionChannel, FCollisionShape::MakeSphere(ProbeRadius), QueryParams, ResponseParams);
+			UBotaniMoverQueryBudgetSubsystem::RecordQueries(MovingComps.MoverComponent.Get(), EBotaniMoverQuery::Vault);
+
+			Candidates = FilterOverlaps;
+			bUseCandidates = true;
+		}
+
+		auto TraceSample = [&](FHitResult& OutHit, const FVector& Start, const FVector& End)
+		{
+			if (!bUseCandidates)
+			{
+				UBotaniMoverQueryBudgetSubsystem::RecordQueries(MovingComps.MoverComponent.Get(), EBotaniMoverQuery::Vault);
+				return World->LineTraceSingleByChannel(OutHit, Start, End, CollisionChannel, QueryParams, ResponseParams);
+			}
+
+			// Only the closest blocking candidate counts, like it would for a scene trace
+			bool bHitCandidate = false;
+			for (const FOverlapResult& Candidate : Candidates)
+			{
+				UPrimitiveComponent* CandidateComponent = Candidate.GetComponent();
+				if (!Candidate.bBlockingHit || !IsValid(CandidateComponent) || !SurfaceFilter.PassesFilter(CandidateComponent))
+				{
+					continue;
+				}
+
+				FHitResult CandidateHit(1.f);
+				if (CandidateComponent->LineTraceComponent(CandidateHit, Start, End, QueryParams)
+					&& (!bHitCandidate || CandidateHit.Time < OutHit.Time))
+				{
+					OutHit = CandidateHit;
+					bHitCandidate = true;
+				}
+			}
+
+			return bHitCandidate;
+		};
+
 		const FVector ForwardVector = FRotationMatrix(Rotation).GetUnitAxis(EAxis::X);
 		const float SampleHeightOffset = ( Location.Z - PawnHalfHeight ) + MinVaultHeight;
 
@@ -83,8 +126,7 @@ void UVaultingQueryUtils::FindVaultingPath(
 			const FVector SampleEnd = SampleStart + (ForwardVector * VaultSweepDistance);
 
 			FHitResult Hit(1.f);
-			const bool bBlockingHit = MovingComps.UpdatedComponent->GetWorld()
-				->LineTraceSingleByChannel(Hit, SampleStart, SampleEnd, CollisionChannel, QueryParams, ResponseParams);
+			const bool bBlockingHit = TraceSample(Hit, SampleStart, SampleEnd);
 
 			if (bBlockingHit && Hit.Time > 0.f)
 			{
@@ -92,7 +134,7 @@ void UVaultingQueryUtils::FindVaultingPath(
 				if (IsVaultingPathValid(Hit, UpDirection, VaultingSlopeCosineRange))
 				{
 					OutVaultingResult.SetFromLineTrace(Hit, Hit.Distance, true);
-					break;
+					return;
 				}
 			}
 		}
@@ -102,6 +144,42 @@ void UVaultingQueryUtils::FindVaultingPath(
 	OutVaultingResult.bValidVaultingPath = false;
 }
 
+float UVaultingQueryUtils::GetVaultingProbeRadius(
+	const USceneComponent* UpdatedComponent,
+	float MaxVaultHeight,
+	float VaultSweepDistance)
+{
+	float PawnRadius = 0.0f;
+	float PawnHalfHeight = 0.0f;
+	GetPawnCollisionSize(UpdatedComponent, PawnRadius, PawnHalfHeight);
+
+	// The highest sample starts at most MaxVaultHeight above our feet and reaches VaultSweepDistance forward
+	return FMath::Sqrt(FMath::Square(VaultSweepDistance) + FMath::Square(PawnHalfHeight + MaxVaultHeight));
+}
+
+void UVaultingQueryUtils::GetPawnCollisionSize(
+	const USceneComponent* UpdatedComponent,
+	float& OutRadius,
+	float& OutHalfHeight)
+{
+	// This is kinda bada, but for vaulting pawns i guess capsules or spheres are the most common components.
+	if (const UCapsuleComponent* CapsuleComponent = Cast<UCapsuleComponent>(UpdatedComponent))
+	{
+		CapsuleComponent->GetScaledCapsuleSize(OutRadius, OutHalfHeight);
+	}
+	else if (const USphereComponent* SphereComponent = Cast<USphereComponent>(UpdatedComponent))
+	{
+		OutRadius = SphereComponent->GetScaledSphereRadius();
+		OutHalfHeight = SphereComponent->GetScaledSphereRadius();
+	}
+	else
+	{
+		// Default to a reasonable size if no capsule or sphere component is found
+		OutRadius = 34.f; // Default radius for a humanoid character
+		OutHalfHeight = 88.f; // Default half-height for a humanoid character
+	}
+}
+
 bool UVaultingQueryUtils::IsVaultingPathValid(
 	const FHitResult& Hit,
 	const FVector& UpDirection,
@@ -8,11 +8,131 @@
 #include "BotaniWallRunMovementSettings.h"
 #include "MoverComponent.h"
 #include "Components/BotaniMoverComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
 #include "MoveLibrary/MovementUtils.h"
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(WallRunningMovementUtils)
 
+AActor* FWallContact::GetActor() const
+{
+	const UPrimitiveComponent* WallComponent = Component.Get();
+	return WallComponent ? WallComponent->GetOwner() : nullptr;
+}
+
+void FWallContact::SetFromHitResult(
+	const FHitResult& InHit,
+	const float InDistance)
+{
+	// Wall traces are line traces, so the normal and the impact normal are the same
+	Normal = InHit.ImpactNormal;
+	ImpactPoint = InHit.ImpactPoint;
+	Distance = InDistance;
+	Component = InHit.Component;
+	PhysMaterial = InHit.PhysMaterial;
+}
+
+void FWallContact::SetFromProbe(
+	const FVector& InNormal,
+	const FVector& InImpactPoint,
+	const float InDistance,
+	const EBotaniWallRunSide InSide,
+	UPrimitiveComponent* InComponent)
+{
+	Normal = InNormal;
+	ImpactPoint = InImpactPoint;
+	Distance = InDistance;
+	Side = InSide;
+	Component = InComponent;
+
+	// Overlaps don't return a physical material, so use the body's one
+	const FBodyInstance* BodyInstance = InComponent ? InComponent->GetBodyInstance() : nullptr;
+	PhysMaterial = BodyInstance ? BodyInstance->GetSimplePhysicalMaterial() : nullptr;
+}
+
+bool FBotaniWallPlane::Capture(
+	const FWallContact& InContact,
+	const FVector& UpDirection,
+	const double InSimTimeMs,
+	const float PlanarityProbeDistance)
+{
+	*this = FBotaniWallPlane();
+
+	UPrimitiveComponent* WallComponent = InContact.GetComponent();
+	if (!WallComponent)
+	{
+		return false;
+	}
+
+	Origin = InContact.GetImpactPoint();
+	Normal = InContact.GetNormal();
+	Tangent = (Normal ^ UpDirection).GetSafeNormal();
+	if (Tangent.IsNearlyZero())
+	{
+		// Floors and ceilings have no direction to run along
+		return false;
+	}
+
+	Bitangent = Tangent ^ Normal;
+
+	// The wall has to stay on the plane around the contact, otherwise it's curved or we're right at its edge
+	for (const FVector& ProbeOffset : { Tangent, -Tangent, Bitangent, -Bitangent })
+	{
+		const FVector ProbeLocation = Origin + (Normal + ProbeOffset) * PlanarityProbeDistance;
+
+		FVector ClosestPoint;
+		const float ProbeDistance = WallComponent->GetClosestPointOnCollision(ProbeLocation, ClosestPoint);
+		if (ProbeDistance <= 0.f || FMath::Abs(GetDistance(ClosestPoint)) > 1.f)
+		{
+			return false;
+		}
+	}
+
+	// The bounds are only an outer extent, openings inside of them are found by confirming the contact while running along
+	const FBox WallBounds = WallComponent->Bounds.GetBox();
+	FVector BoundsVertices[8];
+	WallBounds.GetVertices(BoundsVertices);
+	for (const FVector& BoundsVertex : BoundsVertices)
+	{
+		Extent += ToWallSpace(BoundsVertex);
+	}
+
+	WallTransform = WallComponent->GetComponentTransform();
+	Contact = InContact;
+	ConfirmedContactPoint = Origin;
+	CaptureSimTimeMs = InSimTimeMs;
+	bValid = true;
+
+	return true;
+}
+
+bool FBotaniWallPlane::HasWallMoved() const
+{
+	const UPrimitiveComponent* WallComponent = Contact.GetComponent();
+	return !WallComponent || !WallComponent->GetComponentTransform().Equals(WallTransform, UE_KINDA_SMALL_NUMBER);
+}
+
+FWallContact FBotaniWallPlane::MakeContact(const FVector& WorldLocation) const
+{
+	const float WallDistance = GetDistance(WorldLocation);
+
+	FWallContact PlaneContact = Contact;
+	PlaneContact.SetImpactPoint(WorldLocation - Normal * WallDistance, WallDistance);
+	return PlaneContact;
+}
+
+FHitResult FWallContact::ToHitResult(const FVector& TraceStart) const
+{
+	FHitResult Hit(GetActor(), GetComponent(), ImpactPoint, Normal);
+	Hit.TraceStart = TraceStart;
+	Hit.TraceEnd = ImpactPoint;
+	Hit.Distance = Distance;
+	Hit.PhysMaterial = PhysMaterial;
+	return Hit;
+}
+
 void FWallCheckResult::SetFromHitResult(
 	const FHitResult& InHit,
 	const float InWallDist,
@@ -20,8 +140,7 @@ void FWallCheckResult::SetFromHitResult(
 {
 	bBlockingHit = InHit.IsValidBlockingHit();
 	bRunAbleWall = bInIsRunAbleWall;
-	HitResult = InHit;
-	WallDist = InWallDist;
+	Contact.SetFromHitResult(InHit, InWallDist);
 }
 
 FProposedMove UWallRunningMovementUtils::ComputeControlledWallRunMove(const FWallRunMoveParams& InParams)
@@ -98,6 +217,26 @@ bool UWallRunningMovementUtils::PerformWallTrace_Mover(
 	float WallTraceVectorsTailDelta,
 	EBotaniWallRunSide WallSide)
 {
+	FWallProbeResult ProbeResult;
+	if (!ProbeWalls(MoverComponent, ProbeResult, WallTraceVectorsHeadDelta, WallTraceVectorsTailDelta, WallSide))
+	{
+		return false;
+	}
+
+	// Hand out the closest wall as a hit result
+	OutWallHit = ProbeResult.GetClosestWall(WallSide)->ToHitResult(MoverComponent->GetOwner()->GetActorLocation());
+	return true;
+}
+
+bool UWallRunningMovementUtils::ProbeWalls(
+	const UMoverComponent* MoverComponent,
+	FWallProbeResult& OutProbeResult,
+	float WallTraceVectorsHeadDelta,
+	float WallTraceVectorsTailDelta,
+	EBotaniWallRunSide WallSide)
+{
+	OutProbeResult = FWallProbeResult();
+
 	if (WallSide == Wall_Error)
 	{
 		UE_LOG(LogBotaniMover, Error, TEXT("[%hs] WallSide is set to Error on pawn '%s'!"),
@@ -105,79 +244,232 @@ bool UWallRunningMovementUtils::PerformWallTrace_Mover(
 		return false;
 	}
 
+	// Other modes or transitions may have probed from here already this frame
+	FBotaniMoverQueryCache* QueryCache = UBotaniMoverComponent::FindQueryCache(MoverComponent);
+	const USceneComponent* UpdatedComponent = MoverComponent->GetUpdatedComponent();
+	const FTransform ProbeTransform = UpdatedComponent ? UpdatedComponent->GetComponentTransform() : FTransform::Identity;
+	if (QueryCache && UpdatedComponent
+		&& QueryCache->TryGetWallProbe(ProbeTransform, WallTraceVectorsHeadDelta, WallTraceVectorsTailDelta, WallSide, OutProbeResult))
+	{
+		return OutProbeResult.HasWall(WallSide);
+	}
+
 	const FVector DownDirection = MoverComponent->GetUpDirection() * -1.f;
 
 	// Trace params
 	UWorld const* World = MoverComponent->GetWorld();
 	check(World);
 
-	FCollisionQueryParams QueryParams = GetIgnoreOwnerQueryParams(MoverComponent);
-	FHitResult WallHit;
+	FBotaniMoverCollisionParams ScratchParams;
+	const FCollisionQueryParams& QueryParams = UBotaniMoverComponent::FindCollisionParams(MoverComponent, ScratchParams).QueryParams;
 
-	// Build up the trace start and end points
+	// Build up the probe location and directions
 	const FVector FwdDir = MoverComponent->GetOwner()->GetActorForwardVector();
 	const FVector Location = MoverComponent->GetOwner()->GetActorLocation();
 	const FVector FwdDir2D = FVector::VectorPlaneProject(FwdDir, DownDirection);
 	const FVector RightDir = (FwdDir2D ^ DownDirection).GetSafeNormal2D();
+	const FVector ForwardDelta = (FwdDir2D * WallTraceVectorsTailDelta);
 
-	auto DoTrace = [&] (const FVector& InTraceStart, const FVector& InTraceEnd)
-	{
-		auto Result = World->LineTraceSingleByChannel(WallHit, InTraceStart, InTraceEnd, ECC_Camera, QueryParams);
+	// The probe sphere covers the tips of all trace vectors
+	const float ProbeRadius = FMath::Sqrt(FMath::Square(WallTraceVectorsHeadDelta) + ForwardDelta.SizeSquared());
+
+	// Resolve the settings once, not per trace
+	const UBotaniWallRunMovementSettings* Settings =
+		UBotaniMoverComponent::FindBotaniSettings<UBotaniWallRunMovementSettings>(MoverComponent);
+	const ECollisionChannel WallTraceChannel = Settings ? Settings->WallTraceChannel.GetValue() : ECC_Camera;
+	const FBotaniMoverSurfaceFilter SurfaceFilter = Settings ? Settings->WallSurfaceFilter : FBotaniMoverSurfaceFilter();
 
 #if ENABLE_DRAW_DEBUG
-		if (const UBotaniWallRunMovementSettings* Settings =
-			MoverComponent->FindSharedSettings<UBotaniWallRunMovementSettings>();
-			Settings->bDrawWallRunDebug)
+	const bool bDrawDebug = Settings && Settings->bDrawWallRunDebug;
+#endif
+
+	auto GetSideDelta = [&] (EBotaniWallRunSide InWallSide)
+	{
+		const float Sign = (InWallSide == Wall_Left) ? -1.f : 1.f;
+		return (RightDir * WallTraceVectorsHeadDelta) * Sign;
+	};
+
+	auto StoreContact = [&] (EBotaniWallRunSide InWallSide, const FWallContact& InContact)
+	{
+		FWallContact& SideContact = (InWallSide == Wall_Left) ? OutProbeResult.Left : OutProbeResult.Right;
+		const bool bHadWall = OutProbeResult.HasWall(InWallSide);
+		if (!bHadWall || InContact.GetDistance() < SideContact.GetDistance())
 		{
-			DrawDebugLine(World, InTraceStart, InTraceEnd, Result ? FColor::Blue : FColor::Red, false, 0.1f, 0, 1.f);
+			SideContact = InContact;
+			SideContact.SetSide(InWallSide);
 		}
-#endif
 
-		return Result;
+		if (InWallSide == Wall_Left)
+		{
+			OutProbeResult.bHitLeft = true;
+		}
+		else
+		{
+			OutProbeResult.bHitRight = true;
+		}
 	};
 
-	auto DoDoubleTrace = [&] (EBotaniWallRunSide InWallSide)
+	// A single overlap finds all wall candidates, prefetched by the last frame if its prediction still covers us
+	TArray<FOverlapResult> ProbeOverlaps;
+	TConstArrayView<FOverlapResult> Overlaps;
+	FBotaniMoverProbeService* ProbeService = UBotaniMoverComponent::FindProbeService(MoverComponent);
+	if (!QueryCache || !ProbeService
+		|| !ProbeService->TryGetCandidates(MoverComponent->GetWorld(), EBotaniMoverProbe::Wall, QueryCache->GetSimFrame(), Location, ProbeRadius, Overlaps))
 	{
-		ensure(((!!(InWallSide & Wall_Left)) != (!!(InWallSide & Wall_Right))));
+		World->OverlapMultiByChannel(ProbeOverlaps, Location, FQuat::Identity, WallTraceChannel, FCollisionShape::MakeSphere(ProbeRadius), QueryParams);
+		Overlaps = ProbeOverlaps;
+		UBotaniMoverQueryBudgetSubsystem::RecordQueries(MoverComponent, EBotaniMoverQuery::Wall);
+	}
 
-		// Expr
-		const float Sign = (InWallSide == Wall_Left) ? -1.f : 1.f;
-		const FVector SideDelta = (RightDir * WallTraceVectorsHeadDelta) * Sign;
-		const FVector ForwardDelta = (FwdDir2D * WallTraceVectorsTailDelta);
-		const FVector BackDelta = -ForwardDelta;
+#if ENABLE_DRAW_DEBUG
+	if (bDrawDebug)
+	{
+		DrawDebugSphere(World, Location, ProbeRadius, 12, Overlaps.IsEmpty() ? FColor::Red : FColor::Blue, false, 0.1f, 0, 1.f);
+	}
+#endif
+
+	bool bNeedsTraceFallback = false;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		UPrimitiveComponent* WallComponent = Overlap.GetComponent();
+		if (!Overlap.bBlockingHit || !IsValid(WallComponent) || !SurfaceFilter.PassesFilter(WallComponent))
+		{
+			continue;
+		}
 
-		// Compute point-vectors
-		const FVector TraceStart = Location;
-		const FVector TraceEndFront = (TraceStart + ForwardDelta + SideDelta);
-		const FVector TraceEndBack = (TraceStart + BackDelta + SideDelta);
+		// Derive the wall plane from the closest point on its collision
+		FVector ClosestPoint;
+		const float WallDistance = WallComponent->GetClosestPointOnCollision(Location, ClosestPoint);
+		if (WallDistance < 0.f)
+		{
+			// No simple collision, only a trace can tell us where this wall is
+			bNeedsTraceFallback = true;
+			continue;
+		}
 
-		return (DoTrace(TraceStart, TraceEndFront) ||
-			DoTrace(TraceStart, TraceEndBack));
-	};
+		if (WallDistance <= UE_KINDA_SMALL_NUMBER)
+		{
+			// We're inside of it, so there is no usable normal
+			continue;
+		}
+
+		// The direction to the closest point is only the wall's normal on a face, near its edges and corners it points diagonally
+		// A short trace of just this component towards the point finds the face and its actual normal
+		const FVector ClosestDirection = (ClosestPoint - Location) / WallDistance;
+		FHitResult FaceHit(1.f);
+		if (!WallComponent->LineTraceComponent(FaceHit, Location, ClosestPoint + ClosestDirection * 2.f, QueryParams))
+		{
+			continue;
+		}
+
+		const FVector WallNormal = FaceHit.ImpactNormal;
+		const float WallPlaneDistance = (Location - FaceHit.ImpactPoint) | WallNormal;
+		if (WallPlaneDistance <= UE_KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		// The wall normal points back at us, so a wall on the right has a normal pointing left
+		const EBotaniWallRunSide ContactSide = ((WallNormal | RightDir) <= 0.f) ? Wall_Right : Wall_Left;
+		if (!(WallSide & ContactSide))
+		{
+			continue;
+		}
+
+		// Only accept walls that one of the side's trace vectors would have reached
+		// The contact is where the first of them meets the wall, so its distance is along that vector like the traces reported it
+		const FVector SideDelta = GetSideDelta(ContactSide);
+		bool bReachesWall = false;
+		FVector TraceImpactPoint = FVector::ZeroVector;
+		for (const FVector& TraceDelta : { SideDelta + ForwardDelta, SideDelta - ForwardDelta })
+		{
+			const float TraceReach = TraceDelta | -WallNormal;
+			if (TraceReach >= WallPlaneDistance)
+			{
+				TraceImpactPoint = Location + TraceDelta * (WallPlaneDistance / TraceReach);
+				bReachesWall = true;
+				break;
+			}
+		}
+
+		if (!bReachesWall)
+		{
+			continue;
+		}
+
+		FWallContact Contact;
+		Contact.SetFromProbe(WallNormal, TraceImpactPoint, FVector::Dist(Location, TraceImpactPoint), ContactSide, WallComponent);
+		StoreContact(ContactSide, Contact);
+
+#if ENABLE_DRAW_DEBUG
+		if (bDrawDebug)
+		{
+			DrawDebugLine(World, Location, TraceImpactPoint, FColor::Blue, false, 0.1f, 0, 1.f);
+		}
+#endif
+	}
+
+	// Trace the sides we couldn't resolve from the overlap
+	if (bNeedsTraceFallback)
+	{
+		// The overlap covers both traces, so ignoring the filtered candidates once lets every trace stop at the first wall that passes
+		FCollisionQueryParams TraceParams = QueryParams;
+		SurfaceFilter.AddIgnoredComponents(Overlaps, TraceParams);
+
+		auto DoTrace = [&] (const FVector& InTraceStart, const FVector& InTraceEnd, FHitResult& OutHit)
+		{
+			const bool bResult = World->LineTraceSingleByChannel(OutHit, InTraceStart, InTraceEnd, WallTraceChannel, TraceParams);
+			UBotaniMoverQueryBudgetSubsystem::RecordQueries(MoverComponent, EBotaniMoverQuery::Wall);
+
+#if ENABLE_DRAW_DEBUG
+			if (bDrawDebug)
+			{
+				DrawDebugLine(World, InTraceStart, InTraceEnd, bResult ? FColor::Blue : FColor::Red, false, 0.1f, 0, 1.f);
+			}
+#endif
+
+			return bResult;
+		};
+
+		for (const EBotaniWallRunSide TraceSide : { Wall_Left, Wall_Right })
+		{
+			if (!(WallSide & TraceSide) || OutProbeResult.HasWall(TraceSide))
+			{
+				continue;
+			}
+
+			const FVector SideDelta = GetSideDelta(TraceSide);
+
+			FHitResult WallHit;
+			if (DoTrace(Location, Location + ForwardDelta + SideDelta, WallHit) ||
+				DoTrace(Location, Location - ForwardDelta + SideDelta, WallHit))
+			{
+				FWallContact Contact;
+				Contact.SetFromHitResult(WallHit, WallHit.Distance);
+				StoreContact(TraceSide, Contact);
+			}
+		}
+	}
 
-	// Do left or/and right traces
-	if (((WallSide & Wall_Left) && (DoDoubleTrace(Wall_Left)) ||
-		((WallSide & Wall_Right) && (DoDoubleTrace(Wall_Right)))))
+	if (QueryCache && UpdatedComponent)
 	{
-		// Save trace result if a wall has been found
-		OutWallHit = WallHit;
-		return true;
+		QueryCache->StoreWallProbe(ProbeTransform, WallTraceVectorsHeadDelta, WallTraceVectorsTailDelta, WallSide, OutProbeResult);
 	}
 
-	return false;
+	return OutProbeResult.HasWall(WallSide);
+}
+
+EBotaniWallRunSide UWallRunningMovementUtils::GetWallSide(const FHitResult& WallHit, const FVector& RightDirection)
+{
+	// The wall normal points back at us, so a wall on the right has a normal pointing left
+	return ((WallHit.ImpactNormal | RightDirection) <= 0.f) ? Wall_Right : Wall_Left;
 }
 
 FCollisionQueryParams UWallRunningMovementUtils::GetIgnoreOwnerQueryParams(
 	const UMoverComponent* InMoverComponent)
 {
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(InMoverComponent->GetOwner());
-
-	TArray<AActor*> ChildActors;
-	InMoverComponent->GetOwner()->GetAllChildActors(ChildActors);
-	QueryParams.AddIgnoredActors(ChildActors);
-
-	return QueryParams;
+	FBotaniMoverCollisionParams ScratchParams;
+	return UBotaniMoverComponent::FindCollisionParams(InMoverComponent, ScratchParams).QueryParams;
 }
 
 float UWallRunningMovementUtils::GetWallAngle(const FHitResult& WallHit, const FVector& UpDirection)
@@ -185,22 +477,87 @@ float UWallRunningMovementUtils::GetWallAngle(const FHitResult& WallHit, const F
 	return FMath::RadiansToDegrees(FMath::Acos(WallHit.Normal | UpDirection));
 }
 
+float UWallRunningMovementUtils::GetWallAngle(const FWallContact& Wall, const FVector& UpDirection)
+{
+	return FMath::RadiansToDegrees(FMath::Acos(Wall.GetNormal() | UpDirection));
+}
+
 bool UWallRunningMovementUtils::ShouldFallOffWall(
 	const FHitResult& WallHit,
 	const float& PullAwayAngle,
 	const FVector& MoveIntent)
 {
-	const float SinPullAwayAngle = FMath::Sin(FMath::DegreesToRadians(PullAwayAngle));
+	return ShouldFallOffWall_Sine(WallHit, FMath::Sin(FMath::DegreesToRadians(PullAwayAngle)), MoveIntent);
+}
+
+bool UWallRunningMovementUtils::ShouldFallOffWall_Sine(
+	const FHitResult& WallHit,
+	float SinPullAwayAngle,
+	const FVector& MoveIntent)
+{
 	return (WallHit.IsValidBlockingHit()
 		&& !MoveIntent.IsNearlyZero()
 		&& ((MoveIntent.GetSafeNormal() | WallHit.Normal) > SinPullAwayAngle));
 }
 
+bool UWallRunningMovementUtils::ShouldFallOffWall_Sine(
+	const FWallContact& Wall,
+	float SinPullAwayAngle,
+	const FVector& MoveIntent)
+{
+	return (!MoveIntent.IsNearlyZero()
+		&& ((MoveIntent.GetSafeNormal() | Wall.GetNormal()) > SinPullAwayAngle));
+}
+
+float UWallRunningMovementUtils::ComputeWallRunGravityScale(
+	const UBotaniWallRunMovementSettings* WallRunSettings,
+	float TangentAccel,
+	float WallRunSeconds)
+{
+	check(WallRunSettings);
+
+	const FBotaniResolvedWallRunSettings& Resolved = WallRunSettings->GetResolvedSettings();
+	return Resolved.WallRun_GravityVelScaleTable.Eval(TangentAccel) * Resolved.WallRun_GravityTimeScaleTable.Eval(WallRunSeconds);
+}
+
+void UWallRunningMovementUtils::ComputeWallRunGravityScales(
+	const UBotaniWallRunMovementSettings* WallRunSettings,
+	TConstArrayView<float> TangentAccels,
+	TConstArrayView<float> WallRunSeconds,
+	TArrayView<float> OutGravityScales)
+{
+	check(WallRunSettings);
+	check(TangentAccels.Num() == WallRunSeconds.Num() && TangentAccels.Num() == OutGravityScales.Num());
+
+	const FBotaniResolvedWallRunSettings& Resolved = WallRunSettings->GetResolvedSettings();
+
+	TArray<float, TInlineAllocator<64>> TimeScales;
+	TimeScales.SetNumUninitialized(WallRunSeconds.Num());
+
+	Resolved.WallRun_GravityVelScaleTable.EvalBatch(TangentAccels, OutGravityScales);
+	Resolved.WallRun_GravityTimeScaleTable.EvalBatch(WallRunSeconds, TimeScales);
+
+	for (int32 Index = 0; Index < OutGravityScales.Num(); Index++)
+	{
+		OutGravityScales[Index] *= TimeScales[Index];
+	}
+}
+
 bool UWallRunningMovementUtils::IsHighEnoughForWallRun(
 	const FMovingComponentSet& MovingComps,
 	float MinHeightAboveFloor,
 	const FVector& UpDirection)
 {
+	// The transitions ask this every frame, often more than once
+	FBotaniMoverQueryCache* QueryCache = UBotaniMoverComponent::FindQueryCache(MovingComps.MoverComponent.Get());
+	const FTransform& ComponentTransform = MovingComps.UpdatedComponent->GetComponentTransform();
+
+	bool bHighEnough = false;
+	if (QueryCache && QueryCache->TryGetGroundClearance(ComponentTransform, MinHeightAboveFloor, UpDirection, bHighEnough))
+	{
+		return bHighEnough;
+	}
+
 	UWorld const* World = MovingComps.MoverComponent->GetWorld();
 	check(World);
 
@@ -209,13 +566,26 @@ bool UWallRunningMovementUtils::IsHighEnoughForWallRun(
 
 	const FVector End = Start + (-UpDirection * ( MinHeightAboveFloor + Bounds.SphereRadius));
 
+	FBotaniMoverCollisionParams ScratchParams;
+	const FCollisionQueryParams& QueryParams = UBotaniMoverComponent::FindCollisionParams(MovingComps.MoverComponent.Get(), ScratchParams).QueryParams;
+
+	const UBotaniWallRunMovementSettings* Settings =
+		UBotaniMoverComponent::FindBotaniSettings<UBotaniWallRunMovementSettings>(MovingComps.MoverComponent.Get());
+	const ECollisionChannel FloorTraceChannel = Settings ? Settings->FloorTraceChannel.GetValue() : ECC_Visibility;
+
 	FHitResult GroundHit;
-	const bool bHit = World->LineTraceSingleByChannel(GroundHit, Start, End, ECC_Visibility, GetIgnoreOwnerQueryParams(MovingComps.MoverComponent.Get()));
+	const bool bHit = World->LineTraceSingleByChannel(GroundHit, Start, End, FloorTraceChannel, QueryParams);
+	UBotaniMoverQueryBudgetSubsystem::RecordQueries(MovingComps.MoverComponent.Get(), EBotaniMoverQuery::Height);
 
 #if ENABLE_DRAW_DEBUG
 	DrawDebugLine(World, Start, End, bHit ? FColor::Red : FColor::Green, false, 0.1f, 0, 1.f);
 #endif
 
+	if (QueryCache)
+	{
+		QueryCache->StoreGroundClearance(ComponentTransform, MinHeightAboveFloor, UpDirection, !bHit);
+	}
+
 	return !bHit;
 }
 
@@ -0,0 +1,107 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "Subsystems/BotaniMoverArchetypeSubsystem.h"
+
+#include "BotaniMoverLogChannels.h"
+#include "BotaniMoverStats.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMoverArchetypeSubsystem)
+
+bool UBotaniMoverArchetypeSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Editor worlds must keep their own instances, they are edited
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBotaniMoverArchetypeSubsystem::Deinitialize()
+{
+	DEC_MEMORY_STAT_BY(STAT_BotaniMover_SharedSettingsSavedMemory, TotalSavedBytes);
+	SharedSettings.Reset();
+	TotalSavedBytes = 0;
+
+	Super::Deinitialize();
+}
+
+int64 UBotaniMoverArchetypeSubsystem::ShareSettingsWithArchetype(
+	TConstArrayView<TObjectPtr<UObject>> ArchetypeSettings,
+	TArray<TObjectPtr<UObject>>& InOutSettings)
+{
+	int64 SavedBytes = 0;
+	for (TObjectPtr<UObject>& Settings : InOutSettings)
+	{
+		if (!IsValid(Settings))
+		{
+			continue;
+		}
+
+		// Find the archetype's settings of the same class
+		const TObjectPtr<UObject>* ArchetypeSettingsPtr = ArchetypeSettings.FindByPredicate([&Settings](const TObjectPtr<UObject>& Candidate)
+		{
+			return Candidate && Candidate->GetClass() == Settings->GetClass();
+		});
+
+		const UObject* ArchetypeClassSettings = ArchetypeSettingsPtr ? ArchetypeSettingsPtr->Get() : nullptr;
+		if (ArchetypeClassSettings == nullptr || ArchetypeClassSettings == Settings)
+		{
+			continue;
+		}
+
+		// Per instance overrides keep their own copy
+		TObjectPtr<UObject>& SharedInstance = SharedSettings.FindOrAdd(ArchetypeClassSettings);
+		const bool bFirstSharer = SharedInstance == nullptr;
+		if (bFirstSharer)
+		{
+			if (!AreSettingsIdentical(Settings, ArchetypeClassSettings))
+			{
+				SharedSettings.Remove(ArchetypeClassSettings);
+				continue;
+			}
+
+			// Share a copy owned by us, so no pawn's own subobject is ever handed to other pawns
+			SharedInstance = DuplicateObject<UObject>(Settings, this);
+		}
+		else if (SharedInstance == Settings || !AreSettingsIdentical(Settings, SharedInstance))
+		{
+			continue;
+		}
+
+		// The replaced instance is no longer referenced and will be collected
+		// The first sharer's instance is only swapped for our copy, it's every further pawn that saves one
+		if (!bFirstSharer)
+		{
+			SavedBytes += Settings->GetClass()->GetStructureSize();
+		}
+
+		Settings = SharedInstance;
+
+		INC_DWORD_STAT(STAT_BotaniMover_SharedSettingsInstances);
+	}
+
+	if (SavedBytes > 0)
+	{
+		TotalSavedBytes += SavedBytes;
+		INC_MEMORY_STAT_BY(STAT_BotaniMover_SharedSettingsSavedMemory, SavedBytes);
+
+		BOTANIMOVER_VERBOSE("Sharing settings saved %lld bytes for this pawn (%lld bytes total)",
+			SavedBytes, TotalSavedBytes);
+	}
+
+	return SavedBytes;
+}
+
+bool UBotaniMoverArchetypeSubsystem::AreSettingsIdentical(const UObject* A, const UObject* B)
+{
+	check(A && B && A->GetClass() == B->GetClass());
+
+	for (TFieldIterator<FProperty> PropIt(A->GetClass()); PropIt; ++PropIt)
+	{
+		if (!PropIt->Identical_InContainer(A, B, 0, PPF_DeepComparison))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
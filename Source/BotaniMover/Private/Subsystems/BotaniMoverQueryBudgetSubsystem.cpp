@@ -0,0 +1,173 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
+
+#include "BotaniMoverStats.h"
+#include "Components/BotaniMoverComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMoverQueryBudgetSubsystem)
+
+bool UBotaniMoverQueryBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBotaniMoverQueryBudgetSubsystem::RecordQueries(const EBotaniMoverQuery Query, const int32 NumQueries)
+{
+	if (NumQueries <= 0)
+	{
+		return;
+	}
+
+	BeginFrameIfNeeded();
+
+	FrameQueries[static_cast<uint8>(Query)] += NumQueries;
+	NumFrameQueries += NumQueries;
+	INC_DWORD_STAT_BY(STAT_BotaniMover_BudgetedQueries, NumQueries);
+}
+
+void UBotaniMoverQueryBudgetSubsystem::RecordQueries(const UMoverComponent* MoverComp, const EBotaniMoverQuery Query, const int32 NumQueries)
+{
+	const UWorld* World = MoverComp ? MoverComp->GetWorld() : nullptr;
+	if (UBotaniMoverQueryBudgetSubsystem* QueryBudget = World ? World->GetSubsystem<UBotaniMoverQueryBudgetSubsystem>() : nullptr)
+	{
+		QueryBudget->RecordQueries(Query, NumQueries);
+	}
+}
+
+bool UBotaniMoverQueryBudgetSubsystem::TryAcquireOptional(const UMoverComponent* MoverComp, const int32 EstimatedCost)
+{
+	BeginFrameIfNeeded();
+
+	FBotaniMoverQueryBudgetState* BudgetState = UBotaniMoverComponent::FindQueryBudgetState(MoverComp);
+	const EBotaniMoverQueryPriority Priority = GetQueryPriority(MoverComp);
+
+	// Players are never deferred, and neither is anyone who already waited long enough
+	bool bDefer = false;
+	if (QueryBudgetPerFrame > 0
+		&& Priority != EBotaniMoverQueryPriority::Player
+		&& BudgetState && BudgetState->NumDeferredFrames < MaxDeferredFrames)
+	{
+		const bool bFar = Priority == EBotaniMoverQueryPriority::Far;
+		const float Budget = bFar ? QueryBudgetPerFrame * FarBudgetShare : QueryBudgetPerFrame;
+
+		// Far pawns are spread over the frames by their address, so they don't all query on the same frame
+		const bool bOnTimeSlice = !bFar || FarQueryInterval <= 1
+			|| ((CurrentFrame + (PointerHash(MoverComp) >> 4)) % FarQueryInterval) == 0;
+
+		bDefer = !bOnTimeSlice || NumFrameQueries + EstimatedCost > Budget;
+	}
+
+	if (bDefer)
+	{
+		// A pawn may ask several times per frame, it only waited one frame though
+		if (BudgetState->LastDeferredFrame != CurrentFrame)
+		{
+			BudgetState->LastDeferredFrame = CurrentFrame;
+			++BudgetState->NumDeferredFrames;
+		}
+
+		++NumFrameDeferrals;
+		INC_DWORD_STAT(STAT_BotaniMover_DeferredQueries);
+		return false;
+	}
+
+	if (BudgetState)
+	{
+		BudgetState->NumDeferredFrames = 0;
+	}
+
+	return true;
+}
+
+bool UBotaniMoverQueryBudgetSubsystem::TryAcquireOptionalQueries(const UMoverComponent* MoverComp, const int32 EstimatedCost)
+{
+	const UWorld* World = MoverComp ? MoverComp->GetWorld() : nullptr;
+	UBotaniMoverQueryBudgetSubsystem* QueryBudget = World ? World->GetSubsystem<UBotaniMoverQueryBudgetSubsystem>() : nullptr;
+	return !QueryBudget || QueryBudget->TryAcquireOptional(MoverComp, EstimatedCost);
+}
+
+bool UBotaniMoverQueryBudgetSubsystem::TryAcquireOptionalSimQueries(const UMoverComponent* MoverComp, const double SimTimeMs, const int32 EstimatedCost)
+{
+	FBotaniMoverQueryBudgetState* BudgetState = UBotaniMoverComponent::FindQueryBudgetState(MoverComp);
+	if (!BudgetState)
+	{
+		return TryAcquireOptionalQueries(MoverComp, EstimatedCost);
+	}
+
+	// Replay the decision if we already simulated this tick
+	TArray<FBotaniMoverQueryBudgetState::FSimGrant>& SimGrants = BudgetState->SimGrants;
+	for (int32 Idx = SimGrants.Num() - 1; Idx >= 0; --Idx)
+	{
+		if (SimGrants[Idx].SimTimeMs == SimTimeMs)
+		{
+			return SimGrants[Idx].bGranted;
+		}
+	}
+
+	const bool bGranted = TryAcquireOptionalQueries(MoverComp, EstimatedCost);
+
+	// Ticks are simulated in order after a rollback, so anything past this one belongs to the discarded timeline
+	SimGrants.RemoveAll([SimTimeMs](const FBotaniMoverQueryBudgetState::FSimGrant& SimGrant) { return SimGrant.SimTimeMs > SimTimeMs; });
+	if (SimGrants.Num() >= FBotaniMoverQueryBudgetState::MaxSimGrants)
+	{
+		SimGrants.RemoveAt(0, SimGrants.Num() - FBotaniMoverQueryBudgetState::MaxSimGrants + 1, EAllowShrinking::No);
+	}
+
+	SimGrants.Add({ SimTimeMs, bGranted });
+	return bGranted;
+}
+
+EBotaniMoverQueryPriority UBotaniMoverQueryBudgetSubsystem::GetQueryPriority(const UMoverComponent* MoverComp)
+{
+	const APawn* PawnOwner = MoverComp ? MoverComp->GetOwner<APawn>() : nullptr;
+	if (PawnOwner && PawnOwner->IsPlayerControlled())
+	{
+		return EBotaniMoverQueryPriority::Player;
+	}
+
+	// The movement LOD tier already measures the distance to the nearest camera
+	const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp);
+	return BotaniMoverComp && BotaniMoverComp->GetMovementLODTier() > 0 ? EBotaniMoverQueryPriority::Far : EBotaniMoverQueryPriority::Near;
+}
+
+int32 UBotaniMoverQueryBudgetSubsystem::GetLastFrameQueries() const
+{
+	return NumLastFrameQueries;
+}
+
+int32 UBotaniMoverQueryBudgetSubsystem::GetLastFrameDeferrals() const
+{
+	return NumLastFrameDeferrals;
+}
+
+int32 UBotaniMoverQueryBudgetSubsystem::GetLastFrameQueries(const EBotaniMoverQuery Query) const
+{
+	return LastFrameQueries[static_cast<uint8>(Query)];
+}
+
+void UBotaniMoverQueryBudgetSubsystem::BeginFrameIfNeeded()
+{
+	if (CurrentFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	// Frames without any query leave nothing behind
+	const bool bConsecutiveFrame = CurrentFrame + 1 == GFrameCounter;
+	for (int32 Idx = 0; Idx < static_cast<int32>(EBotaniMoverQuery::Num); ++Idx)
+	{
+		LastFrameQueries[Idx] = bConsecutiveFrame ? FrameQueries[Idx] : 0;
+		FrameQueries[Idx] = 0;
+	}
+
+	NumLastFrameQueries = bConsecutiveFrame ? NumFrameQueries : 0;
+	NumLastFrameDeferrals = bConsecutiveFrame ? NumFrameDeferrals : 0;
+	NumFrameQueries = 0;
+	NumFrameDeferrals = 0;
+	CurrentFrame = GFrameCounter;
+}
@@ -0,0 +1,91 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "Subsystems/BotaniPhysicalMaterialSubsystem.h"
+
+#include "UObject/UObjectIterator.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniPhysicalMaterialSubsystem)
+
+UBotaniPhysicalMaterialSubsystem* UBotaniPhysicalMaterialSubsystem::Instance = nullptr;
+
+void UBotaniPhysicalMaterialSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Instance = this;
+
+	// Gather all mover physical materials that are already loaded
+	for (TObjectIterator<UPhysicalMaterial> It; It; ++It)
+	{
+		if (Cast<IBotaniMoverPhysicalMaterial>(*It) && !It->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			RegisterPhysicalMaterial(*It);
+		}
+	}
+
+#if WITH_EDITOR
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &ThisClass::OnObjectPropertyChanged);
+#endif
+}
+
+void UBotaniPhysicalMaterialSubsystem::Deinitialize()
+{
+	if (Instance == this)
+	{
+		Instance = nullptr;
+	}
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+#endif
+
+	MaterialEntries.Reset();
+
+	Super::Deinitialize();
+}
+
+const FBotaniPhysicalMaterialMovementProperties* UBotaniPhysicalMaterialSubsystem::FindMovementProperties(const UPhysicalMaterial* PhysMaterial)
+{
+	if (PhysMaterial == nullptr || Instance == nullptr)
+	{
+		return nullptr;
+	}
+
+	const TObjectKey<UPhysicalMaterial> MaterialKey(PhysMaterial);
+	const FMaterialEntry* Entry = Instance->MaterialEntries.Find(MaterialKey);
+	if (Entry == nullptr)
+	{
+		// First time we see this material
+		Instance->RegisterPhysicalMaterial(PhysMaterial);
+		Entry = Instance->MaterialEntries.Find(MaterialKey);
+	}
+
+	return (Entry && Entry->bHasProperties) ? &Entry->Properties : nullptr;
+}
+
+void UBotaniPhysicalMaterialSubsystem::RegisterPhysicalMaterial(const UPhysicalMaterial* PhysMaterial)
+{
+	if (!IsValid(PhysMaterial))
+	{
+		return;
+	}
+
+	const IBotaniMoverPhysicalMaterial* MoverPhysMat = Cast<IBotaniMoverPhysicalMaterial>(PhysMaterial);
+
+	FMaterialEntry& Entry = MaterialEntries.FindOrAdd(TObjectKey<UPhysicalMaterial>(PhysMaterial));
+	Entry.bHasProperties = MoverPhysMat != nullptr;
+	Entry.Properties = MoverPhysMat ? MoverPhysMat->GetMovementProperties() : FBotaniPhysicalMaterialMovementProperties();
+}
+
+#if WITH_EDITOR
+void UBotaniPhysicalMaterialSubsystem::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	if (const UPhysicalMaterial* PhysMaterial = Cast<UPhysicalMaterial>(Object))
+	{
+		MaterialEntries.Remove(TObjectKey<UPhysicalMaterial>(PhysMaterial));
+	}
+}
+#endif
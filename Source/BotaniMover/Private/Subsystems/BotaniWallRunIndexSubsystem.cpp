@@ -0,0 +1,348 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "Subsystems/BotaniWallRunIndexSubsystem.h"
+
+#include "BotaniMoverStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "WallRunIndex/BotaniWallRunIndexActor.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniWallRunIndexSubsystem)
+
+bool UBotaniWallRunIndexSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBotaniWallRunIndexSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Everything registered from now on is picked up by the physics state callbacks
+	for (const AActor* Actor : TActorRange<AActor>(&InWorld))
+	{
+		Actor->ForEachComponent<UPrimitiveComponent>(false, [this](UPrimitiveComponent* Component)
+		{
+			OnComponentCreatedPhysicsState(Component);
+		});
+	}
+
+	CreatePhysicsStateHandle = UActorComponent::GlobalCreatePhysicsDelegate.AddUObject(this, &ThisClass::OnComponentCreatedPhysicsState);
+	DestroyPhysicsStateHandle = UActorComponent::GlobalDestroyPhysicsDelegate.AddUObject(this, &ThisClass::OnComponentDestroyedPhysicsState);
+}
+
+void UBotaniWallRunIndexSubsystem::Deinitialize()
+{
+	UActorComponent::GlobalCreatePhysicsDelegate.Remove(CreatePhysicsStateHandle);
+	UActorComponent::GlobalDestroyPhysicsDelegate.Remove(DestroyPhysicsStateHandle);
+
+	for (TPair<TObjectKey<UPrimitiveComponent>, FDynamicComponent>& Pair : DynamicComponents)
+	{
+		if (UPrimitiveComponent* Component = Pair.Value.Component.Get())
+		{
+			Component->TransformUpdated.Remove(Pair.Value.TransformUpdatedHandle);
+		}
+	}
+
+	IndexActors.Reset();
+	DynamicComponents.Reset();
+	DynamicCells.Reset();
+	OversizedDynamicComponents.Reset();
+
+	Super::Deinitialize();
+}
+
+void UBotaniWallRunIndexSubsystem::RegisterIndex(const ABotaniWallRunIndexActor* IndexActor)
+{
+	// Unbaked indices would claim their level is free of walls
+	if (IsValid(IndexActor) && IndexActor->GetIndex().IsBaked())
+	{
+		IndexActors.AddUnique(IndexActor);
+	}
+}
+
+void UBotaniWallRunIndexSubsystem::UnregisterIndex(const ABotaniWallRunIndexActor* IndexActor)
+{
+	IndexActors.RemoveAllSwap([IndexActor](const TWeakObjectPtr<const ABotaniWallRunIndexActor>& Entry)
+	{
+		return !Entry.IsValid() || Entry.Get() == IndexActor;
+	});
+}
+
+EBotaniWallRunIndexResult UBotaniWallRunIndexSubsystem::QueryRunnableWalls(
+	const FVector& Location,
+	const float Radius,
+	const float CosMinRequiredAngle,
+	const FVector& UpDirection) const
+{
+	bool bCovered = false;
+	for (const TWeakObjectPtr<const ABotaniWallRunIndexActor>& IndexActor : IndexActors)
+	{
+		if (!IndexActor.IsValid())
+		{
+			continue;
+		}
+
+		// Levels may overlap, so any index with a wall wins
+		const FBotaniWallRunIndex& Index = IndexActor->GetIndex();
+		if (Index.HasRunnableWall(Location, Radius, CosMinRequiredAngle, UpDirection))
+		{
+			return EBotaniWallRunIndexResult::HasWall;
+		}
+
+		bCovered |= Index.Covers(Location, Radius);
+	}
+
+	return bCovered ? EBotaniWallRunIndexResult::NoWall : EBotaniWallRunIndexResult::Unknown;
+}
+
+bool UBotaniWallRunIndexSubsystem::CanSkipWallProbe(
+	const UWorld* World,
+	const FVector& Location,
+	const float Radius,
+	const ECollisionChannel WallChannel,
+	const AActor* IgnoreActor,
+	const float CosMinRequiredAngle,
+	const FVector& UpDirection)
+{
+	const UBotaniWallRunIndexSubsystem* IndexSubsystem = UWorld::GetSubsystem<UBotaniWallRunIndexSubsystem>(World);
+	if (!IndexSubsystem || IndexSubsystem->IndexActors.IsEmpty())
+	{
+		return false;
+	}
+
+	if (IndexSubsystem->QueryRunnableWalls(Location, Radius, CosMinRequiredAngle, UpDirection) != EBotaniWallRunIndexResult::NoWall)
+	{
+		return false;
+	}
+
+	// The indices only rule out static walls
+	if (IndexSubsystem->HasDynamicGeometry(Location, Radius, WallChannel, IgnoreActor))
+	{
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_BotaniMover_WallProbesSkipped);
+	return true;
+}
+
+void UBotaniWallRunIndexSubsystem::FindRunnableWalls(
+	const FVector& Location,
+	float Radius,
+	TArray<FBotaniWallPatch>& OutPatches) const
+{
+	OutPatches.Reset();
+
+	for (const TWeakObjectPtr<const ABotaniWallRunIndexActor>& IndexActor : IndexActors)
+	{
+		if (IndexActor.IsValid())
+		{
+			IndexActor->GetIndex().FindWallPatches(Location, Radius, OutPatches);
+		}
+	}
+}
+
+bool UBotaniWallRunIndexSubsystem::HasDynamicGeometry(
+	const FVector& Location,
+	const float Radius,
+	const ECollisionChannel WallChannel,
+	const AActor* IgnoreActor) const
+{
+	const float RadiusSquared = FMath::Square(Radius);
+	for (const TObjectKey<UPrimitiveComponent> Key : OversizedDynamicComponents)
+	{
+		if (IsDynamicWallNearby(Key.ResolveObjectPtr(), Location, RadiusSquared, WallChannel, IgnoreActor))
+		{
+			return true;
+		}
+	}
+
+	FIntVector MinCell, MaxCell;
+	GetCellRange(FBox::BuildAABB(Location, FVector(Radius)), MinCell, MaxCell);
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const FDynamicCell* Cell = DynamicCells.Find(FIntVector(X, Y, Z));
+				if (!Cell)
+				{
+					continue;
+				}
+
+				for (const TObjectKey<UPrimitiveComponent> Key : *Cell)
+				{
+					if (IsDynamicWallNearby(Key.ResolveObjectPtr(), Location, RadiusSquared, WallChannel, IgnoreActor))
+					{
+						return true;
+					}
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+bool UBotaniWallRunIndexSubsystem::IsDynamicWallNearby(
+	const UPrimitiveComponent* Component,
+	const FVector& Location,
+	const float RadiusSquared,
+	const ECollisionChannel WallChannel,
+	const AActor* IgnoreActor)
+{
+	// Collision may be changed at any time, so it's only checked here
+	return Component
+		&& Component->GetOwner() != IgnoreActor
+		&& Component->IsQueryCollisionEnabled()
+		&& Component->GetCollisionResponseToChannel(WallChannel) == ECR_Block
+		&& FMath::SphereAABBIntersection(Location, RadiusSquared, Component->Bounds.GetBox());
+}
+
+void UBotaniWallRunIndexSubsystem::GetCellRange(const FBox& Box, FIntVector& OutMinCell, FIntVector& OutMaxCell)
+{
+	const FVector MinCell = (Box.Min / DynamicCellSize).GetFloor();
+	const FVector MaxCell = (Box.Max / DynamicCellSize).GetFloor();
+
+	OutMinCell = FIntVector(MinCell.X, MinCell.Y, MinCell.Z);
+	OutMaxCell = FIntVector(MaxCell.X, MaxCell.Y, MaxCell.Z);
+}
+
+void UBotaniWallRunIndexSubsystem::OnComponentCreatedPhysicsState(UActorComponent* Component)
+{
+	UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component);
+	if (!Primitive || Primitive->GetWorld() != GetWorld())
+	{
+		return;
+	}
+
+	// The mobility may have changed since we last saw it, so start over
+	UntrackDynamicComponent(Primitive);
+
+	if (Primitive->Mobility != EComponentMobility::Static)
+	{
+		TrackDynamicComponent(Primitive);
+	}
+}
+
+void UBotaniWallRunIndexSubsystem::OnComponentDestroyedPhysicsState(UActorComponent* Component)
+{
+	if (Component && Component->GetWorld() == GetWorld())
+	{
+		UntrackDynamicComponent(Component);
+	}
+}
+
+void UBotaniWallRunIndexSubsystem::OnDynamicComponentTransformUpdated(
+	USceneComponent* Component,
+	EUpdateTransformFlags UpdateTransformFlags,
+	ETeleportType Teleport)
+{
+	const TObjectKey<UPrimitiveComponent> Key(Cast<UPrimitiveComponent>(Component));
+	if (FDynamicComponent* Entry = DynamicComponents.Find(Key))
+	{
+		HashDynamicComponent(Key, *Entry);
+	}
+}
+
+void UBotaniWallRunIndexSubsystem::TrackDynamicComponent(UPrimitiveComponent* Component)
+{
+	const TObjectKey<UPrimitiveComponent> Key(Component);
+
+	FDynamicComponent& Entry = DynamicComponents.Add(Key);
+	Entry.Component = Component;
+	Entry.TransformUpdatedHandle = Component->TransformUpdated.AddUObject(this, &ThisClass::OnDynamicComponentTransformUpdated);
+
+	HashDynamicComponent(Key, Entry);
+}
+
+void UBotaniWallRunIndexSubsystem::UntrackDynamicComponent(const UActorComponent* Component)
+{
+	const TObjectKey<UPrimitiveComponent> Key(Cast<UPrimitiveComponent>(Component));
+
+	FDynamicComponent Entry;
+	if (!DynamicComponents.RemoveAndCopyValue(Key, Entry))
+	{
+		return;
+	}
+
+	if (UPrimitiveComponent* Primitive = Entry.Component.Get())
+	{
+		Primitive->TransformUpdated.Remove(Entry.TransformUpdatedHandle);
+	}
+
+	UnhashDynamicComponent(Key, Entry);
+}
+
+void UBotaniWallRunIndexSubsystem::HashDynamicComponent(const TObjectKey<UPrimitiveComponent> Key, FDynamicComponent& Entry)
+{
+	const UPrimitiveComponent* Component = Entry.Component.Get();
+	if (!Component)
+	{
+		return;
+	}
+
+	FIntVector MinCell, MaxCell;
+	GetCellRange(Component->Bounds.GetBox(), MinCell, MaxCell);
+
+	// Most moves stay within their cells
+	if (MinCell == Entry.MinCell && MaxCell == Entry.MaxCell)
+	{
+		return;
+	}
+
+	UnhashDynamicComponent(Key, Entry);
+
+	const FIntVector NumCells = MaxCell - MinCell + FIntVector(1);
+	if (static_cast<int64>(NumCells.X) * NumCells.Y * NumCells.Z > MaxDynamicCellsPerComponent)
+	{
+		OversizedDynamicComponents.Add(Key);
+		return;
+	}
+
+	Entry.MinCell = MinCell;
+	Entry.MaxCell = MaxCell;
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				DynamicCells.FindOrAdd(FIntVector(X, Y, Z)).Add(Key);
+			}
+		}
+	}
+}
+
+void UBotaniWallRunIndexSubsystem::UnhashDynamicComponent(const TObjectKey<UPrimitiveComponent> Key, FDynamicComponent& Entry)
+{
+	OversizedDynamicComponents.RemoveSwap(Key);
+
+	for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+	{
+		for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+		{
+			for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+			{
+				const FIntVector CellKey(X, Y, Z);
+				if (FDynamicCell* Cell = DynamicCells.Find(CellKey))
+				{
+					Cell->RemoveSwap(Key);
+					if (Cell->IsEmpty())
+					{
+						DynamicCells.Remove(CellKey);
+					}
+				}
+			}
+		}
+	}
+
+	Entry.MinCell = FIntVector::ZeroValue;
+	Entry.MaxCell = FIntVector(-1);
+}
@@ -0,0 +1,74 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "MoveLibrary/BotaniCurveLookupTable.h"
+
+#include "Curves/RichCurve.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBotaniCurveLookupTableTest, "BotaniMover.CurveLookupTable",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBotaniCurveLookupTableTest::RunTest(const FString& Parameters)
+{
+	// The baked table linearly interpolates between its samples, so it only matches the cubic curve within a tolerance
+	constexpr float Tolerance = 0.01f;
+
+	FRichCurve Curve;
+	Curve.AddKey(0.f, 0.f);
+	Curve.AddKey(0.4f, 1.f);
+	Curve.AddKey(1.f, 0.5f);
+	Curve.AddKey(2.f, 2.f);
+	for (auto KeyIt = Curve.GetKeyHandleIterator(); KeyIt; ++KeyIt)
+	{
+		Curve.SetKeyInterpMode(*KeyIt, RCIM_Cubic);
+	}
+
+	FBotaniCurveLookupTable Table;
+	Table.Bake(&Curve, -1.f);
+	TestTrue(TEXT("Table has data"), Table.HasData());
+
+	// Inputs outside of the key range are clamped to the first and last key
+	TestNearlyEqual(TEXT("Clamped before the first key"), Table.Eval(-5.f), Curve.Eval(-5.f), Tolerance);
+	TestNearlyEqual(TEXT("Clamped after the last key"), Table.Eval(5.f), Curve.Eval(5.f), Tolerance);
+
+	// Interior keys
+	for (const FRichCurveKey& Key : Curve.GetConstRefOfKeys())
+	{
+		TestNearlyEqual(FString::Printf(TEXT("Key at %.2f"), Key.Time), Table.Eval(Key.Time), Key.Value, Tolerance);
+	}
+
+	// Dense sweep over the key range, plus a bit of either side, with a count that leaves a scalar tail in the batch
+	TArray<float> Times;
+	for (int32 Index = 0; Index < 203; Index++)
+	{
+		Times.Add(-0.25f + Index * 0.0125f);
+	}
+
+	TArray<float> BatchValues;
+	BatchValues.SetNumUninitialized(Times.Num());
+	Table.EvalBatch(Times, BatchValues);
+
+	for (int32 Index = 0; Index < Times.Num(); Index++)
+	{
+		const float Time = Times[Index];
+		TestNearlyEqual(FString::Printf(TEXT("Eval at %.4f"), Time), Table.Eval(Time), Curve.Eval(Time), Tolerance);
+		TestNearlyEqual(FString::Printf(TEXT("EvalBatch at %.4f"), Time), BatchValues[Index], Table.Eval(Time), UE_KINDA_SMALL_NUMBER);
+	}
+
+	// Empty curves always return the default value, on both paths
+	FRichCurve EmptyCurve;
+	FBotaniCurveLookupTable EmptyTable;
+	EmptyTable.Bake(&EmptyCurve, 3.f);
+	TestFalse(TEXT("Empty table has no data"), EmptyTable.HasData());
+	TestEqual(TEXT("Empty table returns the default value"), EmptyTable.Eval(1.f), 3.f);
+
+	EmptyTable.EvalBatch(Times, BatchValues);
+	TestEqual(TEXT("Empty table batch returns the default value"), BatchValues[Times.Num() - 1], 3.f);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,98 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMovementSettingsModifierStack.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBotaniMovementSettingsModifierHistoryTest, "BotaniMover.MovementSettingsModifierHistory",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBotaniMovementSettingsModifierHistoryTest::RunTest(const FString& Parameters)
+{
+	static const FName SourceA(TEXT("A"));
+	static const FName SourceB(TEXT("B"));
+	const FBotaniMovementSettingsDelta Delta(TEXT("MaxSpeed"), EBotaniSettingsModifierOp::Multiply, 0.5f);
+
+	FBotaniMovementSettingsModifierStack StackA;
+	StackA.Push(SourceA, MakeArrayView(&Delta, 1));
+
+	FBotaniMovementSettingsModifierStack StackAB = StackA;
+	StackAB.Push(SourceB, MakeArrayView(&Delta, 1));
+
+	FBotaniMovementSettingsModifierStack StackB;
+	StackB.Push(SourceB, MakeArrayView(&Delta, 1));
+
+	// Each state is in effect from its time until the next one, restoring drops everything later
+	{
+		FBotaniMovementSettingsModifierHistory History;
+		History.Record(100.0, StackA, 1000.0);
+		History.Record(200.0, StackAB, 1000.0);
+		History.Record(300.0, StackB, 1000.0);
+
+		FBotaniMovementSettingsModifierStack Stack;
+		TestTrue(TEXT("Restores between the second and third state"), History.Restore(250.0, Stack));
+		TestTrue(TEXT("Second state has A"), Stack.Contains(SourceA));
+		TestTrue(TEXT("Second state has B"), Stack.Contains(SourceB));
+
+		TestTrue(TEXT("Restores at the exact time of the first state"), History.Restore(100.0, Stack));
+		TestTrue(TEXT("First state has A"), Stack.Contains(SourceA));
+		TestFalse(TEXT("First state has no B"), Stack.Contains(SourceB));
+
+		// Nothing was dropped yet, so the stack was empty before the first state
+		TestTrue(TEXT("Restores before the first state"), History.Restore(50.0, Stack));
+		TestTrue(TEXT("Stack is empty before the first state"), Stack.IsEmpty());
+	}
+
+	// Recording at the same time replaces the state
+	{
+		FBotaniMovementSettingsModifierHistory History;
+		History.Record(100.0, StackA, 1000.0);
+		History.Record(100.0, StackB, 1000.0);
+
+		FBotaniMovementSettingsModifierStack Stack;
+		TestTrue(TEXT("Restores the replaced state"), History.Restore(100.0, Stack));
+		TestFalse(TEXT("Replaced state has no A"), Stack.Contains(SourceA));
+		TestTrue(TEXT("Replaced state has B"), Stack.Contains(SourceB));
+	}
+
+	// States older than MaxAgeMs are dropped, but the one in effect at the start of the window is kept
+	{
+		FBotaniMovementSettingsModifierHistory History;
+		History.Record(0.0, StackA, 100.0);
+		History.Record(50.0, StackAB, 100.0);
+		History.Record(200.0, StackB, 100.0);
+
+		FBotaniMovementSettingsModifierStack Stack;
+		TestTrue(TEXT("Restores at the start of the window"), History.Restore(100.0, Stack));
+		TestTrue(TEXT("State in effect at the window start has A"), Stack.Contains(SourceA));
+		TestTrue(TEXT("State in effect at the window start has B"), Stack.Contains(SourceB));
+
+		Stack = StackB;
+		TestFalse(TEXT("Doesn't restore before the dropped state"), History.Restore(20.0, Stack));
+		TestFalse(TEXT("Failed restore leaves the stack untouched"), Stack.Contains(SourceA));
+		TestTrue(TEXT("Failed restore leaves the stack untouched"), Stack.Contains(SourceB));
+	}
+
+	// The snapshot cap drops the oldest states even inside the window
+	{
+		FBotaniMovementSettingsModifierHistory History;
+		for (int32 Index = 0; Index <= FBotaniMovementSettingsModifierHistory::MaxSnapshots; Index++)
+		{
+			History.Record(Index, (Index % 2) ? StackA : StackB, 1.0e6);
+		}
+
+		FBotaniMovementSettingsModifierStack Stack;
+		TestFalse(TEXT("Capped history doesn't reach the first state"), History.Restore(0.0, Stack));
+
+		History.Reset();
+		TestTrue(TEXT("Reset history restores the empty stack"), History.Restore(0.0, Stack));
+		TestTrue(TEXT("Reset history restores the empty stack"), Stack.IsEmpty());
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,75 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverQueryCache.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBotaniMoverQueryCacheTest, "BotaniMover.QueryCache",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBotaniMoverQueryCacheTest::RunTest(const FString& Parameters)
+{
+	const FTransform Transform(FRotator(0.f, 45.f, 0.f), FVector(100.f, 200.f, 300.f));
+
+	FBotaniMoverQueryCache Cache;
+	Cache.BeginFrame(1);
+
+	FFloorCheckResult Floor;
+	Floor.bBlockingHit = true;
+	Floor.bWalkableFloor = true;
+	Floor.FloorDist = 1.5f;
+
+	FFloorCheckResult CachedFloor;
+	TestFalse(TEXT("Empty cache misses"), Cache.TryGetFloor(Transform, 10.f, 0.7f, CachedFloor));
+
+	Cache.StoreFloor(Transform, 10.f, 0.7f, Floor);
+	TestTrue(TEXT("Same transform and params hit"), Cache.TryGetFloor(Transform, 10.f, 0.7f, CachedFloor));
+	TestEqual(TEXT("Hit returns the stored floor"), CachedFloor.FloorDist, Floor.FloorDist);
+
+	// Every part of the key has to match
+	FTransform MovedTransform = Transform;
+	MovedTransform.AddToTranslation(FVector(0.01f, 0.f, 0.f));
+	TestFalse(TEXT("Moved location misses"), Cache.TryGetFloor(MovedTransform, 10.f, 0.7f, CachedFloor));
+
+	FTransform RotatedTransform = Transform;
+	RotatedTransform.SetRotation(FQuat(FRotator(0.f, 46.f, 0.f)));
+	TestFalse(TEXT("Rotated transform misses"), Cache.TryGetFloor(RotatedTransform, 10.f, 0.7f, CachedFloor));
+
+	TestFalse(TEXT("Other sweep distance misses"), Cache.TryGetFloor(Transform, 20.f, 0.7f, CachedFloor));
+	TestFalse(TEXT("Other slope misses"), Cache.TryGetFloor(Transform, 10.f, 0.5f, CachedFloor));
+
+	// Query kinds don't share entries, even with the same numbers
+	FWallProbeResult Probe;
+	TestFalse(TEXT("Wall probe isn't answered by the floor"), Cache.TryGetWallProbe(Transform, 10.f, 0.7f, Wall_Left, Probe));
+
+	Cache.StoreWallProbe(Transform, 10.f, 5.f, Wall_Left, Probe);
+	TestTrue(TEXT("Wall probe on the same side hits"), Cache.TryGetWallProbe(Transform, 10.f, 5.f, Wall_Left, Probe));
+	TestFalse(TEXT("Wall probe on the other side misses"), Cache.TryGetWallProbe(Transform, 10.f, 5.f, Wall_Right, Probe));
+
+	bool bHighEnough = false;
+	Cache.StoreGroundClearance(Transform, 50.f, FVector::UpVector, true);
+	TestTrue(TEXT("Ground clearance hits"), Cache.TryGetGroundClearance(Transform, 50.f, FVector::UpVector, bHighEnough));
+	TestTrue(TEXT("Ground clearance returns the stored result"), bHighEnough);
+	TestFalse(TEXT("Other up direction misses"), Cache.TryGetGroundClearance(Transform, 50.f, FVector::DownVector, bHighEnough));
+
+	// Hits and misses are counted
+	TestEqual(TEXT("Hit count"), Cache.GetNumHits(), static_cast<uint64>(3));
+	TestEqual(TEXT("Miss count"), Cache.GetNumMisses(), static_cast<uint64>(8));
+
+	// A new frame drops everything of the previous one
+	Cache.BeginFrame(2);
+	TestEqual(TEXT("Frame is tracked"), Cache.GetSimFrame(), 2);
+	TestFalse(TEXT("Floor is dropped with the frame"), Cache.TryGetFloor(Transform, 10.f, 0.7f, CachedFloor));
+	TestFalse(TEXT("Wall probe is dropped with the frame"), Cache.TryGetWallProbe(Transform, 10.f, 5.f, Wall_Left, Probe));
+
+	Cache.StoreFloor(Transform, 10.f, 0.7f, Floor);
+	Cache.Invalidate();
+	TestFalse(TEXT("Invalidate drops the floor"), Cache.TryGetFloor(Transform, 10.f, 0.7f, CachedFloor));
+
+	return true;
+}
+
+#endif
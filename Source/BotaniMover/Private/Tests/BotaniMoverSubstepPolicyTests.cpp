@@ -0,0 +1,49 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverSubstepPolicy.h"
+
+#include "Misc/AutomationTest.h"
+#include "MoverSimulationTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBotaniMoverSubstepPolicyTest, "BotaniMover.SubstepPolicy",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBotaniMoverSubstepPolicyTest::RunTest(const FString& Parameters)
+{
+	constexpr float ShapeRadius = 40.f;
+
+	FBotaniMoverSubstepPolicy Policy;
+	Policy.MaxSubsteps = 4;
+	Policy.MaxSubstepDistanceFactor = 1.f;
+
+	// One sub-step per shape radius of distance, rounded up
+	TestEqual(TEXT("Standing still is a single step"), Policy.ComputeNumSubsteps(0.f, ShapeRadius), 1);
+	TestEqual(TEXT("Short moves are a single step"), Policy.ComputeNumSubsteps(30.f, ShapeRadius), 1);
+	TestEqual(TEXT("Exactly one radius is a single step"), Policy.ComputeNumSubsteps(40.f, ShapeRadius), 1);
+	TestEqual(TEXT("Just over one radius is split in two"), Policy.ComputeNumSubsteps(41.f, ShapeRadius), 2);
+	TestEqual(TEXT("Three radii are three steps"), Policy.ComputeNumSubsteps(120.f, ShapeRadius), 3);
+	TestEqual(TEXT("Long moves are clamped to MaxSubsteps"), Policy.ComputeNumSubsteps(10000.f, ShapeRadius), 4);
+
+	// The distance factor scales the distance a single sub-step may cover
+	Policy.MaxSubstepDistanceFactor = 0.5f;
+	TestEqual(TEXT("Half the radius per sub-step"), Policy.ComputeNumSubsteps(41.f, ShapeRadius), 3);
+
+	// Degenerate shapes split as far as allowed instead of dividing by zero
+	TestEqual(TEXT("Zero radius is clamped"), Policy.ComputeNumSubsteps(1.f, 0.f), 4);
+
+	Policy.MaxSubsteps = 1;
+	TestEqual(TEXT("A single sub-step disables splitting"), Policy.ComputeNumSubsteps(10000.f, ShapeRadius), 1);
+
+	// Without a mover component there is nothing to split by
+	Policy.MaxSubsteps = 4;
+	FMoverTimeStep TimeStep;
+	TimeStep.StepMs = 16.f;
+	TestEqual(TEXT("No mover component simulates the full step"), Policy.ComputeSubstepMs(FMoverTickStartData(), TimeStep, nullptr), 16.f);
+
+	return true;
+}
+
+#endif
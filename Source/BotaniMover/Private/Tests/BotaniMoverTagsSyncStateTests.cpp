@@ -0,0 +1,88 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "BotaniMoverTagsSyncState.h"
+
+#include "BotaniMoverSettings.h"
+#include "BotaniMoverTags.h"
+#include "Misc/AutomationTest.h"
+#include "MoverSimulationTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBotaniMoverTagBitsTest, "BotaniMover.TagBits",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBotaniMoverTagBitsTest::RunTest(const FString& Parameters)
+{
+	using namespace BotaniMover;
+	using namespace BotaniGameplayTags::Mover;
+
+	// Every bit maps to its own tag and back
+	uint16 AllBits = TagBits::None;
+	for (int32 BitIndex = 0; BitIndex < TagBits::NumBits; BitIndex++)
+	{
+		const FGameplayTag Tag = TagBits::GetBitTag(BitIndex);
+		TestTrue(FString::Printf(TEXT("Bit %d has a tag"), BitIndex), Tag.IsValid());
+		TestEqual(FString::Printf(TEXT("Bit %d round trips"), BitIndex), TagBits::GetTagBit(Tag), static_cast<uint16>(1 << BitIndex));
+
+		AllBits |= TagBits::GetTagBit(Tag);
+	}
+
+	TestEqual(TEXT("Bits don't overlap"), AllBits, static_cast<uint16>((1 << TagBits::NumBits) - 1));
+	TestEqual(TEXT("Walking bit"), TagBits::GetTagBit(Modes::TAG_MM_Walking), TagBits::Walking);
+	TestEqual(TEXT("WallRunning bit"), TagBits::GetTagBit(Modes::TAG_MM_WallRunning), TagBits::WallRunning);
+	TestEqual(TEXT("CannotMove bit"), TagBits::GetTagBit(Restrictions::TAG_Restriction_CannotMove), TagBits::CannotMove);
+	TestEqual(TEXT("Foreign tags have no bit"), TagBits::GetTagBit(Mover_IsFat), TagBits::None);
+	TestEqual(TEXT("Invalid tags have no bit"), TagBits::GetTagBit(FGameplayTag()), TagBits::None);
+
+	FGameplayTagContainer Tags;
+	Tags.AddTag(Modes::TAG_MM_Sprinting);
+	Tags.AddTag(Modes::TAG_MM_Crouching);
+	TestEqual(TEXT("Container bits"), TagBits::GetTagBits(Tags), static_cast<uint16>(TagBits::Sprinting | TagBits::Crouching));
+
+	// Compiled masks
+	FBotaniCompiledTagMask EmptyMask;
+	EmptyMask.Compile(FGameplayTagContainer());
+	TestTrue(TEXT("Empty container compiles empty"), EmptyMask.IsEmpty());
+	TestTrue(TEXT("Empty container is mask only"), EmptyMask.IsMaskOnly());
+
+	FBotaniCompiledTagMask Mask;
+	Mask.Compile(Tags);
+	TestFalse(TEXT("Mask isn't empty"), Mask.IsEmpty());
+	TestTrue(TEXT("Native tags are mask only"), Mask.IsMaskOnly());
+	TestEqual(TEXT("Mask bits"), Mask.GetMask(), static_cast<uint16>(TagBits::Sprinting | TagBits::Crouching));
+
+	FGameplayTagContainer MixedTags = Tags;
+	MixedTags.AddTag(Mover_IsFat);
+	FBotaniCompiledTagMask MixedMask;
+	MixedMask.Compile(MixedTags);
+	TestFalse(TEXT("Foreign tags can't be mask only"), MixedMask.IsMaskOnly());
+
+	// Movement tag checks against the sync state
+	FMoverSyncState SyncState;
+	FBotaniMoverTagsSyncState& TagBitsState = SyncState.SyncStateCollection.FindOrAddMutableDataByType<FBotaniMoverTagsSyncState>();
+	TagBitsState.SetTagBits(TagBits::Sprinting, TagBits::Walking);
+
+	TestTrue(TEXT("Has any movement or mode bit"), TagBitsState.HasAnyTagBits(TagBits::Walking));
+	TestFalse(TEXT("Doesn't have unset bits"), TagBitsState.HasAnyTagBits(TagBits::Falling | TagBits::Grappling));
+	TestTrue(TEXT("Has any of the movement tags"), FBotaniMoverTagsSyncState::HasAnyMovementTags(SyncState, Mask, Tags));
+	TestFalse(TEXT("Doesn't have all of the movement tags"), FBotaniMoverTagsSyncState::HasAllMovementTags(SyncState, Mask, Tags));
+
+	// Mode tags aren't movement tags
+	FGameplayTagContainer WalkingTags;
+	WalkingTags.AddTag(Modes::TAG_MM_Walking);
+	FBotaniCompiledTagMask WalkingMask;
+	WalkingMask.Compile(WalkingTags);
+	TestFalse(TEXT("Mode bits aren't movement tags"), FBotaniMoverTagsSyncState::HasAnyMovementTags(SyncState, WalkingMask, WalkingTags));
+
+	TagBitsState.SetTagBits(TagBits::Sprinting | TagBits::Crouching, TagBits::None);
+	TestTrue(TEXT("Has all of the movement tags"), FBotaniMoverTagsSyncState::HasAllMovementTags(SyncState, Mask, Tags));
+
+	// Without the gameplay tags sync state to fall back to, foreign tags are never found
+	TestFalse(TEXT("Foreign tags need the tags sync state"), FBotaniMoverTagsSyncState::HasAllMovementTags(SyncState, MixedMask, MixedTags));
+
+	return true;
+}
+
+#endif
@@ -8,7 +8,7 @@
 #include "MoverComponent.h"
 #include "MoverSimulationTypes.h"
 #include "Abilities/GameplayAbilityTypes.h"
-#include "MoveLibrary/MoverBlackboard.h"
+#include "Components/BotaniMoverComponent.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMMT_Base)
@@ -20,12 +20,10 @@ UBotaniMMT_Base::UBotaniMMT_Base(const FObjectInitializer& ObjectInitializer)
 
 void UBotaniMMT_Base::Trigger_Implementation(const FSimulationTickParams& Params)
 {
-	// Get the blackboard
-	UMoverBlackboard* SimBlackboard = Params.MovingComps.MoverComponent->GetSimBlackboard_Mutable();
-	if (IsValid(SimBlackboard) && BlackboardTimeLoggingKey != NAME_None)
+	// Record the trigger time
+	if (TriggerTimer != EBotaniMoverTimer::None)
 	{
-		// Save the last time into the blackboard
-		SimBlackboard->Set<float>(BlackboardTimeLoggingKey, Params.TimeStep.BaseSimTimeMs);
+		UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), TriggerTimer, Params.TimeStep.BaseSimTimeMs);
 	}
 
 	// Send the trigger event
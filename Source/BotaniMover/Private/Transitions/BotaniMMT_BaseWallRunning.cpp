@@ -3,8 +3,13 @@
 
 #include "Transitions/BotaniMMT_BaseWallRunning.h"
 
+#include "BotaniMoverStats.h"
 #include "BotaniWallRunMovementSettings.h"
 #include "MoverComponent.h"
+#include "MoverSimulationTypes.h"
+#include "Components/BotaniMoverComponent.h"
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
+#include "Subsystems/BotaniWallRunIndexSubsystem.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniMMT_BaseWallRunning)
@@ -20,7 +25,7 @@ void UBotaniMMT_BaseWallRunning::OnRegistered()
 	Super::OnRegistered();
 
 	// Get the settings
-	BotaniWallRunSettings = GetMoverComponent()->FindSharedSettings<UBotaniWallRunMovementSettings>();
+	BotaniWallRunSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniWallRunMovementSettings>(GetMoverComponent());
 	ensureMsgf(BotaniWallRunSettings, TEXT("Failed to find instance of UBotaniWallRunMovementSettings on %s. Movement won't function properly!"),
 		*GetPathNameSafe(this));
 }
@@ -35,23 +40,128 @@ void UBotaniMMT_BaseWallRunning::OnUnregistered()
 
 bool UBotaniMMT_BaseWallRunning::CanStartWallRunning(
 	const FSimulationTickParams& Params,
-	FHitResult& OutHitResult) const
+	FWallContact& OutWall) const
 {
-	// Start by resetting whatever is in the hit result
-	OutHitResult.Reset(1.f, false);
-
-	// Trace for walls to run on
-	FHitResult WallHit;
-	const bool bHitWall = UWallRunningMovementUtils::PerformWallTrace(
-		Params.MovingComps,
-		WallHit,
+	// Start by resetting whatever is in the contact
+	OutWall.Reset();
+
+	// Don't probe at all if the baked wall run index knows there is no wall around us
+	const UMoverComponent* MoverComp = Params.MovingComps.MoverComponent.Get();
+	const float ProbeRadius = FMath::Sqrt(
+		FMath::Square(BotaniWallRunSettings->WallTraceVectorsHeadDelta) + FMath::Square(BotaniWallRunSettings->WallTraceVectorsTailDelta));
+	if (UBotaniWallRunIndexSubsystem::CanSkipWallProbe(MoverComp->GetWorld(), Params.MovingComps.UpdatedComponent->GetComponentLocation(), ProbeRadius,
+		BotaniWallRunSettings->WallTraceChannel, MoverComp->GetOwner(), GetBotaniWallRunFloatProp(WallRun_MinRequiredAngleCosine), MoverComp->GetUpDirection()))
+	{
+		return false;
+	}
+
+	// Probe both sides for walls to run on
+	FWallProbeResult ProbeResult;
+	const bool bHitWall = UWallRunningMovementUtils::ProbeWalls(
+		MoverComp,
+		ProbeResult,
 		BotaniWallRunSettings->WallTraceVectorsHeadDelta,
 		BotaniWallRunSettings->WallTraceVectorsTailDelta);
 
 	if (bHitWall)
 	{
-		OutHitResult = WallHit;
+		OutWall = *ProbeResult.GetClosestWall();
 	}
 
 	return bHitWall;
 }
+
+bool UBotaniMMT_BaseWallRunning::TryGetWallFromPlane(
+	const FSimulationTickParams& Params,
+	FWallContact& OutWall) const
+{
+	if (!BotaniWallRunSettings->bUseWallPlane)
+	{
+		return false;
+	}
+
+	UMoverBlackboard* SimBlackboard = Params.MovingComps.MoverComponent->GetSimBlackboard_Mutable();
+	FBotaniWallPlane WallPlane;
+	if (!IsValid(SimBlackboard)
+		|| !SimBlackboard->TryGet<FBotaniWallPlane>(BotaniMover::Blackboard::LastWallPlane, WallPlane)
+		|| !WallPlane.IsValid()
+		|| WallPlane.HasWallMoved())
+	{
+		return false;
+	}
+
+	// Probe again every now and then, so we notice changes the plane can't tell us about
+	if ((Params.TimeStep.BaseSimTimeMs - WallPlane.GetCaptureSimTimeMs()) >= BotaniWallRunSettings->WallPlaneRevalidationInterval * 1000.f)
+	{
+		return false;
+	}
+
+	// The probe would no longer reach the wall
+	const FVector Location = Params.MovingComps.UpdatedComponent->GetComponentLocation();
+	const float WallDistance = WallPlane.GetDistance(Location);
+	if (WallDistance <= 0.f || WallDistance > BotaniWallRunSettings->WallTraceVectorsHeadDelta)
+	{
+		return false;
+	}
+
+	// Keep the body and the floor clearance away from the upper and lower edges
+	const UPrimitiveComponent* UpdatedPrimitive = Params.MovingComps.UpdatedPrimitive.Get();
+	const float PawnHalfHeight = UpdatedPrimitive ? UpdatedPrimitive->GetCollisionShape().GetExtent().Z : 0.f;
+	const FVector2D EdgeMargin(
+		BotaniWallRunSettings->WallPlaneEdgeMargin,
+		BotaniWallRunSettings->WallPlaneEdgeMargin + PawnHalfHeight + GetBotaniWallRunFloatProp(WallRun_MinRequiredDynamicHeight));
+	if (WallPlane.IsNearEdge(WallPlane.ToWallSpace(Location), EdgeMargin))
+	{
+		return false;
+	}
+
+	// Confirm the wall is still behind us once we moved further than our own width along it
+	const FVector ContactPoint = Location - WallPlane.GetNormal() * WallDistance;
+	const float PawnRadius = UpdatedPrimitive ? UpdatedPrimitive->GetCollisionShape().GetExtent().X : 0.f;
+	if (FVector::DistSquared(ContactPoint, WallPlane.GetConfirmedContactPoint()) > FMath::Square(PawnRadius))
+	{
+		const UMoverComponent* MoverComp = Params.MovingComps.MoverComponent.Get();
+		const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BotaniWallPlaneContact), false, MoverComp->GetOwner());
+
+		// Trace a little past the plane, the wall only has to be planar within a centimeter of it
+		FHitResult ContactHit;
+		const bool bHitWall = MoverComp->GetWorld()->LineTraceSingleByChannel(
+			ContactHit,
+			Location,
+			ContactPoint - WallPlane.GetNormal() * 2.f,
+			BotaniWallRunSettings->WallTraceChannel,
+			QueryParams);
+		UBotaniMoverQueryBudgetSubsystem::RecordQueries(MoverComp, EBotaniMoverQuery::Wall);
+
+		if (!bHitWall || ContactHit.GetComponent() != WallPlane.GetComponent())
+		{
+			return false;
+		}
+
+		WallPlane.SetConfirmedContactPoint(ContactPoint);
+		SimBlackboard->Set<FBotaniWallPlane>(BotaniMover::Blackboard::LastWallPlane, WallPlane);
+	}
+
+	INC_DWORD_STAT(STAT_BotaniMover_WallPlaneReuses);
+
+	OutWall = WallPlane.MakeContact(Location);
+	return true;
+}
+
+void UBotaniMMT_BaseWallRunning::CaptureWallPlane(
+	const FSimulationTickParams& Params,
+	const FWallContact& Wall) const
+{
+	UMoverBlackboard* SimBlackboard = Params.MovingComps.MoverComponent->GetSimBlackboard_Mutable();
+	if (!BotaniWallRunSettings->bUseWallPlane || !IsValid(SimBlackboard))
+	{
+		return;
+	}
+
+	FBotaniWallPlane WallPlane;
+	WallPlane.Capture(Wall, Params.MovingComps.MoverComponent->GetUpDirection(), Params.TimeStep.BaseSimTimeMs,
+		BotaniWallRunSettings->WallPlanePlanarityProbeDistance);
+
+	// Invalid planes are stored too, so a stale plane is never used
+	SimBlackboard->Set<FBotaniWallPlane>(BotaniMover::Blackboard::LastWallPlane, WallPlane);
+}
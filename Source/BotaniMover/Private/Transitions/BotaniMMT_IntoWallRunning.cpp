@@ -4,10 +4,11 @@
 #include "Transitions/BotaniMMT_IntoWallRunning.h"
 
 #include "BotaniMoverLogChannels.h"
+#include "BotaniMoverTagsSyncState.h"
 #include "BotaniMoverVLogHelpers.h"
 #include "BotaniWallRunMovementSettings.h"
-#include "GameplayTagSyncState.h"
 #include "MoverComponent.h"
+#include "Components/BotaniMoverComponent.h"
 #include "Library/CommonMovementCheckUtils.h"
 
 
@@ -16,7 +17,7 @@
 UBotaniMMT_IntoWallRunning::UBotaniMMT_IntoWallRunning(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	BlackboardTimeLoggingKey = BotaniMover::Blackboard::LastWallRunStartTime;
+	TriggerTimer = EBotaniMoverTimer::LastWallRunStart;
 #if WITH_EDITORONLY_DATA
 	bShouldCreateVisLogEntry = true;
 #endif
@@ -35,6 +36,13 @@ FTransitionEvalResult UBotaniMMT_IntoWallRunning::Evaluate_Implementation(
 		return NoTransition;
 	}
 
+	// Lower movement LOD tiers skip the optional wall run transition
+	const FBotaniMoverLODTier* LODTier = UBotaniMoverComponent::FindSimulationLODTier(Params.MovingComps.MoverComponent.Get());
+	if (LODTier && !LODTier->bAllowWallRunning)
+	{
+		return NoTransition;
+	}
+
 	// Get the start state
 	const FMoverTickStartData& StartState = Params.StartState;
 	const FMoverDefaultSyncState* StartingSyncState =
@@ -60,14 +68,12 @@ FTransitionEvalResult UBotaniMMT_IntoWallRunning::Evaluate_Implementation(
 	UMoverBlackboard* SimBlackboard = Params.MovingComps.MoverComponent->GetSimBlackboard_Mutable();
 
 	// Check the last time we were wall running and make sure we aren't on cooldown
-	float LastWallRunTimeMs = 0.f;
-	if (SimBlackboard->TryGet<float>(BotaniMover::Blackboard::LastWallRunTime, LastWallRunTimeMs))
+	const int64 WallRunDeltaTimeMs = UBotaniMoverComponent::GetTimerElapsedMs(
+		Params.MovingComps.MoverComponent.Get(), StartState.SyncState, EBotaniMoverTimer::LastWallRun, Params.TimeStep.BaseSimTimeMs, INDEX_NONE);
+	if (WallRunDeltaTimeMs != INDEX_NONE)
 	{
-		const float CurrentTimeMs = Params.TimeStep.BaseSimTimeMs;
-		const float WallRunDeltaTimeMs = CurrentTimeMs - LastWallRunTimeMs;
-
 
-		if (WallRunDeltaTimeMs < (GetBotaniWallRunFloatProp(WallRun_MinTimeBetweenRuns) * 1000.f))
+		if (WallRunDeltaTimeMs < GetBotaniWallRunFloatProp(WallRun_MinTimeBetweenRunsMs))
 		{
 /*#if ENABLE_VISUAL_LOG @TODO: Don't want to spam the vis log with this!
 			{
@@ -84,38 +90,33 @@ FTransitionEvalResult UBotaniMMT_IntoWallRunning::Evaluate_Implementation(
 #endif*/
 
 			BOTANIMOVER_WARN("Can't wall run yet, not enough time passed since last wall run! "
-				"Last wall run time: %f, current time: %f, actual time passed: %f",
-				LastWallRunTimeMs * BotaniMover::Lazy::MsToS, CurrentTimeMs * BotaniMover::Lazy::MsToS, WallRunDeltaTimeMs* BotaniMover::Lazy::MsToS);
+				"Current time: %f, actual time passed: %f",
+				Params.TimeStep.BaseSimTimeMs * BotaniMover::Lazy::MsToS, WallRunDeltaTimeMs * BotaniMover::Lazy::MsToS);
 			return NoTransition;
 		}
 	}
 
-	// Get the gameplay tags sync state
-	if (const FGameplayTagsSyncState* TagsState =
-		StartState.SyncState.SyncStateCollection.FindDataByType<FGameplayTagsSyncState>())
+	// Check the required and blocked tags, pre-compiled into tag bits
+	const FBotaniResolvedWallRunSettings& ResolvedWallRunSettings = BotaniWallRunSettings->GetResolvedSettings();
+	if (!ResolvedWallRunSettings.WallRunningRequiredTagsMask.IsEmpty())
 	{
-		if (!BotaniWallRunSettings->WallRunningRequiredTags.IsEmpty())
+		if (!FBotaniMoverTagsSyncState::HasAllMovementTags(StartState.SyncState, ResolvedWallRunSettings.WallRunningRequiredTagsMask, BotaniWallRunSettings->WallRunningRequiredTags))
 		{
-			if (!TagsState->GetMovementTags().HasAllExact(BotaniWallRunSettings->WallRunningRequiredTags))
-			{
-				BOTANIMOVER_WARN("Can't wall run, missing required tags! "
-					"Required tags: %s, current tags: %s",
-					*BotaniWallRunSettings->WallRunningRequiredTags.ToString(),
-					*TagsState->GetMovementTags().ToString());
-				return NoTransition;
-			}
+			BOTANIMOVER_WARN("Can't wall run, missing required tags! "
+				"Required tags: %s",
+				*BotaniWallRunSettings->WallRunningRequiredTags.ToString());
+			return NoTransition;
 		}
+	}
 
-		if (!BotaniWallRunSettings->WallRunningBlockedTags.IsEmpty())
+	if (!ResolvedWallRunSettings.WallRunningBlockedTagsMask.IsEmpty())
+	{
+		if (FBotaniMoverTagsSyncState::HasAnyMovementTags(StartState.SyncState, ResolvedWallRunSettings.WallRunningBlockedTagsMask, BotaniWallRunSettings->WallRunningBlockedTags))
 		{
-			if (TagsState->GetMovementTags().HasAnyExact(BotaniWallRunSettings->WallRunningBlockedTags))
-			{
-				BOTANIMOVER_WARN("Can't wall run, blocked by tags! "
-					"Blocked tags: %s, current tags: %s",
-					*BotaniWallRunSettings->WallRunningBlockedTags.ToString(),
-					*TagsState->GetMovementTags().ToString());
-				return NoTransition;
-			}
+			BOTANIMOVER_WARN("Can't wall run, blocked by tags! "
+				"Blocked tags: %s",
+				*BotaniWallRunSettings->WallRunningBlockedTags.ToString());
+			return NoTransition;
 		}
 	}
 
@@ -128,40 +129,39 @@ FTransitionEvalResult UBotaniMMT_IntoWallRunning::Evaluate_Implementation(
 
 	//@TODO: Move this into UBotaniMMT_OutOfWallRunning
 	// We can only wall run if we are moving fast enough horizontally
-	if (HorizontalSpeedSquared < pow(GetBotaniWallRunFloatProp(WallRun_MinRequiredSpeed), 2.f) &&
+	if (HorizontalSpeedSquared < GetBotaniWallRunFloatProp(WallRun_MinRequiredSpeedSquared) &&
 		!BotaniWallRunSettings->bAlwaysStayOnWall)
 	{
 		BOTANIMOVER_WARN("Can't wall run, not enough horizontal speed! "
 			"Horizontal speed squared: %f, required: %f",
-			HorizontalSpeedSquared, pow(GetBotaniWallRunFloatProp(WallRun_MinRequiredSpeed), 2.f));
+			HorizontalSpeedSquared, GetBotaniWallRunFloatProp(WallRun_MinRequiredSpeedSquared));
 		return NoTransition;
 	}
 
 	// We can only wall run if we aren't Falling/moving downwards too fast
-	if (VerticalSpeedSquared > pow(GetBotaniWallRunFloatProp(WallRun_MaxVerticalSpeed), 2))
+	if (VerticalSpeedSquared > GetBotaniWallRunFloatProp(WallRun_MaxVerticalSpeedSquared))
 	{
 		BOTANIMOVER_WARN("Can't wall run, moving downwards too fast! "
 			"Vertical speed squared: %f, required: %f",
-			VerticalSpeedSquared, pow(GetBotaniWallRunFloatProp(WallRun_MaxVerticalSpeed), 2));
+			VerticalSpeedSquared, GetBotaniWallRunFloatProp(WallRun_MaxVerticalSpeedSquared));
 		return NoTransition;
 	}
 
 	// Start tracing for walls to run on
-	FHitResult WallHit;
-	const bool bCanStartWallRunning = CanStartWallRunning(Params, WallHit);
+	FWallContact WallContact;
+	const bool bCanStartWallRunning = CanStartWallRunning(Params, WallContact);
 
-	if (!bCanStartWallRunning ||!WallHit.IsValidBlockingHit())
+	if (!bCanStartWallRunning)
 	{
 		return NoTransition;
 	}
 
 	// Check if the wall is not too steep to run on
 	// But handle it later
-	const float Angle = UWallRunningMovementUtils::GetWallAngle(WallHit, UpDir);
-	const bool bIsWallTooSteep = Angle < GetBotaniWallRunFloatProp(WallRun_MinRequiredAngle);
+	const bool bIsWallTooSteep = UWallRunningMovementUtils::IsWallTooSteep(WallContact, GetBotaniWallRunFloatProp(WallRun_MinRequiredAngleCosine), UpDir);
 
 	FWallCheckResult CurrentWall;
-	CurrentWall.SetFromHitResult(WallHit, WallHit.Distance, (bCanStartWallRunning && !bIsWallTooSteep));
+	CurrentWall.SetFromContact(WallContact, (bCanStartWallRunning && !bIsWallTooSteep));
 
 	// Save the wall result to the blackboard
 	if (ensure(IsValid(SimBlackboard)))
@@ -174,19 +174,19 @@ FTransitionEvalResult UBotaniMMT_IntoWallRunning::Evaluate_Implementation(
 	{
 		BOTANIMOVER_WARN("Can't wall run, wall is too steep! "
 			"Wall angle: %f, required: %f",
-			Angle, GetBotaniWallRunFloatProp(WallRun_MinRequiredAngle));
+			UWallRunningMovementUtils::GetWallAngle(WallContact, UpDir), GetBotaniWallRunFloatProp(WallRun_MinRequiredAngle));
 		return NoTransition;
 	}
 
 	// Check if the player is facing away from the wall
-	if (UWallRunningMovementUtils::ShouldFallOffWall(
-		WallHit,
-		GetBotaniWallRunFloatProp(WallRun_PullAwayAngle),
+	if (UWallRunningMovementUtils::ShouldFallOffWall_Sine(
+		WallContact,
+		GetBotaniWallRunFloatProp(WallRun_PullAwayAngleSine),
 		StartingSyncState->GetIntent_WorldSpace()))
 	{
 		BOTANIMOVER_WARN("Can't wall run, player is facing away from the wall! "
 			"Wall angle: %f, pull away angle: %f",
-			Angle, GetBotaniWallRunFloatProp(WallRun_PullAwayAngle));
+			UWallRunningMovementUtils::GetWallAngle(WallContact, UpDir), GetBotaniWallRunFloatProp(WallRun_PullAwayAngle));
 		return NoTransition;
 	}
 
@@ -203,25 +203,19 @@ FTransitionEvalResult UBotaniMMT_IntoWallRunning::Evaluate_Implementation(
 	}
 
 	// All checks passed, so we can wall run!
+	CaptureWallPlane(Params, WallContact);
 	return WallRunningTransition;
 }
 
 void UBotaniMMT_IntoWallRunning::Trigger_Implementation(
 	const FSimulationTickParams& Params)
 {
-	// Get the blackboard
-	UMoverBlackboard* SimBlackboard =
-		Params.MovingComps.MoverComponent->GetSimBlackboard_Mutable();
-
-	// Save the last wall run time into the blackboard
-	if (IsValid(SimBlackboard))
-	{
-		SimBlackboard->Set<float>(BotaniMover::Blackboard::LastWallRunTime, Params.TimeStep.BaseSimTimeMs);
-	}
-
 #if ENABLE_VISUAL_LOG
 	if (bShouldCreateVisLogEntry)
 	{
+		// Get the blackboard
+		const UMoverBlackboard* SimBlackboard = Params.MovingComps.MoverComponent->GetSimBlackboard();
+
 		FWallCheckResult CurrentWall;
 		if (IsValid(SimBlackboard) && SimBlackboard->TryGet<FWallCheckResult>(BotaniMover::Blackboard::LastWallResult, CurrentWall))
 		{
@@ -230,7 +224,7 @@ void UBotaniMMT_IntoWallRunning::Trigger_Implementation(
 			VisLogCommand(Params.MovingComps.MoverComponent->GetOwner(),
 				FVLogDrawCommand::DrawArrow(
 					Params.MovingComps.UpdatedComponent->GetComponentLocation(),
-					CurrentWall.GetHitResult().ImpactPoint,
+					CurrentWall.GetContact().GetImpactPoint(),
 					FColor::Red,
 					FString::Printf(TEXT("Wall Hit!\n\tDistance: %.2f"),
 						CurrentWall.GetDistanceToWall())));
@@ -6,12 +6,14 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "BotaniCommonMovementSettings.h"
 #include "BotaniMoverAbilityInputs.h"
+#include "BotaniMoverTagsSyncState.h"
 #include "CommonBlackboard.h"
 #include "GameplayTagSyncState.h"
 #include "MoverComponent.h"
 #include "MoverDataModelTypes.h"
 #include "MoverSimulationTypes.h"
 #include "Abilities/GameplayAbilityTypes.h"
+#include "Components/BotaniMoverComponent.h"
 #include "LayeredMoves/BotaniLM_MultiJump.h"
 #include "MoveLibrary/FloorQueryUtils.h"
 
@@ -25,6 +27,34 @@ UBotaniMMT_Jump::UBotaniMMT_Jump(const FObjectInitializer& ObjectInitializer)
 	bJumpWhenButtonPressed = true;
 }
 
+void UBotaniMMT_Jump::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	CompileTagMasks();
+}
+
+void UBotaniMMT_Jump::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileTagMasks();
+}
+
+#if WITH_EDITOR
+void UBotaniMMT_Jump::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileTagMasks();
+}
+#endif
+
+void UBotaniMMT_Jump::CompileTagMasks()
+{
+	JumpRequiredTagsMask.Compile(JumpRequiredTags);
+}
+
 FTransitionEvalResult UBotaniMMT_Jump::Evaluate_Implementation(
 	const FSimulationTickParams& Params) const
 {
@@ -42,37 +72,34 @@ FTransitionEvalResult UBotaniMMT_Jump::Evaluate_Implementation(
 		}
 	}
 
-	// Get the sync state tags
-	const FGameplayTagsSyncState* TagsState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FGameplayTagsSyncState>();
-
 	// Do we have tags to match?
-	if (TagsState && !JumpRequiredTags.IsEmpty())
+	if (!JumpRequiredTagsMask.IsEmpty())
 	{
-		// CHeck if we have the required tags
-		if (!TagsState->GetMovementTags().HasAllExact(JumpRequiredTags))
+		// Check if we have the required tags
+		if (!FBotaniMoverTagsSyncState::HasAllMovementTags(Params.StartState.SyncState, JumpRequiredTagsMask, JumpRequiredTags))
 		{
 			return FTransitionEvalResult::NoTransition;
 		}
 	}
 
 	// Get the botani movement settings
-	const UBotaniCommonMovementSettings* BotaniMovementSettings = Params.MovingComps.MoverComponent->FindSharedSettings<UBotaniCommonMovementSettings>();
+	const UBotaniCommonMovementSettings* BotaniMovementSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniCommonMovementSettings>(Params.MovingComps.MoverComponent.Get());
+	check(BotaniMovementSettings);
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(Params.MovingComps.MoverComponent.Get(), BotaniMovementSettings);
+
+	// Check if we are jumping too fast/soon
+	const int64 TimeSinceLastJumpMs = UBotaniMoverComponent::GetTimerElapsedMs(
+		Params.MovingComps.MoverComponent.Get(), Params.StartState.SyncState, EBotaniMoverTimer::LastJump, Params.TimeStep.BaseSimTimeMs);
+	if (TimeSinceLastJumpMs < GetBotaniMoverFloatProp(MinTimeBetweenJumps) * 1000.f)
+	{
+		return FTransitionEvalResult::NoTransition;
+	}
 
 	// Get the blackboard
 	const UMoverBlackboard* SimBlackboard = Params.MovingComps.MoverComponent->GetSimBlackboard();
 
 	if (IsValid(SimBlackboard))
 	{
-		float LastJumpTime = 0.f;
-		if (SimBlackboard->TryGet(CommonBlackboard::LastJumpTime, LastJumpTime))
-		{
-			// Check if we are jumping too fast/soon
-			const float TimeSinceLastJump = Params.TimeStep.BaseSimTimeMs - LastJumpTime;
-			if (TimeSinceLastJump < GetBotaniMoverFloatProp(MinTimeBetweenJumps) * 1000.f)
-			{
-				return FTransitionEvalResult::NoTransition;
-			}
-		}
 
 		if (BotaniMovementSettings->bJumpRequiresGround)
 		{
@@ -88,16 +115,10 @@ FTransitionEvalResult UBotaniMMT_Jump::Evaluate_Implementation(
 			{
 				if (GetBotaniMoverFloatProp(CoyoteTime) > 0.f)
 				{
-					float LastFallTime = 0.f;
-					if (SimBlackboard->TryGet(CommonBlackboard::LastFallTime, LastFallTime))
-					{
-						const float TimeSinceFall = Params.TimeStep.BaseSimTimeMs - LastFallTime;
-						if (TimeSinceFall > GetBotaniMoverFloatProp(CoyoteTime) * 1000.f)
-						{
-							return FTransitionEvalResult::NoTransition;
-						}
-					}
-					else
+					// A missing fall timer reports MAX_int32, so we never were on the ground
+					const int64 TimeSinceFallMs = UBotaniMoverComponent::GetTimerElapsedMs(
+						Params.MovingComps.MoverComponent.Get(), Params.StartState.SyncState, EBotaniMoverTimer::LastFall, Params.TimeStep.BaseSimTimeMs);
+					if (TimeSinceFallMs > GetBotaniMoverFloatProp(CoyoteTime) * 1000.f)
 					{
 						return FTransitionEvalResult::NoTransition;
 					}
@@ -118,8 +139,9 @@ void UBotaniMMT_Jump::Trigger_Implementation(
 	const FSimulationTickParams& Params)
 {
 	// Get the movement settings
-	const UBotaniCommonMovementSettings* BotaniMovementSettings = Params.MovingComps.MoverComponent->FindSharedSettings<UBotaniCommonMovementSettings>();
+	const UBotaniCommonMovementSettings* BotaniMovementSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniCommonMovementSettings>(Params.MovingComps.MoverComponent.Get());
 	check(BotaniMovementSettings);
+	const FBotaniResolvedMovementSettings& BotaniMovementValues = UBotaniMoverComponent::GetEffectiveMovementSettings(Params.MovingComps.MoverComponent.Get(), BotaniMovementSettings);
 
 	// Get the sync state tags
 	const FGameplayTagsSyncState* TagsState = Params.StartState.SyncState.SyncStateCollection.FindDataByType<FGameplayTagsSyncState>();
@@ -140,8 +162,8 @@ void UBotaniMMT_Jump::Trigger_Implementation(
 			if (CurrentFloor.IsWalkableFloor())
 			{
 				// We're jumping off a walkable floor,
-				// so save the last falling time to the blackboard
-				SimBlackboard->Set(CommonBlackboard::LastFallTime, Params.TimeStep.BaseSimTimeMs);
+				// so this is where we start falling
+				UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), EBotaniMoverTimer::LastFall, Params.TimeStep.BaseSimTimeMs);
 
 				if (bJumpAddsFloorVelocity.Get(BotaniMovementSettings->bJumpAddsFloorVelocity) && CurrentFloor.HitResult.GetActor())
 				{
@@ -150,11 +172,11 @@ void UBotaniMMT_Jump::Trigger_Implementation(
 				}
 			}
 		}
-
-		// Save the last jump time to the blackboard
-		SimBlackboard->Set(CommonBlackboard::LastJumpTime, Params.TimeStep.BaseSimTimeMs);
 	}
 
+	// Record the jump time
+	UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), EBotaniMoverTimer::LastJump, Params.TimeStep.BaseSimTimeMs);
+
 	// Preserve any momentum from our current base
 	FVector ClampedVelocity = bJumpKeepsPreviousVelocity.Get(BotaniMovementSettings->bJumpKeepsPreviousVelocity)
 		? Params.MovingComps.UpdatedComponent->GetComponentVelocity()
@@ -196,10 +218,10 @@ void UBotaniMMT_Jump::Trigger_Implementation(
 	// Queue the layered move to the mover component
 	Params.MovingComps.MoverComponent->QueueLayeredMove(JumpMove);
 
-	// Check if we should log the jump time in an additional blackboard key
-	if (BlackboardTimeLoggingKey != NAME_None)
+	// Check if we should log the jump time in an additional timer
+	if (TriggerTimer != EBotaniMoverTimer::None)
 	{
-		SimBlackboard->Set(BlackboardTimeLoggingKey, Params.TimeStep.BaseSimTimeMs);
+		UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), TriggerTimer, Params.TimeStep.BaseSimTimeMs);
 	}
 
 	// Do we want to send a trigger event?
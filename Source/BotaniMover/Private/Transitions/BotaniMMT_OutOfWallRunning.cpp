@@ -4,10 +4,11 @@
 #include "Transitions/BotaniMMT_OutOfWallRunning.h"
 
 #include "BotaniMoverLogChannels.h"
+#include "BotaniMoverTagsSyncState.h"
 #include "BotaniMoverVLogHelpers.h"
 #include "BotaniWallRunMovementSettings.h"
-#include "GameplayTagSyncState.h"
 #include "MoverComponent.h"
+#include "Components/BotaniMoverComponent.h"
 #include "MoveLibrary/WallRunningMovementUtils.h"
 
 
@@ -16,7 +17,7 @@
 UBotaniMMT_OutOfWallRunning::UBotaniMMT_OutOfWallRunning(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	BlackboardTimeLoggingKey = BotaniMover::Blackboard::LastWallRunTime;
+	TriggerTimer = EBotaniMoverTimer::LastWallRun;
 #if WITH_EDITORONLY_DATA
 	bShouldCreateVisLogEntry = true;
 #endif
@@ -54,22 +55,15 @@ FTransitionEvalResult UBotaniMMT_OutOfWallRunning::Evaluate_Implementation(
 		Params.MovingComps.MoverComponent->GetSimBlackboard_Mutable();
 
 	// Check for overall maximum wall run time
-	float LastWallRunStartTime = 0.f;
-	if (SimBlackboard->TryGet<float>(BotaniMover::Blackboard::LastWallRunStartTime, LastWallRunStartTime))
+	const int64 WallRunDuration = UBotaniMoverComponent::GetTimerElapsedMs(
+		Params.MovingComps.MoverComponent.Get(), StartState.SyncState, EBotaniMoverTimer::LastWallRunStart, Params.TimeStep.BaseSimTimeMs, INDEX_NONE);
+	if (WallRunDuration != INDEX_NONE)
 	{
-		if (BotaniWallRunSettings->WallRun_MaxTime.IsSet())
+		// Negative if the max time isn't set
+		const float MaxWallRunDuration = GetBotaniWallRunFloatProp(WallRun_MaxTimeMs);
+		if (MaxWallRunDuration > 0.f)
 		{
-			const float CurrentTime = Params.TimeStep.BaseSimTimeMs;
-			const float WallRunDuration = CurrentTime - LastWallRunStartTime;
-
-			// Omg "GetValue().GetValue()" (first one is for TOptional, second one for FScalableFloat)
-			const float MaxWallRunDuration =
-				BotaniWallRunSettings->WallRun_MaxTime.GetValue().GetValue() * BotaniMover::Lazy::SToMs; // Convert seconds to milliseconds
-
-			// As we are using "TOptional" it wouldn't make sense checking against negative values here,
-			// but I need to be able to assign my curve table values to it, which makes TOptional in that context useless.
-			if ((MaxWallRunDuration > 0.f) &&
-				(WallRunDuration >= MaxWallRunDuration))
+			if (WallRunDuration >= MaxWallRunDuration)
 			{
 				BOTANIMOVER_WARN("Can't continue wall running, max time exceeded! WallRunDuration: %.3fs, MaxTime: %.3fs",
 					WallRunDuration * BotaniMover::Lazy::MsToS, MaxWallRunDuration * BotaniMover::Lazy::MsToS);
@@ -79,52 +73,53 @@ FTransitionEvalResult UBotaniMMT_OutOfWallRunning::Evaluate_Implementation(
 		}
 	}
 
-	// Get the gameplay tags sync state
-	if (const FGameplayTagsSyncState* TagsState =
-		StartState.SyncState.SyncStateCollection.FindDataByType<FGameplayTagsSyncState>())
+	// Check the required and blocked tags, pre-compiled into tag bits
+	const FBotaniResolvedWallRunSettings& ResolvedWallRunSettings = BotaniWallRunSettings->GetResolvedSettings();
+	if (!ResolvedWallRunSettings.WallRunningRequiredTagsMask.IsEmpty())
 	{
-		if (!BotaniWallRunSettings->WallRunningRequiredTags.IsEmpty())
+		if (!FBotaniMoverTagsSyncState::HasAllMovementTags(StartState.SyncState, ResolvedWallRunSettings.WallRunningRequiredTagsMask, BotaniWallRunSettings->WallRunningRequiredTags))
 		{
-			if (!TagsState->GetMovementTags().HasAllExact(BotaniWallRunSettings->WallRunningRequiredTags))
-			{
-				BOTANIMOVER_WARN("Can't continue wall running, missing required tags! "
-					"Required tags: %s, current tags: %s",
-					*BotaniWallRunSettings->WallRunningRequiredTags.ToString(),
-					*TagsState->GetMovementTags().ToString());
-				return FallingTransition;
-			}
+			BOTANIMOVER_WARN("Can't continue wall running, missing required tags! "
+				"Required tags: %s",
+				*BotaniWallRunSettings->WallRunningRequiredTags.ToString());
+			return FallingTransition;
 		}
+	}
 
-		if (!BotaniWallRunSettings->WallRunningBlockedTags.IsEmpty())
+	if (!ResolvedWallRunSettings.WallRunningBlockedTagsMask.IsEmpty())
+	{
+		if (FBotaniMoverTagsSyncState::HasAnyMovementTags(StartState.SyncState, ResolvedWallRunSettings.WallRunningBlockedTagsMask, BotaniWallRunSettings->WallRunningBlockedTags))
 		{
-			if (TagsState->GetMovementTags().HasAnyExact(BotaniWallRunSettings->WallRunningBlockedTags))
-			{
-				BOTANIMOVER_WARN("Can't continue wall running, blocked by tags! "
-					"Blocked tags: %s, current tags: %s",
-					*BotaniWallRunSettings->WallRunningBlockedTags.ToString(),
-					*TagsState->GetMovementTags().ToString());
-				return FallingTransition;
-			}
+			BOTANIMOVER_WARN("Can't continue wall running, blocked by tags! "
+				"Blocked tags: %s",
+				*BotaniWallRunSettings->WallRunningBlockedTags.ToString());
+			return FallingTransition;
 		}
 	}
 
 	// Now that we checked for early-out conditions, we can start checking for the wall to run on
-	FHitResult WallHit;
-	const bool bCanStartWallRunning = CanStartWallRunning(Params, WallHit);
+	// On long planar walls the captured plane tells us where the wall is, without probing
+	FWallContact WallContact;
+	const bool bFromWallPlane = TryGetWallFromPlane(Params, WallContact);
+	const bool bCanStartWallRunning = bFromWallPlane || CanStartWallRunning(Params, WallContact);
 
-	if (!bCanStartWallRunning ||!WallHit.IsValidBlockingHit())
+	if (!bCanStartWallRunning)
 	{
 		return FallingTransition;
 	}
 
+	if (!bFromWallPlane)
+	{
+		CaptureWallPlane(Params, WallContact);
+	}
+
 	// Check if the wall is not too steep to run on
 	// But handle it later
 	const FVector UpDir = Params.MovingComps.MoverComponent->GetUpDirection();
-	const float Angle = UWallRunningMovementUtils::GetWallAngle(WallHit, UpDir);
-	const bool bIsWallTooSteep = Angle < GetBotaniWallRunFloatProp(WallRun_MinRequiredAngle);
+	const bool bIsWallTooSteep = UWallRunningMovementUtils::IsWallTooSteep(WallContact, GetBotaniWallRunFloatProp(WallRun_MinRequiredAngleCosine), UpDir);
 
 	FWallCheckResult CurrentWall;
-	CurrentWall.SetFromHitResult(WallHit, WallHit.Distance, (bCanStartWallRunning && !bIsWallTooSteep));
+	CurrentWall.SetFromContact(WallContact, (bCanStartWallRunning && !bIsWallTooSteep));
 
 	// Save the wall result to the blackboard
 	if (ensure(IsValid(SimBlackboard)))
@@ -137,24 +132,25 @@ FTransitionEvalResult UBotaniMMT_OutOfWallRunning::Evaluate_Implementation(
 	{
 		BOTANIMOVER_WARN("Can't continue wall running, wall is too steep! "
 			"Wall angle: %f, required: %f",
-			Angle, GetBotaniWallRunFloatProp(WallRun_MinRequiredAngle));
+			UWallRunningMovementUtils::GetWallAngle(WallContact, UpDir), GetBotaniWallRunFloatProp(WallRun_MinRequiredAngle));
 		return FallingTransition;
 	}
 
 	// Check if the player is facing away from the wall
-	if (UWallRunningMovementUtils::ShouldFallOffWall(
-		WallHit,
-		GetBotaniWallRunFloatProp(WallRun_PullAwayAngle),
+	if (UWallRunningMovementUtils::ShouldFallOffWall_Sine(
+		WallContact,
+		GetBotaniWallRunFloatProp(WallRun_PullAwayAngleSine),
 		StartingSyncState->GetIntent_WorldSpace()) &&
 		!BotaniWallRunSettings->bAlwaysStayOnWall)
 	{
 		BOTANIMOVER_WARN("Can't continue wall running, player is facing away from the wall! "
 			"Wall angle: %f, pull away angle: %f",
-			Angle, GetBotaniWallRunFloatProp(WallRun_PullAwayAngle));
+			UWallRunningMovementUtils::GetWallAngle(WallContact, UpDir), GetBotaniWallRunFloatProp(WallRun_PullAwayAngle));
 		return FallingTransition;
 	}
 
 	// Make sure we are high enough above the floor to start wall running
+	// The floor below us isn't part of the wall, so this is checked on the wall plane too
 	if (!UWallRunningMovementUtils::IsHighEnoughForWallRun(
 		Params.MovingComps,
 		GetBotaniWallRunFloatProp(WallRun_MinRequiredDynamicHeight),
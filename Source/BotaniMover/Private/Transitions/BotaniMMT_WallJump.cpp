@@ -8,13 +8,14 @@
 #include "BotaniMoverAbilityInputs.h"
 #include "BotaniMoverLogChannels.h"
 #include "BotaniMoverSettings.h"
+#include "BotaniMoverTagsSyncState.h"
 #include "BotaniMoverVLogHelpers.h"
 #include "BotaniWallRunMovementSettings.h"
-#include "CommonBlackboard.h"
 #include "GameplayTagSyncState.h"
 #include "MoverComponent.h"
 #include "MoverSimulationTypes.h"
 #include "Abilities/GameplayAbilityTypes.h"
+#include "Components/BotaniMoverComponent.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "LayeredMoves/BotaniLM_MultiJump.h"
 #include "MoveLibrary/MovementUtils.h"
@@ -27,7 +28,36 @@ UBotaniMMT_WallJump::UBotaniMMT_WallJump(const FObjectInitializer& ObjectInitial
 {
 	WallJumpMovementMode = DefaultModeNames::Falling;
 	bJumpWhenButtonPressed = true;
-	//BlackboardTimeLoggingKey = BotaniMover::Blackboard::LastWallJumpTime; We already hardcoded that bb key, maybe we have an additional one
+	//TriggerTimer = EBotaniMoverTimer::LastWallJump; We already hardcoded that timer, maybe we have an additional one
+}
+
+void UBotaniMMT_WallJump::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	CompileTagMasks();
+}
+
+void UBotaniMMT_WallJump::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileTagMasks();
+}
+
+#if WITH_EDITOR
+void UBotaniMMT_WallJump::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileTagMasks();
+}
+#endif
+
+void UBotaniMMT_WallJump::CompileTagMasks()
+{
+	WallJumpRequiredTagsMask.Compile(WallJumpRequiredTags);
+	WallJumpBlockedTagsMask.Compile(WallJumpBlockedTags);
 }
 
 FTransitionEvalResult UBotaniMMT_WallJump::Evaluate_Implementation(
@@ -35,7 +65,7 @@ FTransitionEvalResult UBotaniMMT_WallJump::Evaluate_Implementation(
 {
 	// Get the botani wall run settings
 	const UBotaniWallRunMovementSettings* BotaniWallRunSettings =
-		Params.MovingComps.MoverComponent->FindSharedSettings<UBotaniWallRunMovementSettings>();
+		UBotaniMoverComponent::FindBotaniSettings<UBotaniWallRunMovementSettings>(Params.MovingComps.MoverComponent.Get());
 	check(BotaniWallRunSettings);
 
 	// Early out if wall jump is not allowed
@@ -58,29 +88,22 @@ FTransitionEvalResult UBotaniMMT_WallJump::Evaluate_Implementation(
 		}
 	}
 
-	// Get the sync state tags
-	const FGameplayTagsSyncState* TagsState =
-		Params.StartState.SyncState.SyncStateCollection.FindDataByType<FGameplayTagsSyncState>();
-
-	// Check for required/blocked tags
-	if (TagsState)
+	// Check for required/blocked tags, pre-compiled into tag bits
+	if (!WallJumpRequiredTagsMask.IsEmpty())
 	{
-		if (!WallJumpRequiredTags.IsEmpty())
+		// Check if we have all the required tags
+		if (!FBotaniMoverTagsSyncState::HasAllMovementTags(Params.StartState.SyncState, WallJumpRequiredTagsMask, WallJumpRequiredTags))
 		{
-			// Check if we have all the required tags
-			if (!TagsState->GetMovementTags().HasAllExact(WallJumpRequiredTags))
-			{
-				return FTransitionEvalResult::NoTransition;
-			}
+			return FTransitionEvalResult::NoTransition;
 		}
+	}
 
-		if (!WallJumpBlockedTags.IsEmpty())
+	if (!WallJumpBlockedTagsMask.IsEmpty())
+	{
+		// Check if we have any of the blocked tags
+		if (FBotaniMoverTagsSyncState::HasAnyMovementTags(Params.StartState.SyncState, WallJumpBlockedTagsMask, WallJumpBlockedTags))
 		{
-			// Check if we have any of the blocked tags
-			if (TagsState->GetMovementTags().HasAnyExact(WallJumpBlockedTags))
-			{
-				return FTransitionEvalResult::NoTransition;
-			}
+			return FTransitionEvalResult::NoTransition;
 		}
 	}
 
@@ -113,13 +136,15 @@ void UBotaniMMT_WallJump::Trigger_Implementation(
 {
 	// Get the botani wall run settings
 	const UBotaniWallRunMovementSettings* BotaniWallRunSettings =
-		Params.MovingComps.MoverComponent->FindSharedSettings<UBotaniWallRunMovementSettings>();
+		UBotaniMoverComponent::FindBotaniSettings<UBotaniWallRunMovementSettings>(Params.MovingComps.MoverComponent.Get());
 	check(BotaniWallRunSettings);
 
 	// Get the movement settings
 	const UBotaniCommonMovementSettings* BotaniMovementSettings =
-		Params.MovingComps.MoverComponent->FindSharedSettings<UBotaniCommonMovementSettings>();
+		UBotaniMoverComponent::FindBotaniSettings<UBotaniCommonMovementSettings>(Params.MovingComps.MoverComponent.Get());
 	check(BotaniMovementSettings);
+	const FBotaniResolvedMovementSettings& BotaniMovementValues =
+		UBotaniMoverComponent::GetEffectiveMovementSettings(Params.MovingComps.MoverComponent.Get(), BotaniMovementSettings);
 
 	// Get the kinematic inputs
 	const FCharacterDefaultInputs* KinematicInputs =
@@ -145,20 +170,20 @@ void UBotaniMMT_WallJump::Trigger_Implementation(
 		if (bValidWall && CurrentWall.IsRunAbleWall())
 		{
 			// We're jumping off a wall-runnable wall,
-			// so save the last falling time to the blackboard
-			SimBlackboard->Set(CommonBlackboard::LastFallTime, Params.TimeStep.BaseSimTimeMs);
+			// so this is where we start falling
+			UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), EBotaniMoverTimer::LastFall, Params.TimeStep.BaseSimTimeMs);
 
-			if (bWallJumpAddsFloorVelocity.Get(BotaniWallRunSettings->bWallJumpAddsFloorVelocity) && CurrentWall.GetHitResult().GetActor())
+			if (bWallJumpAddsFloorVelocity.Get(BotaniWallRunSettings->bWallJumpAddsFloorVelocity) && CurrentWall.GetContact().GetActor())
 			{
 				// Add the wall velocity to the inherited velocity
-				InheritedVelocity = CurrentWall.GetHitResult().GetActor()->GetVelocity();
+				InheritedVelocity = CurrentWall.GetContact().GetActor()->GetVelocity();
 			}
 		}
-
-		// Save the last wall jump time to the blackboard
-		SimBlackboard->Set(BotaniMover::Blackboard::LastWallJumpTime, Params.TimeStep.BaseSimTimeMs);
 	}
 
+	// Record the wall jump time
+	UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), EBotaniMoverTimer::LastWallJump, Params.TimeStep.BaseSimTimeMs);
+
 	// Preserve any momentum from our current base (if any)
 	FVector ClampedVelocity = bWallJumpKeepsPreviousVelocity.Get(BotaniWallRunSettings->bWallJumpKeepsPreviousVelocity)
 		? Params.MovingComps.UpdatedComponent->GetComponentVelocity()
@@ -182,7 +207,7 @@ void UBotaniMMT_WallJump::Trigger_Implementation(
 
 	// Add velocity based on the wall normal and the jump speed
 	const FVector JumpVelocity =
-		( CurrentWall.GetHitResult().ImpactNormal.GetSafeNormal() * GetBotaniWallRunFloatProp(WallJump_ForceMagnitude) ) +
+		( CurrentWall.GetContact().GetNormal().GetSafeNormal() * GetBotaniWallRunFloatProp(WallJump_ForceMagnitude) ) +
 		ArcadeForce;
 
 #if ENABLE_VISUAL_LOG
@@ -234,10 +259,10 @@ void UBotaniMMT_WallJump::Trigger_Implementation(
 	// Queue the layered move to the mover component
 	Params.MovingComps.MoverComponent->QueueLayeredMove(JumpMove);
 
-	// Check if we should log the wall jump time in an additional blackboard key
-	if (BlackboardTimeLoggingKey != NAME_None)
+	// Check if we should log the wall jump time in an additional timer
+	if (TriggerTimer != EBotaniMoverTimer::None)
 	{
-		SimBlackboard->Set(BlackboardTimeLoggingKey, Params.TimeStep.BaseSimTimeMs);
+		UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), TriggerTimer, Params.TimeStep.BaseSimTimeMs);
 	}
 
 	// Send a trigger gameplay event
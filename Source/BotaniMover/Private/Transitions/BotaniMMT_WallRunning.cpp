@@ -10,6 +10,7 @@
 #include "BotaniWallRunMovementSettings.h"
 #include "GameplayTagSyncState.h"
 #include "MoverComponent.h"
+#include "Components/BotaniMoverComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "DefaultMovementSet/Settings/CommonLegacyMovementSettings.h"
 #include "Library/CommonMovementCheckUtils.h"
@@ -41,7 +42,7 @@ FTransitionEvalResult UDEPRECATED_BotaniMMT_WallRunning::Evaluate_Implementation
 	UMoverBlackboard* SimBlackboard = Params.MovingComps.MoverComponent->GetSimBlackboard_Mutable();
 
 	// Get the wall running settings
-	const UBotaniWallRunMovementSettings* BotaniWallRunSettings = Params.MovingComps.MoverComponent->FindSharedSettings<UBotaniWallRunMovementSettings>();
+	const UBotaniWallRunMovementSettings* BotaniWallRunSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniWallRunMovementSettings>(Params.MovingComps.MoverComponent.Get());
 
 	auto NoTransition = FTransitionEvalResult::NoTransition;
 	FTransitionEvalResult TransitionTo_Falling = WallRunningEndMovementMode;
@@ -131,7 +132,7 @@ FTransitionEvalResult UDEPRECATED_BotaniMMT_WallRunning::Evaluate_Implementation
 
 	// Check if we are falling too fast
 	const FVector Velocity = Params.MovingComps.UpdatedComponent->GetComponentVelocity();
-	if ((Velocity.ProjectOnToNormal(Params.MovingComps.MoverComponent->GetUpDirection()).Size() < -BotaniWallRunSettings->WallRun_MaxVerticalSpeed.GetValue()))
+	if ((Velocity.ProjectOnToNormal(Params.MovingComps.MoverComponent->GetUpDirection()).Size() < -GetBotaniWallRunFloatProp(WallRun_MaxVerticalSpeed)))
 	{
 #if ENABLE_VISUAL_LOG
 		{
@@ -182,11 +183,11 @@ FTransitionEvalResult UDEPRECATED_BotaniMMT_WallRunning::Evaluate_Implementation
 	}
 
 	// Check the angle of the wall
-	const float Angle = UWallRunningMovementUtils::GetWallAngle(OutWallHit, UpDirection);
-	const bool bIsWallTooSteep = Angle < GetBotaniWallRunFloatProp(WallRun_MinRequiredAngle);
+	const bool bIsWallTooSteep = UWallRunningMovementUtils::IsWallTooSteep(OutWallHit, GetBotaniWallRunFloatProp(WallRun_MinRequiredAngleCosine), UpDirection);
 
 	FWallCheckResult CurrentWall;
 	CurrentWall.SetFromHitResult(OutWallHit, OutWallHit.Distance, (bCanStartWallRunning && !bIsWallTooSteep));
+	CurrentWall.SetWallSide(UWallRunningMovementUtils::GetWallSide(OutWallHit, Params.MovingComps.UpdatedComponent->GetRightVector()));
 
 	// We are wall running (or we want to)
 	// So save the wall hit result to the blackboard
@@ -208,7 +209,8 @@ FTransitionEvalResult UDEPRECATED_BotaniMMT_WallRunning::Evaluate_Implementation
 					FColor::Red,
 					FQuat::Identity,
 					1.f,
-					FString::Printf(TEXT("Transition into FALLING!\nReason: Wall is too steep! Angle: %f"), Angle)));
+					FString::Printf(TEXT("Transition into FALLING!\nReason: Wall is too steep! Angle: %f"),
+						UWallRunningMovementUtils::GetWallAngle(OutWallHit, UpDirection))));
 		}
 #endif
 
@@ -227,7 +229,7 @@ FTransitionEvalResult UDEPRECATED_BotaniMMT_WallRunning::Evaluate_Implementation
 		//float AccelDot = (Params.MovingComps.UpdatedComponent->GetComponentA)
 	}
 
-	if (UWallRunningMovementUtils::ShouldFallOffWall(OutWallHit, GetBotaniWallRunFloatProp(WallRun_PullAwayAngle), StartSyncState->GetIntent_WorldSpace())
+	if (UWallRunningMovementUtils::ShouldFallOffWall_Sine(OutWallHit, GetBotaniWallRunFloatProp(WallRun_PullAwayAngleSine), StartSyncState->GetIntent_WorldSpace())
 		&& !UCommonMovementCheckUtils::IsFalling(Params))
 	{
 #if ENABLE_VISUAL_LOG
@@ -293,7 +295,8 @@ FTransitionEvalResult UDEPRECATED_BotaniMMT_WallRunning::Evaluate_Implementation
 				FColor::Green,
 				FQuat::Identity,
 				1.f,
-				FString::Printf(TEXT("Transition into WALL RUNNING!\nReason: I can wall run on this wall! (Angle: %f)"), Angle)));
+				FString::Printf(TEXT("Transition into WALL RUNNING!\nReason: I can wall run on this wall! (Angle: %f)"),
+					UWallRunningMovementUtils::GetWallAngle(OutWallHit, UpDirection))));
 	}
 #endif
 
@@ -365,12 +368,11 @@ void UDEPRECATED_BotaniMMT_WallRunning::Trigger_Implementation(const FSimulation
 	// Sum up all the velocities
 	InheritedVelocity += ClampedVelocity;*/
 
-	// Get the blackboard
-	UMoverBlackboard* SimBlackboard = Params.MovingComps.MoverComponent->GetSimBlackboard_Mutable();
-	if (IsValid(SimBlackboard))
+	// Record the wall run start time
+	UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), EBotaniMoverTimer::LastWallRunStart, Params.TimeStep.BaseSimTimeMs);
+	if (TriggerTimer != EBotaniMoverTimer::None)
 	{
-		// Save the last wall run time to the blackboard
-		SimBlackboard->Set<float>(BotaniMover::Blackboard::LastWallRunTime, Params.TimeStep.BaseSimTimeMs);
+		UBotaniMoverComponent::QueueTimerEdge(Params.MovingComps.MoverComponent.Get(), TriggerTimer, Params.TimeStep.BaseSimTimeMs);
 	}
 
 	// Send the trigger event
@@ -389,7 +391,7 @@ bool UDEPRECATED_BotaniMMT_WallRunning::CanStartWallRunning(
 	FHitResult& OutWallHit) const
 {
 	// Get the wall running settings
-	const UBotaniWallRunMovementSettings* WallRunSettings = Params.MovingComps.MoverComponent->FindSharedSettings<UBotaniWallRunMovementSettings>();
+	const UBotaniWallRunMovementSettings* WallRunSettings = UBotaniMoverComponent::FindBotaniSettings<UBotaniWallRunMovementSettings>(Params.MovingComps.MoverComponent.Get());
 
 	// Check for valid walls to run on
 	FHitResult WallHit;
@@ -0,0 +1,272 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "WallRunIndex/BotaniWallRunIndex.h"
+
+#include "BotaniMoverLogChannels.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "WallRunIndex/BotaniWallRunIndexActor.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniWallRunIndex)
+
+bool FBotaniWallRunIndex::Covers(
+	const FVector& Location,
+	const float Radius) const
+{
+	if (!IsBaked())
+	{
+		return false;
+	}
+
+	// Anything outside of the sampled cells was never looked at, so the index can't tell
+	const FIntVector MinCell = GetCellCoord(Location - FVector(Radius));
+	const FIntVector MaxCell = GetCellCoord(Location + FVector(Radius));
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				if (!SampledCells.Contains(FIntVector(X, Y, Z)))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FBotaniWallRunIndex::HasRunnableWall(
+	const FVector& Location,
+	const float Radius,
+	const float CosMinRequiredAngle,
+	const FVector& UpDirection) const
+{
+	bool bFoundWall = false;
+	ForEachPatchInSphere(Location, Radius, [&](const FBotaniWallPatch& Patch)
+	{
+		// Smaller angles have greater cosines, same as UWallRunningMovementUtils::IsWallTooSteep
+		bFoundWall = (FVector(Patch.Normal) | UpDirection) <= CosMinRequiredAngle;
+		return !bFoundWall;
+	});
+
+	return bFoundWall;
+}
+
+void FBotaniWallRunIndex::FindWallPatches(
+	const FVector& Location,
+	const float Radius,
+	TArray<FBotaniWallPatch>& OutPatches) const
+{
+	ForEachPatchInSphere(Location, Radius, [&](const FBotaniWallPatch& Patch)
+	{
+		OutPatches.Add(Patch);
+		return true;
+	});
+}
+
+SIZE_T FBotaniWallRunIndex::GetAllocatedSize() const
+{
+	return Patches.GetAllocatedSize() + Cells.GetAllocatedSize() + SampledCells.GetAllocatedSize();
+}
+
+FIntVector FBotaniWallRunIndex::GetCellCoord(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+template <typename FuncType>
+void FBotaniWallRunIndex::ForEachPatchInSphere(
+	const FVector& Location,
+	const float Radius,
+	FuncType&& Func) const
+{
+	if (!IsBaked() || Patches.IsEmpty())
+	{
+		return;
+	}
+
+	// A patch stands for the wall around it, so grow the sphere by its radius
+	const float QueryRadius = Radius + PatchRadius;
+	const float QueryRadiusSquared = FMath::Square(QueryRadius);
+
+	const FIntVector MinCell = GetCellCoord(Location - FVector(QueryRadius));
+	const FIntVector MaxCell = GetCellCoord(Location + FVector(QueryRadius));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const FBotaniWallRunIndexCell* Cell = Cells.Find(FIntVector(X, Y, Z));
+				if (!Cell)
+				{
+					continue;
+				}
+
+				for (int32 PatchIdx = Cell->FirstPatch; PatchIdx < Cell->FirstPatch + Cell->NumPatches; ++PatchIdx)
+				{
+					const FBotaniWallPatch& Patch = Patches[PatchIdx];
+					if (FVector::DistSquared(FVector(Patch.Location), Location) <= QueryRadiusSquared && !Func(Patch))
+					{
+						return;
+					}
+				}
+			}
+		}
+	}
+}
+
+#if WITH_EDITOR
+void FBotaniWallRunIndex::Bake(
+	const ULevel* Level,
+	const FBotaniWallRunIndexBakeSettings& Settings)
+{
+	*this = FBotaniWallRunIndex();
+
+	if (!Level)
+	{
+		return;
+	}
+
+	const float SampleSpacing = FMath::Max(Settings.SampleSpacing, 10.f);
+	CellSize = FMath::Max(Settings.CellSize, SampleSpacing);
+	PatchRadius = SampleSpacing * UE_SQRT_3;
+	const FVector TraceDirections[] = { FVector::ForwardVector, FVector::BackwardVector, FVector::RightVector, FVector::LeftVector };
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BotaniWallRunIndexBake), false);
+
+	// One patch per sample spacing and facing direction is enough, the rest are duplicates found by neighboring samples
+	TMap<FIntVector4, FBotaniWallPatch> UniquePatches;
+	auto AddPatch = [&](const FVector& ImpactPoint, const FVector& ImpactNormal)
+	{
+		const float Yaw = FMath::Atan2(ImpactNormal.Y, ImpactNormal.X);
+		const int32 FacingBucket = FMath::RoundToInt32(Yaw / UE_TWO_PI * 16.f) & 15;
+		const FIntVector4 PatchKey(
+			FMath::FloorToInt32(ImpactPoint.X / SampleSpacing),
+			FMath::FloorToInt32(ImpactPoint.Y / SampleSpacing),
+			FMath::FloorToInt32(ImpactPoint.Z / SampleSpacing),
+			FacingBucket);
+
+		FBotaniWallPatch& Patch = UniquePatches.FindOrAdd(PatchKey);
+		Patch.Location = FVector3f(ImpactPoint);
+		Patch.Normal = FVector3f(ImpactNormal);
+	};
+
+	for (const AActor* Actor : Level->Actors)
+	{
+		if (!IsValid(Actor) || Actor->IsA<ABotaniWallRunIndexActor>())
+		{
+			continue;
+		}
+
+		Actor->ForEachComponent<UPrimitiveComponent>(false, [&](UPrimitiveComponent* Component)
+		{
+			// Movable walls can't be baked, they have to be found by the regular probes
+			if (!Component->IsRegistered()
+				|| Component->Mobility != EComponentMobility::Static
+				|| !Component->IsQueryCollisionEnabled()
+				|| Component->GetCollisionResponseToChannel(Settings.WallChannel) != ECR_Block
+				|| !Settings.SurfaceFilter.PassesFilter(Component))
+			{
+				return;
+			}
+
+			// Every cell that was scanned is covered, walls or not
+			const FBox ComponentBounds = Component->Bounds.GetBox().ExpandBy(SampleSpacing);
+			const FIntVector MinCell = GetCellCoord(ComponentBounds.Min);
+			const FIntVector MaxCell = GetCellCoord(ComponentBounds.Max);
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+				{
+					for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+					{
+						SampledCells.Add(FIntVector(X, Y, Z));
+					}
+				}
+			}
+
+			// Trace a grid of short horizontal lines through the component, every wall between two samples gets hit by one of them
+			const FIntVector MinSample = FIntVector(
+				FMath::FloorToInt32(ComponentBounds.Min.X / SampleSpacing),
+				FMath::FloorToInt32(ComponentBounds.Min.Y / SampleSpacing),
+				FMath::FloorToInt32(ComponentBounds.Min.Z / SampleSpacing));
+			const FIntVector MaxSample = FIntVector(
+				FMath::CeilToInt32(ComponentBounds.Max.X / SampleSpacing),
+				FMath::CeilToInt32(ComponentBounds.Max.Y / SampleSpacing),
+				FMath::CeilToInt32(ComponentBounds.Max.Z / SampleSpacing));
+
+			for (int32 X = MinSample.X; X <= MaxSample.X; ++X)
+			{
+				for (int32 Y = MinSample.Y; Y <= MaxSample.Y; ++Y)
+				{
+					for (int32 Z = MinSample.Z; Z <= MaxSample.Z; ++Z)
+					{
+						const FVector SampleLocation = FVector(X, Y, Z) * SampleSpacing;
+						for (const FVector& TraceDirection : TraceDirections)
+						{
+							FHitResult Hit(1.f);
+							if (!Component->LineTraceComponent(Hit, SampleLocation, SampleLocation + TraceDirection * SampleSpacing, QueryParams)
+								|| Hit.bStartPenetrating)
+							{
+								continue;
+							}
+
+							// The normal is kept as is, so the angle test uses the settings in effect when querying
+							AddPatch(Hit.ImpactPoint, Hit.ImpactNormal);
+						}
+					}
+				}
+			}
+		});
+	}
+
+	if (SampledCells.IsEmpty())
+	{
+		*this = FBotaniWallRunIndex();
+		return;
+	}
+
+	// Sort the patches by cell, so every cell is a contiguous range
+	UniquePatches.GenerateValueArray(Patches);
+	Patches.Sort([this](const FBotaniWallPatch& A, const FBotaniWallPatch& B)
+	{
+		const FIntVector CellA = GetCellCoord(FVector(A.Location));
+		const FIntVector CellB = GetCellCoord(FVector(B.Location));
+		if (CellA.X != CellB.X)
+		{
+			return CellA.X < CellB.X;
+		}
+
+		return CellA.Y != CellB.Y ? CellA.Y < CellB.Y : CellA.Z < CellB.Z;
+	});
+
+	for (int32 PatchIdx = 0; PatchIdx < Patches.Num(); ++PatchIdx)
+	{
+		FBotaniWallRunIndexCell& Cell = Cells.FindOrAdd(GetCellCoord(FVector(Patches[PatchIdx].Location)));
+		if (Cell.NumPatches == 0)
+		{
+			Cell.FirstPatch = PatchIdx;
+		}
+
+		++Cell.NumPatches;
+	}
+
+	Patches.Shrink();
+	Cells.Shrink();
+	SampledCells.Shrink();
+
+	BOTANIMOVER_LOG("Baked %d wall patches into %d cells for level '%s' (%llu bytes).",
+		Patches.Num(), Cells.Num(), *GetPathNameSafe(Level), static_cast<uint64>(GetAllocatedSize()));
+}
+#endif
@@ -0,0 +1,45 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "WallRunIndex/BotaniWallRunIndexActor.h"
+
+#include "Engine/World.h"
+#include "Subsystems/BotaniWallRunIndexSubsystem.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniWallRunIndexActor)
+
+ABotaniWallRunIndexActor::ABotaniWallRunIndexActor(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+void ABotaniWallRunIndexActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UBotaniWallRunIndexSubsystem* IndexSubsystem = UWorld::GetSubsystem<UBotaniWallRunIndexSubsystem>(GetWorld()))
+	{
+		IndexSubsystem->RegisterIndex(this);
+	}
+}
+
+void ABotaniWallRunIndexActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UBotaniWallRunIndexSubsystem* IndexSubsystem = UWorld::GetSubsystem<UBotaniWallRunIndexSubsystem>(GetWorld()))
+	{
+		IndexSubsystem->UnregisterIndex(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void ABotaniWallRunIndexActor::BakeWallRunIndex()
+{
+	Modify();
+
+	Index.Bake(GetLevel(), BakeSettings);
+	NumBakedPatches = Index.GetNumPatches();
+}
+#endif
@@ -19,10 +19,91 @@ enum class EBotaniEditorOnlyJumpPreset : uint8
 };
 #endif
 
+/** Reads a value from the effective movement settings, expects a local BotaniMovementValues (see UBotaniMoverComponent::GetEffectiveMovementSettings). */
 #define GetBotaniMoverFloatProp(FloatPropertyName) \
-	BotaniMovementSettings->FloatPropertyName.GetValue()
+	BotaniMovementValues.FloatPropertyName
+
+/**
+ * Plain snapshot of every scalable float in UBotaniCommonMovementSettings, evaluated at the settings level.
+ * Movement code reads from this instead of evaluating the curve tables on every access.
+ */
+USTRUCT()
+struct FBotaniResolvedMovementSettings
+{
+	GENERATED_BODY()
 
-/** Common movement settings backed by scalable floats. */
+	UPROPERTY()
+	float MaxSpeed = 0.f;
+	UPROPERTY()
+	float MaxStepHeight = 0.f;
+	UPROPERTY()
+	float Acceleration = 0.f;
+	UPROPERTY()
+	float Deceleration = 0.f;
+	UPROPERTY()
+	float TurningRate = 0.f;
+	UPROPERTY()
+	float TurningBoost = 0.f;
+	UPROPERTY()
+	float GroundFriction = 0.f;
+	UPROPERTY()
+	float BrakingFriction = 0.f;
+	UPROPERTY()
+	float BrakingFrictionFactor = 0.f;
+	UPROPERTY()
+	float MaxWalkSlopeAngleCosine = 0.f;
+	UPROPERTY()
+	float SlopeBoostMultiplier = 0.f;
+	UPROPERTY()
+	float MaxSprintSpeed = 0.f;
+	UPROPERTY()
+	float SprintAcceleration = 0.f;
+	UPROPERTY()
+	float SprintDeceleration = 0.f;
+	UPROPERTY()
+	float SprintTurningRate = 0.f;
+	UPROPERTY()
+	float SprintTurningBoost = 0.f;
+	UPROPERTY()
+	float AirControlPct = 0.f;
+	UPROPERTY()
+	float FallingDeceleration = 0.f;
+	UPROPERTY()
+	float OverTerminalSpeedFallingDeceleration = 0.f;
+	UPROPERTY()
+	float TerminalMovementPlaneSpeed = 0.f;
+	UPROPERTY()
+	float VerticalFallingDeceleration = 0.f;
+	UPROPERTY()
+	float TerminalVerticalSpeed = 0.f;
+	UPROPERTY()
+	float MinTimeBetweenJumps = 0.f;
+	UPROPERTY()
+	float CoyoteTime = 0.f;
+	UPROPERTY()
+	float JumpVerticalImpulse = 0.f;
+	UPROPERTY()
+	float JumpHoldTime = 0.f;
+	UPROPERTY()
+	float ExtraJumpVerticalImpulse = 0.f;
+	UPROPERTY()
+	float JumpAirControlPct = 0.f;
+	UPROPERTY()
+	float MaxJumpPreviousVelocity = 0.f;
+
+	/** Sine of the max walkable slope angle, derived from MaxWalkSlopeAngleCosine. */
+	float MaxWalkSlopeAngleSine = 0.f;
+
+	/** Recomputes all values that are derived from other values. */
+	MY_API void UpdateDerivedValues();
+};
+
+/**
+ * Common movement settings backed by scalable floats.
+ * The scalable floats are resolved into a plain snapshot whenever they may have changed.
+ * These settings are treated as immutable at runtime, per pawn overrides go through the
+ * movement settings modifier stack on UBotaniMoverComponent.
+ */
 UCLASS(MinimalAPI, BlueprintType)
 class UBotaniCommonMovementSettings
 	: public UObject
@@ -38,11 +119,57 @@ public:
 	//~ End IMovementSettingsInterface
 
 	//~ Begin UObject Interface
+	MY_API virtual void PostInitProperties() override;
+	MY_API virtual void PostLoad() override;
+	MY_API virtual void PostDuplicate(bool bDuplicateForPIE) override;
 #if WITH_EDITOR
 	MY_API virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 	//~ End UObject Interface
 
+	/** Returns the snapshot of all scalable floats, evaluated at the current settings level. */
+	const FBotaniResolvedMovementSettings& GetResolvedSettings() const { return ResolvedSettings; }
+
+	/** Returns a counter that is bumped every time the resolved settings are rebuilt. */
+	uint32 GetResolvedSettingsRevision() const { return ResolvedSettingsRevision; }
+
+	/**
+	 * Re-evaluates all scalable floats into the resolved snapshot.
+	 * Rejected for instances shared by an archetype, use the movement settings modifiers of the mover component for per pawn changes.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Settings")
+	MY_API void RebuildResolvedSettings();
+
+	/** Sets the level the scalable floats are evaluated at and rebuilds the resolved snapshot. Rejected for instances shared by an archetype. */
+	UFUNCTION(BlueprintCallable, Category="Settings")
+	MY_API void SetSettingsLevel(float InLevel);
+
+	/** Returns the level the scalable floats are evaluated at. */
+	UFUNCTION(BlueprintPure, Category="Settings")
+	float GetSettingsLevel() const { return SettingsLevel; }
+
+protected:
+#if WITH_EDITOR
+	/** Listens for changes to the curve tables referenced by the scalable floats. */
+	MY_API void BindCurveTableDelegates();
+
+	/** Called when a curve table referenced by one of the scalable floats changed. */
+	MY_API void HandleCurveTableChanged();
+#endif
+
+	/** Re-evaluates all scalable floats into the resolved snapshot, without checking whether the instance is shared. */
+	MY_API void UpdateResolvedSettings();
+
+	/** The level all scalable floats are evaluated at. */
+	UPROPERTY(EditAnywhere, Category="Settings")
+	float SettingsLevel = 0.f;
+
+	/** Snapshot of all scalable floats, evaluated at SettingsLevel. */
+	FBotaniResolvedMovementSettings ResolvedSettings;
+
+	/** Bumped every time ResolvedSettings is rebuilt, so cached copies know when to refresh. */
+	uint32 ResolvedSettingsRevision = 0;
+
 public:
 	/** If true, the actor will remain upright with gravity despite any rotation applied to the actor. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="General")
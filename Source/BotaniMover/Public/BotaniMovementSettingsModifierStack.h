@@ -0,0 +1,150 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BotaniCommonMovementSettings.h"
+
+#include "BotaniMovementSettingsModifierStack.generated.h"
+
+#define MY_API BOTANIMOVER_API
+
+/** How a movement settings delta is combined with the value below it. */
+UENUM(BlueprintType)
+enum class EBotaniSettingsModifierOp : uint8
+{
+	/** Adds the value. */
+	Add,
+
+	/** Multiplies by the value. */
+	Multiply,
+
+	/** Replaces the value. */
+	Override,
+};
+
+/** A single change to one of the resolved movement settings. */
+USTRUCT(BlueprintType)
+struct FBotaniMovementSettingsDelta
+{
+	GENERATED_BODY()
+
+	FBotaniMovementSettingsDelta() = default;
+	FBotaniMovementSettingsDelta(const FName InSetting, const EBotaniSettingsModifierOp InOp, const float InValue)
+		: Setting(InSetting)
+		, Op(InOp)
+		, Value(InValue)
+	{
+	}
+
+	/** Name of the setting in FBotaniResolvedMovementSettings, e.g. MaxSpeed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Modifier)
+	FName Setting;
+
+	/** How the value is applied. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Modifier)
+	EBotaniSettingsModifierOp Op = EBotaniSettingsModifierOp::Override;
+
+	/** The value to apply. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Modifier)
+	float Value = 0.f;
+};
+
+/**
+ * Layered overrides on top of immutable base movement settings.
+ * Sources (stances, gameplay effects, zones, ...) push a small set of deltas under their own key and pop them again.
+ * The effective settings are cached and only recomputed when the stack or the base settings change.
+ */
+struct FBotaniMovementSettingsModifierStack
+{
+public:
+	/**
+	 * Adds the deltas under the given source key, replacing any deltas already pushed by that source.
+	 * Entries are applied in ascending priority, entries with equal priority in push order.
+	 */
+	MY_API void Push(const FName Source, TConstArrayView<FBotaniMovementSettingsDelta> Deltas, const int32 Priority = 0);
+
+	/** Removes the deltas pushed by the given source. Returns false if the source had nothing pushed. */
+	MY_API bool Pop(const FName Source);
+
+	/** Returns true if the given source currently has deltas pushed. */
+	MY_API bool Contains(const FName Source) const;
+
+	/** Returns true if nothing is pushed. */
+	bool IsEmpty() const { return Entries.IsEmpty(); }
+
+	/** Returns the base settings with all pushed deltas applied. Only recomputed when the stack or the base settings changed. */
+	MY_API const FBotaniResolvedMovementSettings& Resolve(const UBotaniCommonMovementSettings& BaseSettings) const;
+
+private:
+	/** A delta with the setting name resolved to the float's offset in FBotaniResolvedMovementSettings. */
+	struct FCompiledDelta
+	{
+		int32 Offset = INDEX_NONE;
+		EBotaniSettingsModifierOp Op = EBotaniSettingsModifierOp::Override;
+		float Value = 0.f;
+	};
+
+	struct FEntry
+	{
+		FName Source;
+		int32 Priority = 0;
+		TArray<FCompiledDelta, TInlineAllocator<4>> Deltas;
+	};
+
+	/** Pushed entries, kept sorted by priority. */
+	TArray<FEntry, TInlineAllocator<2>> Entries;
+
+	/** Cached effective settings. */
+	mutable FBotaniResolvedMovementSettings EffectiveSettings;
+
+	/** The base settings the cache was computed from. */
+	mutable TWeakObjectPtr<const UBotaniCommonMovementSettings> CachedBaseSettings;
+
+	/** Revision of the base settings the cache was computed from. */
+	mutable uint32 CachedBaseRevision = 0;
+
+	/** Whether the stack changed since the cache was computed. */
+	mutable bool bDirty = true;
+};
+
+/**
+ * Recent states of a modifier stack by the simulation time they took effect at.
+ * The stack lives outside the sync state, so this is what rewinds it when ticks are simulated again after a correction.
+ */
+struct FBotaniMovementSettingsModifierHistory
+{
+public:
+	/** Upper bound of stack changes kept, in case a source pushes every tick. Anything within MaxAgeMs is kept below it. */
+	static constexpr int32 MaxSnapshots = 256;
+
+	/**
+	 * Records the state of the stack from the given simulation time on, replacing a state recorded for the same time.
+	 * States that were replaced more than MaxAgeMs before SimTimeMs are dropped, so it should cover the longest rollback.
+	 */
+	MY_API void Record(const double SimTimeMs, const FBotaniMovementSettingsModifierStack& Stack, const double MaxAgeMs);
+
+	/**
+	 * Rewinds the stack to its state at the given simulation time and forgets all later states.
+	 * Returns false if the history doesn't reach back that far, the stack is left untouched then.
+	 */
+	MY_API bool Restore(const double SimTimeMs, FBotaniMovementSettingsModifierStack& OutStack);
+
+	/** Forgets all recorded states. */
+	MY_API void Reset();
+
+private:
+	struct FSnapshot
+	{
+		double SimTimeMs = 0.0;
+		FBotaniMovementSettingsModifierStack Stack;
+	};
+
+	/** Recorded states, sorted by simulation time. */
+	TArray<FSnapshot> Snapshots;
+
+	/** Whether old states were dropped, otherwise the stack was empty before the first recorded state. */
+	bool bTrimmed = false;
+};
+
+#undef MY_API
@@ -0,0 +1,140 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "MoverTypes.h"
+
+#include "BotaniMoverAbilityStateInputs.generated.h"
+
+/**
+ * Ability system state mirrored into the input command, see UBotaniMoverAbilityMirrorComponent.
+ * The simulation reads restrictions and multipliers from here instead of querying the ability system.
+ */
+USTRUCT(BlueprintType)
+struct FBotaniMoverAbilityStateInputs : public FMoverDataStructBase
+{
+	GENERATED_BODY()
+
+public:
+	FBotaniMoverAbilityStateInputs()
+		: bCannotMove(false)
+		, MaxSpeedMultiplier(1.f)
+		, AccelerationMultiplier(1.f)
+	{
+	}
+
+	virtual ~FBotaniMoverAbilityStateInputs() override {}
+
+public:
+	/** Is the character restricted from moving? */
+	UPROPERTY(BlueprintReadWrite, Category=Input)
+	uint8 bCannotMove:1;
+
+	/** Multiplier applied to the max speed of the movement modes. */
+	UPROPERTY(BlueprintReadWrite, Category=Input)
+	float MaxSpeedMultiplier;
+
+	/** Multiplier applied to the acceleration of the movement modes. */
+	UPROPERTY(BlueprintReadWrite, Category=Input)
+	float AccelerationMultiplier;
+
+	/** Returns true if any multiplier differs from 1. */
+	bool HasMultipliers() const
+	{
+		return MaxSpeedMultiplier != 1.f || AccelerationMultiplier != 1.f;
+	}
+
+public:
+	//~ Begin FMoverDataStructBase Interface
+	virtual FMoverDataStructBase* Clone() const override
+	{
+		FBotaniMoverAbilityStateInputs* CopyPtr = new FBotaniMoverAbilityStateInputs(*this);
+		return CopyPtr;
+	}
+
+	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override
+	{
+		Super::NetSerialize(Ar, Map, bOutSuccess);
+
+		// Serialize the restriction flags, the multipliers are only sent while they are in effect
+		uint8 RepBits = 0;
+		if (Ar.IsSaving())
+		{
+			if (bCannotMove) { RepBits |= 1 << 0; }
+			if (HasMultipliers()) { RepBits |= 1 << 1; }
+		}
+
+		// Serialize the bits (handles loading and saving)
+		Ar.SerializeBits(&RepBits, 2);
+
+		bCannotMove = (RepBits & (1 << 0)) != 0;
+
+		if (RepBits & (1 << 1))
+		{
+			Ar << MaxSpeedMultiplier;
+			Ar << AccelerationMultiplier;
+		}
+		else
+		{
+			MaxSpeedMultiplier = 1.f;
+			AccelerationMultiplier = 1.f;
+		}
+
+		bOutSuccess = true;
+		return true;
+	}
+
+	virtual UScriptStruct* GetScriptStruct() const override
+	{
+		return StaticStruct();
+	}
+
+	virtual void ToString(FAnsiStringBuilderBase& Out) const override
+	{
+		Super::ToString(Out);
+		Out.Appendf("CannotMove: %d\n", bCannotMove);
+		Out.Appendf("MaxSpeedMultiplier: %.2f AccelerationMultiplier: %.2f\n", MaxSpeedMultiplier, AccelerationMultiplier);
+	}
+
+	virtual bool ShouldReconcile(const FMoverDataStructBase& AuthorityState) const override
+	{
+		const FBotaniMoverAbilityStateInputs& TypedAuthority = static_cast<const FBotaniMoverAbilityStateInputs&>(AuthorityState);
+
+		return (bCannotMove != TypedAuthority.bCannotMove)
+			|| !FMath::IsNearlyEqual(MaxSpeedMultiplier, TypedAuthority.MaxSpeedMultiplier)
+			|| !FMath::IsNearlyEqual(AccelerationMultiplier, TypedAuthority.AccelerationMultiplier);
+	}
+
+	virtual void Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float Pct) override
+	{
+		// Restrictions and multipliers are step values, so we don't blend them
+		const FBotaniMoverAbilityStateInputs& SourceInputs =
+			static_cast<const FBotaniMoverAbilityStateInputs&>((Pct < 0.5f) ? From : To);
+
+		bCannotMove = SourceInputs.bCannotMove;
+		MaxSpeedMultiplier = SourceInputs.MaxSpeedMultiplier;
+		AccelerationMultiplier = SourceInputs.AccelerationMultiplier;
+	}
+
+	virtual void Merge(const FMoverDataStructBase& From) override
+	{
+		const FBotaniMoverAbilityStateInputs& FromInputs =
+			static_cast<const FBotaniMoverAbilityStateInputs&>(From);
+
+		// Keep restrictions sticky, the multipliers are always the latest
+		bCannotMove |= FromInputs.bCannotMove;
+		MaxSpeedMultiplier = FromInputs.MaxSpeedMultiplier;
+		AccelerationMultiplier = FromInputs.AccelerationMultiplier;
+	}
+	//~ End FMoverDataStructBase Interface
+};
+
+template<>
+struct TStructOpsTypeTraits< FBotaniMoverAbilityStateInputs > : public TStructOpsTypeTraitsBase2< FBotaniMoverAbilityStateInputs >
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true
+	};
+};
@@ -0,0 +1,121 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * A box around the pawn's capsule that one overlap query confirmed to be free of blocking geometry.
+ * Moves that keep the capsule inside the box can skip their collision sweep.
+ *
+ * The box is aligned with the up direction and may rest on a supporting surface, like the floor we walk on or the wall we run on,
+ * leaving half of the capsule's gap to it. The box only vouches for the static world: the async overlap issued after every movement
+ * is a frame old by the time it is read, so every move that skips its sweep still has to pass IsMoveClearOfDynamics.
+ * The bubble is dropped once the pawn leaves it, something entered it or its lifetime passed.
+ */
+struct FBotaniMoverFreeSpaceBubble
+{
+public:
+	/** Shape of the capsule and the surface supporting it, used to place the box. */
+	struct FPlacement
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector UpDirection = FVector::UpVector;
+		float CapsuleRadius = 0.f;
+		float CapsuleHalfHeight = 0.f;
+
+		/** Normal of the supporting surface, pointing towards the capsule. Zero if we're not supported by anything. */
+		FVector SupportNormal = FVector::ZeroVector;
+
+		/** Gap between the capsule and the supporting surface. */
+		float SupportGap = 0.f;
+	};
+
+	/**
+	 * Tries to establish a new bubble around the capsule, with Margin of free space on every unsupported side.
+	 * Returns false if the box isn't free, in which case no new attempt is made until the retry interval passed.
+	 */
+	MY_API bool Establish(UWorld* World, const FPlacement& Placement, const float Margin, const double SimTimeMs, const double LifetimeMs, const double RetryIntervalMs,
+		const ECollisionChannel CollisionChannel, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams& ResponseParams);
+
+	/** Returns true if a new bubble may be established at the given time. */
+	bool CanEstablish(const double SimTimeMs) const { return SimTimeMs >= NextEstablishSimTimeMs || SimTimeMs < EstablishSimTimeMs; }
+
+	/**
+	 * Returns true if the bubble can still be used at the given time.
+	 * Consumes the async recheck of the bubble and drops the bubble if anything moved into it.
+	 */
+	MY_API bool Validate(UWorld* World, const double SimTimeMs);
+
+	/** Returns true if the capsule at Location, moved by Delta, stays inside the bubble. */
+	MY_API bool Contains(const FVector& Location, const FVector& Delta) const;
+
+	/**
+	 * Returns true if no dynamic object blocks the capsule at Location, moved by Delta.
+	 * Runs a synchronous overlap of the box around the move, which only tests dynamic objects with DynamicResponseParams.
+	 */
+	MY_API bool IsMoveClearOfDynamics(const UWorld* World, const FVector& Location, const FVector& Delta,
+		const ECollisionChannel CollisionChannel, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams& DynamicResponseParams) const;
+
+	/** Issues the async overlap that checks the bubble for dynamic objects before the next move. */
+	MY_API void RequestRecheck(UWorld* World, const ECollisionChannel CollisionChannel, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams& ResponseParams);
+
+	/** Drops the bubble. */
+	MY_API void Invalidate();
+
+	/** Drops the bubble and any retry delay. */
+	MY_API void Reset();
+
+	bool IsValid() const { return bValid; }
+
+	/** Counts a move that skipped its sweep. */
+	MY_API void RecordHit();
+
+	/** Counts a move that had to sweep. */
+	MY_API void RecordMiss();
+
+	/** Number of moves that skipped their sweep. */
+	uint64 GetNumHits() const { return NumHits; }
+
+	/** Number of moves that had to sweep. */
+	uint64 GetNumMisses() const { return NumMisses; }
+
+private:
+	/** Capsule location the bubble was established around. */
+	FVector Origin = FVector::ZeroVector;
+
+	/** Rotation of the box, Z is the up direction. */
+	FQuat Rotation = FQuat::Identity;
+
+	/** World space center and half extent of the box. */
+	FVector Center = FVector::ZeroVector;
+	FVector HalfExtent = FVector::ZeroVector;
+
+	/** Half extent of the capsule's box, in box space. */
+	FVector CapsuleExtent = FVector::ZeroVector;
+
+	/** Range of capsule offsets from the origin, in box space, that keep the capsule inside the box. */
+	FVector MinOffset = FVector::ZeroVector;
+	FVector MaxOffset = FVector::ZeroVector;
+
+	/** Simulation time the bubble was established at and when it expires. */
+	double EstablishSimTimeMs = 0.0;
+	double ExpireSimTimeMs = 0.0;
+
+	/** Earliest simulation time a new bubble may be established after a failed attempt. */
+	double NextEstablishSimTimeMs = 0.0;
+
+	/** Async overlap checking the bubble for dynamic objects. */
+	FTraceHandle RecheckHandle;
+	bool bRecheckPending = false;
+
+	bool bValid = false;
+
+	uint64 NumHits = 0;
+	uint64 NumMisses = 0;
+};
+
+#undef MY_API
@@ -0,0 +1,104 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "BotaniMoverLOD.generated.h"
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Fidelity of a movement LOD tier, see UBotaniMoverComponent::LODTiers.
+ * The sim rate applies on every peer. The features change the simulation result, so they are only turned off on the authority,
+ * see UBotaniMoverComponent::FindSimulationLODTier.
+ */
+USTRUCT(BlueprintType)
+struct FBotaniMoverLODTier
+{
+	GENERATED_BODY()
+
+	/** The tier is used while the nearest player is closer than this. 0 means any distance. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=LOD, meta=(ClampMin=0, Units=cm))
+	float MaxDistance = 0.f;
+
+	/** Time between two simulation ticks. 0 simulates every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=LOD, meta=(ClampMin=0, Units=s))
+	float SimTickInterval = 0.f;
+
+	/** Whether the optional transition into wall running and its wall probes are evaluated. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=LOD)
+	uint8 bAllowWallRunning : 1 = 1;
+
+	/** Whether vaulting paths are scanned for. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=LOD)
+	uint8 bAllowVaulting : 1 = 1;
+
+	/** Whether fast moves may be split into sub-steps. Without, every move costs a single sweep. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=LOD)
+	uint8 bAllowSubstepping : 1 = 1;
+};
+
+/** What a movement LOD tier is selected from. */
+struct FBotaniMoverLODInputs
+{
+	/** Distance to the nearest player's view point. */
+	float NearestPlayerDistance = 0.f;
+
+	/** Whether the pawn is net relevant to at least one player. */
+	bool bNetRelevant = true;
+
+	/** Measured game thread time, smoothed. */
+	float FrameTimeMs = 0.f;
+
+	/** Frame time above which all pawns are demoted by one tier. 0 disables the budget. */
+	float FrameTimeBudgetMs = 0.f;
+
+	/** Current time, in seconds. */
+	double TimeSeconds = 0.0;
+};
+
+/**
+ * Selects the movement LOD tier of a pawn, tiers are ordered from the highest to the lowest fidelity.
+ *
+ * Every threshold has a hysteresis band, so a pawn sitting on a tier boundary or a frame time hovering around the budget doesn't flip
+ * tiers back and forth. Tiers change by one step at a time. Promotions happen right away, demotions only after the current tier was
+ * held for a minimum time.
+ */
+struct FBotaniMoverLODSelector
+{
+public:
+	/**
+	 * Selects the tier for the given inputs and returns true if it changed.
+	 * @param Hysteresis	Width of the hysteresis bands, as a fraction of the distance thresholds and the frame time budget.
+	 * @param MinDwellTime	Time a tier has to be held before demoting from it, in seconds.
+	 */
+	MY_API bool Update(const TArray<FBotaniMoverLODTier>& Tiers, const FBotaniMoverLODInputs& Inputs, const float Hysteresis, const float MinDwellTime);
+
+	/** Forces the given tier, like the highest one for player controlled pawns. Returns true if it changed. */
+	MY_API bool Force(const int32 Tier, const double TimeSeconds);
+
+	/** Returns the selected tier, or INDEX_NONE if none was selected yet. */
+	int32 GetTier() const { return Tier; }
+
+	/** Returns whether the frame time is considered over budget. */
+	bool IsOverBudget() const { return bOverBudget; }
+
+	/** Forgets the selected tier. */
+	MY_API void Reset();
+
+private:
+	/** Returns the tier the distance alone asks for, using the hysteresis bands around the current tier. */
+	int32 SelectByDistance(const TArray<FBotaniMoverLODTier>& Tiers, const float Distance, const float Hysteresis) const;
+
+	/** Selected tier. */
+	int32 Tier = INDEX_NONE;
+
+	/** Time the selected tier was entered. */
+	double TierSinceSeconds = 0.0;
+
+	/** Whether the frame time is over budget, with hysteresis. */
+	bool bOverBudget = false;
+};
+
+#undef MY_API
@@ -0,0 +1,120 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "WorldCollision.h"
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Predicts the ballistic arc of a falling pawn and casts it against the world once,
+ * so the following falling ticks can move without a sweep until they get close to the predicted impact.
+ *
+ * The arc is integrated like the falling mode integrates it, with the acceleration observed when the prediction was made
+ * (gravity, air control, deceleration). It is cast as a few chords, with a capsule inflated by the tolerance and the sagitta
+ * of the chords, so any move that stays within the tolerance of the arc is known to be free until the predicted impact.
+ */
+struct FBotaniMoverLandingPredictor
+{
+public:
+	/** State of the pawn at the start of the prediction. */
+	struct FLaunch
+	{
+		FVector Location = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+
+		/** Velocity of the first step. */
+		FVector Velocity = FVector::ZeroVector;
+
+		/** Acceleration that is assumed to stay constant along the arc. */
+		FVector Acceleration = FVector::ZeroVector;
+
+		/** Gravity and move input the prediction was made for, it is dropped once either changes. */
+		FVector Gravity = FVector::ZeroVector;
+		FVector MoveInput = FVector::ZeroVector;
+
+		FCollisionShape CollisionShape;
+
+		/** Simulation time at the start of the prediction, and the length of the first step. */
+		double SimTimeMs = 0.0;
+		float StepSeconds = 0.f;
+	};
+
+	/**
+	 * Casts the arc and replaces the current prediction. Returns false if the arc is blocked before the first step ends,
+	 * in which case no new attempt is made until the retry interval passed.
+	 * @param Tolerance		How far the pawn may stray from the arc.
+	 * @param Horizon		How far ahead the arc is cast, in seconds.
+	 * @param MaxSagitta	How far the arc may bend away from the chords it is cast with.
+	 */
+	MY_API bool Predict(UWorld* World, const FLaunch& Launch, const float Tolerance, const float Horizon, const float MaxSagitta, const double RetryIntervalMs,
+		const ECollisionChannel CollisionChannel, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams& ResponseParams);
+
+	/** Returns true if a new prediction may be made at the given time. */
+	bool CanPredict(const double SimTimeMs) const { return SimTimeMs >= NextPredictSimTimeMs || SimTimeMs < Launch.SimTimeMs; }
+
+	/** Returns true if the prediction was made for the given gravity and move input. */
+	MY_API bool Matches(const FVector& Gravity, const FVector& MoveInput) const;
+
+	/** Returns where the arc predicts the pawn at the given simulation time. */
+	MY_API FVector GetPredictedLocation(const double SimTimeMs) const;
+
+	/** Returns true if moving from Start to End, ending at EndSimTimeMs, stays close to the arc and ends before the predicted impact. */
+	MY_API bool CanFollow(const FVector& Start, const FVector& End, const double StartSimTimeMs, const double EndSimTimeMs) const;
+
+	/** Records a move that followed the arc without a sweep. */
+	MY_API void RecordFollowed(const double EndSimTimeMs);
+
+	/** Returns true if the previous simulation tick followed the arc and ended at the given time. */
+	bool ContinuesFrom(const double SimTimeMs) const { return bValid && LastFollowedSimTimeMs == SimTimeMs; }
+
+	/** Returns the sphere that covers the arc of the step starting at the given time, to check it for dynamic objects. */
+	MY_API void GetStepBounds(const double SimTimeMs, const float StepSeconds, FVector& OutCenter, float& OutRadius) const;
+
+	/** Simulation time of the predicted impact, or of the end of the horizon if nothing was hit. */
+	double GetImpactSimTimeMs() const { return ImpactSimTimeMs; }
+
+	/** The predicted impact, not a blocking hit if nothing was hit within the horizon. */
+	const FHitResult& GetImpact() const { return Impact; }
+
+	/** Drops the prediction. */
+	MY_API void Invalidate();
+
+	/** Drops the prediction and any retry delay. */
+	MY_API void Reset();
+
+	bool IsValid() const { return bValid; }
+
+	/** Number of falling moves that followed a prediction without a sweep. */
+	uint64 GetNumFollowedMoves() const { return NumFollowedMoves; }
+
+	/** Number of predictions that were made. */
+	uint64 GetNumPredictions() const { return NumPredictions; }
+
+private:
+	/** Location on the arc after the given time, matching the semi-implicit integration of the falling mode. */
+	FVector GetArcLocation(const float Time) const;
+
+	FLaunch Launch;
+
+	/** How far the pawn may stray from the arc. */
+	float Tolerance = 0.f;
+
+	double ImpactSimTimeMs = 0.0;
+	FHitResult Impact;
+
+	/** Earliest simulation time a new prediction may be made after a failed one. */
+	double NextPredictSimTimeMs = 0.0;
+
+	/** End of the last simulation tick that followed the arc. */
+	double LastFollowedSimTimeMs = -1.0;
+
+	bool bValid = false;
+
+	uint64 NumFollowedMoves = 0;
+	uint64 NumPredictions = 0;
+};
+
+#undef MY_API
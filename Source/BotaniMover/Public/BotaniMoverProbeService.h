@@ -0,0 +1,74 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+
+#define MY_API BOTANIMOVER_API
+
+/** The probes that can be prefetched by FBotaniMoverProbeService. */
+enum class EBotaniMoverProbe : uint8
+{
+	Wall,
+	Vault,
+
+	/** Dynamic objects around the next step of a predicted falling arc. */
+	Landing,
+
+	Num
+};
+
+/**
+ * Prefetches the collision candidates of airborne probes one simulation frame ahead with async overlaps.
+ * The requests are made after movement from the predicted location of the next frame. The next frame only runs the cheap
+ * per-component checks against the candidates, as long as the prefetched sphere still covers the actual query.
+ * Otherwise the caller falls back to a synchronous scene query.
+ */
+struct FBotaniMoverProbeService
+{
+public:
+	/**
+	 * Issues an async overlap that gathers the candidates of a probe in the given simulation frame.
+	 * @param Center	Predicted center of the probe.
+	 * @param Radius	Radius of the probe sphere, including the margin for prediction errors.
+	 */
+	MY_API void RequestProbe(UWorld* World, const EBotaniMoverProbe Probe, const int32 ForSimFrame, const FVector& Center, const float Radius,
+		const ECollisionChannel CollisionChannel, const FCollisionQueryParams& QueryParams, const FCollisionResponseParams& ResponseParams);
+
+	/**
+	 * Returns the candidates of the probe if its async overlap is done, was made for the given frame and covers the given sphere.
+	 * The candidates stay valid until the next request of the same probe.
+	 */
+	MY_API bool TryGetCandidates(UWorld* World, const EBotaniMoverProbe Probe, const int32 SimFrame, const FVector& Center, const float Radius, TConstArrayView<FOverlapResult>& OutCandidates);
+
+	/** Drops all pending probes. */
+	MY_API void Reset();
+
+	/** Number of probes that were answered by a prefetched overlap. */
+	uint64 GetNumPrefetchHits() const { return NumPrefetchHits; }
+
+	/** Number of probes that had to fall back to a synchronous query. */
+	uint64 GetNumFallbacks() const { return NumFallbacks; }
+
+private:
+	/** State of a single prefetched probe. */
+	struct FPendingProbe
+	{
+		FTraceHandle Handle;
+		FVector Center = FVector::ZeroVector;
+		float Radius = 0.f;
+		int32 SimFrame = INDEX_NONE;
+
+		/** The retrieved overlap results, kept so the candidates can be handed out as a view. */
+		FOverlapDatum Datum;
+		bool bRetrieved = false;
+	};
+
+	FPendingProbe Probes[static_cast<uint8>(EBotaniMoverProbe::Num)];
+
+	uint64 NumPrefetchHits = 0;
+	uint64 NumFallbacks = 0;
+};
+
+#undef MY_API
@@ -0,0 +1,117 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MoveLibrary/FloorQueryUtils.h"
+#include "MoveLibrary/WallRunningMovementUtils.h"
+
+#define MY_API BOTANIMOVER_API
+
+class UMoverComponent;
+
+/**
+ * Collision params shared by all queries of a mover component: wall probes, ground clearance, vaulting and stance checks.
+ * They ignore the owner, its child actors and the updated component's move ignore list.
+ */
+struct FBotaniMoverCollisionParams
+{
+public:
+	/** Rebuilds the params for the given mover component. */
+	MY_API void Build(const UMoverComponent* MoverComp);
+
+	FCollisionQueryParams QueryParams;
+	FCollisionResponseParams ResponseParams;
+
+	/** ResponseParams ignoring static world geometry, for queries that only look for dynamic objects. */
+	FCollisionResponseParams DynamicResponseParams;
+
+	/** Object type of the updated component. */
+	ECollisionChannel CollisionChannel = ECC_Pawn;
+};
+
+/**
+ * Results of the world queries made during one simulation frame, shared by all modes and transitions of a mover component.
+ * Entries are keyed by the updated component's transform and the query parameters, and are dropped when the next frame starts.
+ */
+struct FBotaniMoverQueryCache
+{
+public:
+	/** Drops all results of the previous frame. */
+	MY_API void BeginFrame(const int32 InSimFrame);
+
+	/** Drops all cached results, e.g. after the updated component was teleported. */
+	MY_API void Invalidate();
+
+	/** Returns true and the cached floor if the floor was already searched from this transform. */
+	MY_API bool TryGetFloor(const FTransform& Transform, const float SweepDistance, const float MaxWalkableSlopeCosine, FFloorCheckResult& OutFloor);
+	MY_API void StoreFloor(const FTransform& Transform, const float SweepDistance, const float MaxWalkableSlopeCosine, const FFloorCheckResult& Floor);
+
+	/** Returns true and the cached probe if the walls were already probed from this transform. */
+	MY_API bool TryGetWallProbe(const FTransform& Transform, const float HeadDelta, const float TailDelta, const EBotaniWallRunSide WallSide, FWallProbeResult& OutProbeResult);
+	MY_API void StoreWallProbe(const FTransform& Transform, const float HeadDelta, const float TailDelta, const EBotaniWallRunSide WallSide, const FWallProbeResult& ProbeResult);
+
+	/** Returns true and the cached clearance if the ground clearance was already checked from this transform. */
+	MY_API bool TryGetGroundClearance(const FTransform& Transform, const float MinHeight, const FVector& UpDirection, bool& bOutHighEnough);
+	MY_API void StoreGroundClearance(const FTransform& Transform, const float MinHeight, const FVector& UpDirection, const bool bHighEnough);
+
+	/** Returns the simulation frame the cached results belong to. */
+	int32 GetSimFrame() const { return SimFrame; }
+
+	/** Number of queries answered from the cache. */
+	uint64 GetNumHits() const { return NumHits; }
+
+	/** Number of queries that had to be run. */
+	uint64 GetNumMisses() const { return NumMisses; }
+
+	void ResetCounters()
+	{
+		NumHits = 0;
+		NumMisses = 0;
+	}
+
+private:
+	/** A single cached result and the key it was computed for. */
+	template<typename ResultT>
+	struct TEntry
+	{
+		FVector Location = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+		FVector4f Params = FVector4f::Zero();
+		ResultT Result = ResultT();
+		bool bValid = false;
+
+		bool Matches(const FTransform& Transform, const FVector4f& InParams) const
+		{
+			return bValid
+				&& Location == Transform.GetLocation()
+				&& Rotation == Transform.GetRotation()
+				&& Params == InParams;
+		}
+
+		void Store(const FTransform& Transform, const FVector4f& InParams, const ResultT& InResult)
+		{
+			Location = Transform.GetLocation();
+			Rotation = Transform.GetRotation();
+			Params = InParams;
+			Result = InResult;
+			bValid = true;
+		}
+	};
+
+	/** Looks up the entry and counts the hit or miss. */
+	template<typename ResultT>
+	bool TryGet(const TEntry<ResultT>& Entry, const FTransform& Transform, const FVector4f& InParams, ResultT& OutResult);
+
+	TEntry<FFloorCheckResult> Floor;
+	TEntry<FWallProbeResult> WallProbe;
+	TEntry<bool> GroundClearance;
+
+	/** The simulation frame of the cached results. */
+	int32 SimFrame = INDEX_NONE;
+
+	uint64 NumHits = 0;
+	uint64 NumMisses = 0;
+};
+
+#undef MY_API
@@ -0,0 +1,70 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MoveLibrary/FloorQueryUtils.h"
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Tracks whether a pawn rests on the ground, so the ground modes can skip their floor queries and ground move while it does.
+ *
+ * A pawn starts resting after a few quiet ticks in a row at the same transform on a static walkable floor, quiet meaning
+ * no input, velocity, base motion or layered moves. It wakes as soon as anything of that changes, the floor goes away
+ * or stops blocking us, it is moved from the outside, or the owning component reports a movement effect, an overlap or a rollback.
+ */
+struct FBotaniMoverRestingState
+{
+public:
+	/**
+	 * Counts a quiet tick at the given transform and starts resting once EntryTicks of them were spent there in a row.
+	 * CollisionChannel is the object type of the resting pawn, the floor has to keep blocking it.
+	 * Returns true if we are resting afterwards.
+	 */
+	MY_API bool AccumulateQuietTick(const FTransform& Transform, const FFloorCheckResult& Floor, const ECollisionChannel CollisionChannel, const int32 EntryTicks);
+
+	/** Returns true if we rest at the given transform and the floor we rest on is still there. */
+	MY_API bool IsRestingAt(const FTransform& Transform) const;
+
+	/** Leaves the resting state and restarts counting quiet ticks. */
+	MY_API void Wake();
+
+	/** Wakes and clears the counters. */
+	MY_API void Reset();
+
+	bool IsResting() const { return bResting; }
+
+	/** Floor we rest on, valid while resting. */
+	const FFloorCheckResult& GetFloor() const { return Floor; }
+
+	/** Counts a tick that was skipped because we rest. */
+	MY_API void RecordRestingTick();
+
+	/** Number of ticks that were skipped because we rest. */
+	uint64 GetNumRestingTicks() const { return NumRestingTicks; }
+
+	/** Returns true if the floor doesn't move by itself and blocks the given collision channel, so a pawn can rest on it. */
+	static MY_API bool IsStaticFloor(const FFloorCheckResult& Floor, const ECollisionChannel CollisionChannel);
+
+private:
+	/** Transform the quiet ticks were spent at. */
+	FTransform Transform = FTransform::Identity;
+
+	/** Floor below Transform. */
+	FFloorCheckResult Floor;
+
+	/** Object type of the resting pawn. */
+	TEnumAsByte<ECollisionChannel> CollisionChannel = ECC_Pawn;
+
+	/** Number of quiet ticks in a row spent at Transform. */
+	int32 NumQuietTicks = 0;
+
+	/** Whether we are resting. */
+	bool bResting = false;
+
+	/** Number of ticks that were skipped because we rest. */
+	uint64 NumRestingTicks = 0;
+};
+
+#undef MY_API
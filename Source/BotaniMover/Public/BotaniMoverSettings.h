@@ -25,12 +25,9 @@ namespace BotaniMover
 	/** BotaniMover-specific blackboard keys. */
 	namespace Blackboard
 	{
-		const FName LastFallTime = TEXT("LastFallTime"); // time for the last fall
-		const FName LastWallRunTime = TEXT("LastWallRunTime"); // time for the last wall running interaction
-		const FName LastWallRunStartTime = TEXT("LastWallRunStartTime"); // time when the last wall run was started
-		const FName LastWallJumpTime = TEXT("LastWallJumpTime"); // time when the last wall jump was triggered
+		// Timers live in FBotaniTimerSyncState, see EBotaniMoverTimer
 		const FName LastWallResult = TEXT("LastWallResult"); // last successful result for a wall trace
-		const FName LastJumpTime = TEXT("LastJumpTime"); // time when the last jump was triggered
+		const FName LastWallPlane = TEXT("LastWallPlane"); // plane of the wall we're running on, see FBotaniWallPlane
 
 		const FName GrappleTarget = TEXT("GrappleTarget");
 		const FName GrappleNormal = TEXT("GrappleNormal");
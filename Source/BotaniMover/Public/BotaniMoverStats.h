@@ -0,0 +1,67 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("BotaniMover"), STATGROUP_BotaniMover, STATCAT_Advanced);
+
+/** Memory that was not allocated because settings instances were shared between pawns of the same archetype. */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Shared Settings Saved Memory"), STAT_BotaniMover_SharedSettingsSavedMemory, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of settings instances that were replaced by a shared archetype instance. */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Shared Settings Instances"), STAT_BotaniMover_SharedSettingsInstances, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of world queries per frame that were answered from a mover component's query cache. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Cache Hits"), STAT_BotaniMover_QueryCacheHits, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of world queries per frame that missed a mover component's query cache. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Query Cache Misses"), STAT_BotaniMover_QueryCacheMisses, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of airborne probes per frame that were answered by a prefetched async overlap. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Probe Prefetch Hits"), STAT_BotaniMover_ProbePrefetchHits, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of airborne probes per frame that fell back to a synchronous scene query. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Probe Fallbacks"), STAT_BotaniMover_ProbeFallbacks, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of wall probes per frame that were skipped because the baked wall run index has no wall nearby. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Wall Probes Skipped"), STAT_BotaniMover_WallProbesSkipped, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of wall run and vaulting candidates per frame that were skipped by a surface filter. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Filtered Candidates"), STAT_BotaniMover_FilteredCandidates, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of wall run ticks per frame that derived the wall from a captured wall plane instead of probing. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Wall Plane Reuses"), STAT_BotaniMover_WallPlaneReuses, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of moving ground ticks per frame that ran the composite ground move solve. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Move Solves"), STAT_BotaniMover_GroundMoveSolves, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of sweeps per frame run by composite ground move solves, divide by the solves to get the sweeps per tick. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Move Sweeps"), STAT_BotaniMover_GroundMoveSweeps, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of moves per frame that skipped their collision sweep because they stayed inside a free space bubble. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Free Space Hits"), STAT_BotaniMover_FreeSpaceHits, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of moves per frame that asked for a free space bubble but had to sweep. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Free Space Misses"), STAT_BotaniMover_FreeSpaceMisses, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of falling arcs per frame that were cast to predict a landing. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Landing Predictions"), STAT_BotaniMover_LandingPredictions, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of falling moves per frame that followed a predicted arc without a sweep. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Landing Followed Moves"), STAT_BotaniMover_LandingFollowedMoves, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of extra sub-steps per frame that fast moves were split into by their mode's sub-step policy. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Substeps"), STAT_BotaniMover_Substeps, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of ground ticks per frame that skipped their floor queries and ground move because the pawn was resting. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Resting Ticks"), STAT_BotaniMover_RestingTicks, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of movement LOD tier changes per frame. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOD Tier Changes"), STAT_BotaniMover_LODTierChanges, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of collision queries per frame counted against the world's query budget. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budgeted Queries"), STAT_BotaniMover_BudgetedQueries, STATGROUP_BotaniMover, BOTANIMOVER_API);
+
+/** Number of optional collision queries per frame deferred by the world's query budget. */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Queries"), STAT_BotaniMover_DeferredQueries, STATGROUP_BotaniMover, BOTANIMOVER_API);
@@ -0,0 +1,53 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "BotaniMoverSubstepPolicy.generated.h"
+
+class UMoverComponent;
+struct FMoverTickStartData;
+struct FMoverTimeStep;
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Per mode policy for splitting a simulation step into sub-steps, picked from the speed and the collision shape size.
+ * Slow moves run as a single step, only fast ones pay for the extra sweeps.
+ * A mode moves only the first sub-step and refunds the rest of the step, so the state machine runs it again for the remainder.
+ */
+USTRUCT(BlueprintType)
+struct FBotaniMoverSubstepPolicy
+{
+	GENERATED_BODY()
+
+	/** Maximum number of sub-steps a simulation step is split into. 1 disables sub-stepping. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Substepping, meta=(ClampMin=1, UIMin=1, UIMax=8))
+	int32 MaxSubsteps = 1;
+
+	/** Maximum distance a single sub-step may cover, as a multiple of the collision shape radius. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Substepping, meta=(ClampMin=0.1, UIMin=0.1, UIMax=4))
+	float MaxSubstepDistanceFactor = 1.f;
+
+	/** Moves shorter than this are merged into the idle path instead of being moved and swept. 0 disables merging. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Substepping, meta=(ClampMin=0, ForceUnits="cm"))
+	float MinMoveDistance = 0.f;
+
+	/**
+	 * Returns the duration of the next sub-step of the given simulation step, or the full step if it doesn't need to be split.
+	 * Layered moves and moves that follow a predicted landing are never split.
+	 */
+	MY_API float ComputeSubstepMs(const FMoverTickStartData& StartState, const FMoverTimeStep& TimeStep, const UMoverComponent* MoverComp) const;
+
+	/** Returns the number of sub-steps needed to cover the distance with a collision shape of the given radius, between 1 and MaxSubsteps. */
+	MY_API int32 ComputeNumSubsteps(const float StepDistance, const float ShapeRadius) const;
+
+	/** Returns true if the move is short enough to be merged into the idle path. */
+	bool IsNegligibleMove(const FVector& Delta) const
+	{
+		return Delta.SizeSquared() < FMath::Square(MinMoveDistance) || Delta.IsNearlyZero();
+	}
+};
+
+#undef MY_API
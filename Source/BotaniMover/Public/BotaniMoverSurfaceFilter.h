@@ -0,0 +1,54 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+#include "BotaniMoverSurfaceFilter.generated.h"
+
+class UPrimitiveComponent;
+struct FCollisionQueryParams;
+struct FOverlapResult;
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Per component opt-in and opt-out of movement queries, like wall running or vaulting, by component or actor tag.
+ * Candidates that fail the filter are skipped and counted in STAT_BotaniMover_FilteredCandidates.
+ */
+USTRUCT(BlueprintType)
+struct FBotaniMoverSurfaceFilter
+{
+	GENERATED_BODY()
+
+	FBotaniMoverSurfaceFilter() = default;
+
+	FBotaniMoverSurfaceFilter(const FName InRequiredTag, const FName InExcludedTag)
+		: RequiredTag(InRequiredTag)
+		, ExcludedTag(InExcludedTag)
+	{
+	}
+
+	/** Returns true if this filter lets every component pass. */
+	bool IsEmpty() const { return RequiredTag.IsNone() && ExcludedTag.IsNone(); }
+
+	/** Returns true if the component, or its owning actor, passes the filter. */
+	MY_API bool PassesFilter(const UPrimitiveComponent* Component) const;
+
+	/**
+	 * Adds the candidates that fail the filter to the query's ignore list, so a single query within the candidates' overlap
+	 * only finds components that pass.
+	 */
+	MY_API void AddIgnoredComponents(TConstArrayView<FOverlapResult> Candidates, FCollisionQueryParams& InOutQueryParams) const;
+
+	/** If set, only components or actors with this tag pass the filter. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+	FName RequiredTag;
+
+	/** Components or actors with this tag never pass the filter. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Filter")
+	FName ExcludedTag;
+};
+
+#undef MY_API
@@ -0,0 +1,132 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "MoverTypes.h"
+
+#include "BotaniMoverTagsSyncState.generated.h"
+
+#define MY_API BOTANIMOVER_API
+
+struct FMoverSyncState;
+
+/** One bit per native tag declared in BotaniMoverTags.h, so hot tag checks are a single mask test. */
+namespace BotaniMover::TagBits
+{
+	constexpr uint16 None = 0;
+	constexpr uint16 Walking = 1 << 0;
+	constexpr uint16 Sprinting = 1 << 1;
+	constexpr uint16 Crouching = 1 << 2;
+	constexpr uint16 Falling = 1 << 3;
+	constexpr uint16 Sliding = 1 << 4;
+	constexpr uint16 PowerSliding = 1 << 5;
+	constexpr uint16 WallRunning = 1 << 6;
+	constexpr uint16 Grappling = 1 << 7;
+	constexpr uint16 CannotMove = 1 << 8;
+
+	constexpr int32 NumBits = 9;
+
+	/** Returns the native botani tag of the bit at the given index. */
+	MY_API FGameplayTag GetBitTag(const int32 BitIndex);
+
+	/** Returns the bit of a native botani tag, or None if the tag doesn't have one. */
+	MY_API uint16 GetTagBit(const FGameplayTag& Tag);
+
+	/** Returns the bits of all tags in the container that have one, tags without a bit are skipped. */
+	MY_API uint16 GetTagBits(const FGameplayTagContainer& Tags);
+}
+
+/**
+ * A tag container pre-compiled into a BotaniMover::TagBits mask.
+ * If the container holds a tag without a bit, the mask can't represent it and the container has to be checked instead.
+ */
+struct FBotaniCompiledTagMask
+{
+public:
+	/** Compiles the tags into the mask. */
+	MY_API void Compile(const FGameplayTagContainer& Tags);
+
+	/** Returns true if no tags were compiled. */
+	bool IsEmpty() const { return bEmpty; }
+
+	/** Returns true if every compiled tag is represented by the mask. */
+	bool IsMaskOnly() const { return bMaskOnly; }
+
+	uint16 GetMask() const { return Mask; }
+
+private:
+	uint16 Mask = BotaniMover::TagBits::None;
+	bool bMaskOnly = true;
+	bool bEmpty = true;
+};
+
+/**
+ * Native botani tags as a bitmask, rebuilt at the end of every simulation tick.
+ * Movement tags mirror the FGameplayTagsSyncState, mode tags are the static tags of the active movement mode.
+ */
+USTRUCT(BlueprintType)
+struct FBotaniMoverTagsSyncState : public FMoverDataStructBase
+{
+	GENERATED_BODY()
+
+public:
+	FBotaniMoverTagsSyncState() = default;
+	virtual ~FBotaniMoverTagsSyncState() override {}
+
+	uint16 GetMovementTagBits() const { return MovementTagBits; }
+	uint16 GetModeTagBits() const { return ModeTagBits; }
+
+	void SetTagBits(const uint16 InMovementTagBits, const uint16 InModeTagBits)
+	{
+		MovementTagBits = InMovementTagBits;
+		ModeTagBits = InModeTagBits;
+	}
+
+	/** Returns true if any of the bits is set, in either the movement or the mode tags. */
+	bool HasAnyTagBits(const uint16 Bits) const
+	{
+		return ((MovementTagBits | ModeTagBits) & Bits) != 0;
+	}
+
+	/**
+	 * Returns true if the movement tags of the sync state contain all of the required tags.
+	 * Uses the mask if it can, otherwise the FGameplayTagsSyncState containers.
+	 */
+	static MY_API bool HasAllMovementTags(const FMoverSyncState& SyncState, const FBotaniCompiledTagMask& Compiled, const FGameplayTagContainer& Tags);
+
+	/**
+	 * Returns true if the movement tags of the sync state contain any of the given tags.
+	 * Uses the mask if it can, otherwise the FGameplayTagsSyncState containers.
+	 */
+	static MY_API bool HasAnyMovementTags(const FMoverSyncState& SyncState, const FBotaniCompiledTagMask& Compiled, const FGameplayTagContainer& Tags);
+
+public:
+	//~ Begin FMoverDataStructBase Interface
+	MY_API virtual FMoverDataStructBase* Clone() const override;
+	MY_API virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+	MY_API virtual UScriptStruct* GetScriptStruct() const override;
+	MY_API virtual void ToString(FAnsiStringBuilderBase& Out) const override;
+	MY_API virtual bool ShouldReconcile(const FMoverDataStructBase& AuthorityState) const override;
+	MY_API virtual void Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float Pct) override;
+	//~ End FMoverDataStructBase Interface
+
+private:
+	/** BotaniMover::TagBits of the FGameplayTagsSyncState movement tags. */
+	uint16 MovementTagBits = BotaniMover::TagBits::None;
+
+	/** BotaniMover::TagBits of the active movement mode. */
+	uint16 ModeTagBits = BotaniMover::TagBits::None;
+};
+
+template<>
+struct TStructOpsTypeTraits< FBotaniMoverTagsSyncState > : public TStructOpsTypeTraitsBase2< FBotaniMoverTagsSyncState >
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true
+	};
+};
+
+#undef MY_API
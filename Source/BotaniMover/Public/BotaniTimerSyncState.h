@@ -0,0 +1,155 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "MoverTypes.h"
+
+#include "BotaniTimerSyncState.generated.h"
+
+#define MY_API BOTANIMOVER_API
+
+/** Timers tracked by the botani mover, each one records the simulation time of a state edge. */
+UENUM(BlueprintType)
+enum class EBotaniMoverTimer : uint8
+{
+	/** Not a timer. */
+	None = 0xFF UMETA(Hidden),
+
+	/** When the pawn started falling. */
+	LastFall = 0,
+
+	/** When the pawn stopped wall running. */
+	LastWallRun,
+
+	/** When the pawn started wall running. */
+	LastWallRunStart,
+
+	/** When the pawn jumped off a wall. */
+	LastWallJump,
+
+	/** When the pawn jumped. */
+	LastJump,
+
+	Num UMETA(Hidden),
+};
+
+/**
+ * Fixed slots of integer millisecond simulation times, one per EBotaniMoverTimer.
+ * Lives in the sync state, so it is rolled back and resimulated with the rest of the movement state.
+ * Timers are only written on state edges, see UBotaniMoverComponent::QueueTimerEdge.
+ */
+USTRUCT(BlueprintType)
+struct FBotaniTimerSyncState : public FMoverDataStructBase
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 NumTimers = static_cast<int32>(EBotaniMoverTimer::Num);
+
+	FBotaniTimerSyncState() = default;
+	virtual ~FBotaniTimerSyncState() override {}
+
+	/** Returns true if the timer has been recorded. */
+	bool HasTimer(const EBotaniMoverTimer Timer) const
+	{
+		return Timer < EBotaniMoverTimer::Num && (SetTimersMask & (1 << static_cast<uint8>(Timer))) != 0;
+	}
+
+	/** Returns the recorded simulation time of the timer in ms, if it has been recorded. */
+	bool TryGetTimeMs(const EBotaniMoverTimer Timer, int64& OutTimeMs) const
+	{
+		if (!HasTimer(Timer))
+		{
+			return false;
+		}
+
+		OutTimeMs = TimesMs[static_cast<uint8>(Timer)];
+		return true;
+	}
+
+	/** Returns the time in ms that passed since the timer was recorded, or Fallback if it hasn't been recorded. */
+	int64 GetElapsedMs(const EBotaniMoverTimer Timer, const double SimTimeMs, const int64 Fallback = MAX_int32) const
+	{
+		int64 TimeMs = 0;
+		return TryGetTimeMs(Timer, TimeMs) ? ToTimeMs(SimTimeMs) - TimeMs : Fallback;
+	}
+
+	/** Records the given simulation time for the timer. */
+	void SetTimeMs(const EBotaniMoverTimer Timer, const int64 TimeMs)
+	{
+		if (Timer < EBotaniMoverTimer::Num)
+		{
+			TimesMs[static_cast<uint8>(Timer)] = TimeMs;
+			SetTimersMask |= (1 << static_cast<uint8>(Timer));
+		}
+	}
+
+	/** Clears the timer. */
+	void ClearTimer(const EBotaniMoverTimer Timer)
+	{
+		if (Timer < EBotaniMoverTimer::Num)
+		{
+			TimesMs[static_cast<uint8>(Timer)] = 0;
+			SetTimersMask &= ~(1 << static_cast<uint8>(Timer));
+		}
+	}
+
+	/** Copies all recorded timers of Other over ours. */
+	void Apply(const FBotaniTimerSyncState& Other)
+	{
+		for (int32 Idx = 0; Idx < NumTimers; ++Idx)
+		{
+			if (Other.SetTimersMask & (1 << Idx))
+			{
+				TimesMs[Idx] = Other.TimesMs[Idx];
+			}
+		}
+
+		SetTimersMask |= Other.SetTimersMask;
+	}
+
+	/** Clears all timers. */
+	void Reset()
+	{
+		FMemory::Memzero(TimesMs);
+		SetTimersMask = 0;
+	}
+
+	/** Returns true if no timer is recorded. */
+	bool IsEmpty() const { return SetTimersMask == 0; }
+
+	/** Converts the simulation time into whole milliseconds, which doesn't lose precision after long uptimes. */
+	static int64 ToTimeMs(const double SimTimeMs)
+	{
+		return FMath::FloorToInt64(SimTimeMs);
+	}
+
+public:
+	//~ Begin FMoverDataStructBase Interface
+	MY_API virtual FMoverDataStructBase* Clone() const override;
+	MY_API virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+	MY_API virtual UScriptStruct* GetScriptStruct() const override;
+	MY_API virtual void ToString(FAnsiStringBuilderBase& Out) const override;
+	MY_API virtual bool ShouldReconcile(const FMoverDataStructBase& AuthorityState) const override;
+	MY_API virtual void Interpolate(const FMoverDataStructBase& From, const FMoverDataStructBase& To, float Pct) override;
+	//~ End FMoverDataStructBase Interface
+
+private:
+	/** Recorded simulation times in ms, indexed by EBotaniMoverTimer. */
+	int64 TimesMs[NumTimers] = {};
+
+	/** Bit per EBotaniMoverTimer, set if the timer has been recorded. */
+	uint8 SetTimersMask = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits< FBotaniTimerSyncState > : public TStructOpsTypeTraitsBase2< FBotaniTimerSyncState >
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true
+	};
+};
+
+#undef MY_API
@@ -3,8 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BotaniMoverSurfaceFilter.h"
+#include "BotaniMoverTagsSyncState.h"
 #include "MovementMode.h"
 #include "ScalableFloat.h"
+#include "MoveLibrary/BotaniCurveLookupTable.h"
 #include "MoveLibrary/WallRunningMovementUtils.h"
 #include "UObject/Object.h"
 
@@ -13,9 +16,67 @@
 #define MY_API BOTANIMOVER_API
 
 #define GetBotaniWallRunFloatProp(FloatPropertyName) \
-	BotaniWallRunSettings->FloatPropertyName.GetValue()
+	BotaniWallRunSettings->GetResolvedSettings().FloatPropertyName
 
-/** WallRunMovementSettings: collection of settings that are used among any wall-running related movement modes and transitions. */
+/**
+ * Plain snapshot of every scalable float in UBotaniWallRunMovementSettings, evaluated at the settings level.
+ * Angles and squared speeds are pre-converted, so the wall running checks don't need any trigonometry per tick.
+ */
+struct FBotaniResolvedWallRunSettings
+{
+	float WallRun_MaxSpeed = 0.f;
+	float WallRun_Acceleration = 0.f;
+	float WallRun_Deceleration = 0.f;
+	float WallRun_PullAwayAngle = 0.f;
+	float WallRun_AttractionForceMagnitude = 0.f;
+	float WallRun_BrakingDeceleration = 0.f;
+	float WallRun_SurfaceFrictionFactor = 0.f;
+	float WallRun_MinTimeBetweenRuns = 0.f;
+	float WallRun_GravityScale = 0.f;
+	float WallRun_UpwardsGravityScale = 0.f;
+	float WallRun_MinRequiredSpeed = 0.f;
+	float WallRun_MinRequiredStaticHeight = 0.f;
+	float WallRun_MinRequiredDynamicHeight = 0.f;
+	float WallRun_MinRequiredAngle = 0.f;
+	float WallRun_MaxVerticalSpeed = 0.f;
+	float WallJump_ForceMagnitude = 0.f;
+
+	/** Sine of WallRun_PullAwayAngle. */
+	float WallRun_PullAwayAngleSine = 0.f;
+
+	/** Cosine of WallRun_MinRequiredAngle. */
+	float WallRun_MinRequiredAngleCosine = 0.f;
+
+	/** WallRun_MinRequiredSpeed squared. */
+	float WallRun_MinRequiredSpeedSquared = 0.f;
+
+	/** WallRun_MaxVerticalSpeed squared. */
+	float WallRun_MaxVerticalSpeedSquared = 0.f;
+
+	/** WallRun_MinTimeBetweenRuns in milliseconds. */
+	float WallRun_MinTimeBetweenRunsMs = 0.f;
+
+	/** WallRun_MaxTime in milliseconds, or a negative value if wall running isn't time limited. */
+	float WallRun_MaxTimeMs = -1.f;
+
+	/** Baked WallRun_GravityVelScaleCurve, zero if the curve has no data. */
+	FBotaniCurveLookupTable WallRun_GravityVelScaleTable;
+
+	/** Baked WallRun_GravityTimeScaleCurve, one if the curve has no data. */
+	FBotaniCurveLookupTable WallRun_GravityTimeScaleTable;
+
+	/** WallRunningRequiredTags compiled into tag bits. */
+	FBotaniCompiledTagMask WallRunningRequiredTagsMask;
+
+	/** WallRunningBlockedTags compiled into tag bits. */
+	FBotaniCompiledTagMask WallRunningBlockedTagsMask;
+};
+
+/**
+ * WallRunMovementSettings: collection of settings that are used among any wall-running related movement modes and transitions.
+ * The scalable floats are resolved into a plain snapshot whenever they may have changed,
+ * call RebuildResolvedSettings after changing them at runtime. Instances shared by an archetype can't be changed.
+ */
 UCLASS(MinimalAPI, BlueprintType)
 class UBotaniWallRunMovementSettings
 	: public UObject
@@ -30,6 +91,52 @@ public:
 	virtual FString GetDisplayName() const override { return GetName(); }
 	//~ End IMovementSettingsInterface
 
+	//~ Begin UObject Interface
+	MY_API virtual void PostInitProperties() override;
+	MY_API virtual void PostLoad() override;
+	MY_API virtual void PostDuplicate(bool bDuplicateForPIE) override;
+#if WITH_EDITOR
+	MY_API virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject Interface
+
+	/** Returns the snapshot of all scalable floats, evaluated at the current settings level. */
+	const FBotaniResolvedWallRunSettings& GetResolvedSettings() const { return ResolvedSettings; }
+
+	/**
+	 * Re-evaluates all scalable floats into the resolved snapshot.
+	 * Rejected for instances shared by an archetype, use the movement settings modifiers of the mover component for per pawn changes.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Settings")
+	MY_API void RebuildResolvedSettings();
+
+	/** Sets the level the scalable floats are evaluated at and rebuilds the resolved snapshot. Rejected for instances shared by an archetype. */
+	UFUNCTION(BlueprintCallable, Category="Settings")
+	MY_API void SetSettingsLevel(float InLevel);
+
+	/** Returns the level the scalable floats are evaluated at. */
+	UFUNCTION(BlueprintPure, Category="Settings")
+	float GetSettingsLevel() const { return SettingsLevel; }
+
+protected:
+#if WITH_EDITOR
+	/** Listens for changes to the curve tables referenced by the scalable floats. */
+	MY_API void BindCurveTableDelegates();
+
+	/** Called when a curve table referenced by one of the scalable floats changed. */
+	MY_API void HandleCurveTableChanged();
+#endif
+
+	/** Re-evaluates all scalable floats into the resolved snapshot, without checking whether the instance is shared. */
+	MY_API void UpdateResolvedSettings();
+
+	/** The level all scalable floats are evaluated at. */
+	UPROPERTY(EditAnywhere, Category="Settings")
+	float SettingsLevel = 0.f;
+
+	/** Snapshot of all scalable floats, evaluated at SettingsLevel. */
+	FBotaniResolvedWallRunSettings ResolvedSettings;
+
 public:
 	/** The maximum speed the character can move while wall running. */
 	UPROPERTY(EditAnywhere, Category="General", meta = (ScriptName="WallRunMaxSpeed", DisplayName="Wall Run Max Speed (cm/s)"))
@@ -71,7 +178,7 @@ public:
 	UPROPERTY(EditAnywhere, Category="General", meta = (DisplayName = "Wall Run [Gravity x Velocity] Scale Curve", ScriptName = "WallRunGravityVelScaleCurve"))
 	FRuntimeFloatCurve WallRun_GravityVelScaleCurve;
 
-	/** Runtime curve used to determine the gravity scale over time while wall running. */
+	/** Runtime curve used to determine the gravity scale over time while wall running. Multiplied with the velocity scale. */
 	UPROPERTY(EditAnywhere, Category="General", meta = (DisplayName = "Wall Run [Gravity x Time] Scale Curve"))
 	FRuntimeFloatCurve WallRun_GravityTimeScaleCurve;
 
@@ -86,9 +193,9 @@ public:
 	UPROPERTY(EditAnywhere, Category="General")
 	uint32 bResetTimerOnlyOnLand:1;
 
-	/** Enum telling which side of the wall the character is running on. */
-	UPROPERTY(BlueprintReadOnly, Category="Evaluation")
-	TEnumAsByte<EBotaniWallRunSide> WallRunSide;
+	/** Settings are shared and must not hold per pawn state, the side is stored in FWallCheckResult now. */
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage="Use FWallCheckResult::GetWallSide from the sim blackboard instead."))
+	TEnumAsByte<EBotaniWallRunSide> WallRunSide_DEPRECATED;
 
 	/** Delta used for vector's tail in wall trace. */
 	UPROPERTY(EditAnywhere, Category="Evaluation")
@@ -98,6 +205,41 @@ public:
 	UPROPERTY(EditAnywhere, Category="Evaluation")
 	float WallTraceVectorsHeadDelta = 90.f;
 
+	/** Channel the wall probes run on. A channel only runnable geometry blocks keeps props, foliage and pawns out of the probes. */
+	UPROPERTY(EditAnywhere, Category="Collision")
+	TEnumAsByte<ECollisionChannel> WallTraceChannel;
+
+	/** Channel used to check the height above the floor when starting and while wall running. */
+	UPROPERTY(EditAnywhere, Category="Collision")
+	TEnumAsByte<ECollisionChannel> FloorTraceChannel;
+
+	/** Tags that opt components in or out of being wall run on. */
+	UPROPERTY(EditAnywhere, Category="Collision")
+	FBotaniMoverSurfaceFilter WallSurfaceFilter;
+
+	/** Gap the wall attraction keeps between the capsule and the wall, like ground movement keeps one to the floor. */
+	UPROPERTY(EditAnywhere, Category="Collision", meta=(ClampMin=0, Units=cm))
+	float WallRunSkinWidth = 2.f;
+
+	/**
+	 * Whether to capture the plane of planar walls and derive the wall from it, instead of probing for the wall every tick.
+	 * The wall is still confirmed by a single trace whenever the pawn moved further than its radius along it.
+	 */
+	UPROPERTY(EditAnywhere, Category="Evaluation|Wall Plane")
+	uint32 bUseWallPlane : 1;
+
+	/** How close the pawn may get to the edge of a captured wall plane before the wall is probed again. */
+	UPROPERTY(EditAnywhere, Category="Evaluation|Wall Plane", meta=(EditCondition="bUseWallPlane", ClampMin=0, Units=cm))
+	float WallPlaneEdgeMargin = 50.f;
+
+	/** The wall is probed again after this time, even if the pawn is still well inside of the captured plane. */
+	UPROPERTY(EditAnywhere, Category="Evaluation|Wall Plane", meta=(EditCondition="bUseWallPlane", ClampMin=0, Units=s))
+	float WallPlaneRevalidationInterval = 0.25f;
+
+	/** Distance around the contact within which the wall must be planar for its plane to be captured. */
+	UPROPERTY(EditAnywhere, Category="Evaluation|Wall Plane", meta=(EditCondition="bUseWallPlane", ClampMin=1, Units=cm))
+	float WallPlanePlanarityProbeDistance = 50.f;
+
 	/** Tags required on the sync state to allow the wall running transition */
 	UPROPERTY(EditAnywhere, Category="Evaluation")
 	FGameplayTagContainer WallRunningRequiredTags;
@@ -159,9 +301,9 @@ public:
 	UPROPERTY(EditAnywhere, Category = "General", AdvancedDisplay)
 	uint32 bDrawWallRunDebug : 1;
 
-	/** Time WHEN the character started wall running. */
-	UPROPERTY(BlueprintReadOnly, Category = "General", AdvancedDisplay)
-	float WallRunTime;
+	/** Settings are shared and must not hold per pawn state, the start time is stored in the timer sync state. */
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage="Use the LastWallRunStart timer of FBotaniTimerSyncState instead."))
+	float WallRunTime_DEPRECATED;
 };
 
 #undef MY_API
@@ -0,0 +1,136 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "BotaniMoverAbilityStateInputs.h"
+#include "GameplayTagContainer.h"
+#include "MoverSimulationTypes.h"
+#include "Components/PawnComponent.h"
+
+#include "BotaniMoverAbilityMirrorComponent.generated.h"
+
+class UAbilitySystemComponent;
+class UMoverComponent;
+struct FOnAttributeChangeData;
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Pawn component that mirrors the ability system state the movement simulation cares about.
+ * It listens to tag and attribute changes on the ability system component and writes the latest values
+ * into FBotaniMoverAbilityStateInputs whenever an input command is produced, so the simulation never touches the ability system.
+ */
+UCLASS(BlueprintType, DisplayName="Mover Ability Mirror Component", MinimalAPI)
+class UBotaniMoverAbilityMirrorComponent
+	: public UPawnComponent
+	, public IMoverInputProducerInterface
+{
+	GENERATED_BODY()
+
+public:
+	MY_API UBotaniMoverAbilityMirrorComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	//~ Begin UActorComponent Interface
+	MY_API virtual void BeginPlay() override;
+	MY_API virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~ End UActorComponent Interface
+
+	//~ Begin IMoverInputProducerInterface Interface
+	MY_API virtual void ProduceInput_Implementation(int32 SimTimeMs, FMoverInputCmdContext& InputCmdResult) override;
+	//~ End IMoverInputProducerInterface Interface
+
+	/**
+	 * Starts mirroring the given ability system component, replacing the previous one.
+	 * Call this if the ability system component isn't available at BeginPlay, e.g. when it lives on the player state.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Mover")
+	MY_API void BindToAbilitySystem(UAbilitySystemComponent* InAbilitySystem);
+
+	/** Stops mirroring the current ability system component and resets the mirrored state. */
+	UFUNCTION(BlueprintCallable, Category="Mover")
+	MY_API void UnbindFromAbilitySystem();
+
+	/** Adds the mirrored ability state to the given input command. Call this from the pawn's input producer if it doesn't forward to components. */
+	MY_API void WriteAbilityStateInputs(FMoverInputCmdContext& InputCmd) const;
+
+	/** Returns the currently mirrored ability state. */
+	const FBotaniMoverAbilityStateInputs& GetMirroredState() const { return MirroredState; }
+
+	/**
+	 * Validates an ability state authored by a remote client against the state mirrored here.
+	 * Restrictions are combined, and the multipliers may only be lowered below the mirrored ones.
+	 */
+	MY_API void ClampToMirroredState(FBotaniMoverAbilityStateInputs& InOutState) const;
+
+protected:
+	/** Called when the stop movement tag is added or removed. */
+	MY_API void OnStopMovementTagChanged(const FGameplayTag Tag, int32 NewCount);
+
+	/** Called when the max speed multiplier attribute changed. */
+	MY_API void OnMaxSpeedMultiplierChanged(const FOnAttributeChangeData& ChangeData);
+
+	/** Called when the acceleration multiplier attribute changed. */
+	MY_API void OnAccelerationMultiplierChanged(const FOnAttributeChangeData& ChangeData);
+
+public:
+	/** Tag that will stop movement if present. Defaults to the StopMovementTag of the botani mover settings if not set. */
+	UPROPERTY(EditDefaultsOnly, Category="Mover")
+	FGameplayTag StopMovementTag;
+
+	/** Attribute that scales the max speed of the movement modes. */
+	UPROPERTY(EditDefaultsOnly, Category="Mover")
+	FGameplayAttribute MaxSpeedMultiplierAttribute;
+
+	/** Attribute that scales the acceleration of the movement modes. */
+	UPROPERTY(EditDefaultsOnly, Category="Mover")
+	FGameplayAttribute AccelerationMultiplierAttribute;
+
+private:
+	/** The ability system component we are currently mirroring. */
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UAbilitySystemComponent> WeakAbilitySystem;
+
+	/** The latest ability state, written to every produced input command. */
+	FBotaniMoverAbilityStateInputs MirroredState;
+
+	/** The stop movement tag we registered for, resolved when binding. */
+	FGameplayTag BoundStopMovementTag;
+
+	/** Handles of the bound ability system delegates. */
+	FDelegateHandle StopMovementTagHandle;
+	FDelegateHandle MaxSpeedMultiplierHandle;
+	FDelegateHandle AccelerationMultiplierHandle;
+};
+
+/**
+ * Where a movement mode gets the ability state it simulates with.
+ * The mirror component and the ability system are looked up once, not every tick. Reset it when the mode is registered again.
+ */
+struct FBotaniMoverAbilityStateSource
+{
+public:
+	/**
+	 * Returns the ability state to simulate with.
+	 * It comes from the input command, validated against the authority's own mirrored state if we are the authority.
+	 * Pawns without a UBotaniMoverAbilityMirrorComponent fall back to querying the stop movement tag from the ability system,
+	 * which has to exist by the first tick then. Pawns whose ability system comes later should use a mirror component.
+	 */
+	MY_API FBotaniMoverAbilityStateInputs Resolve(const UMoverComponent* MoverComp, const FMoverInputCmdContext& InputCmd, const FGameplayTag& StopMovementTag);
+
+	/** Forgets the looked up components, so they are looked up again. */
+	void Reset() { *this = FBotaniMoverAbilityStateSource(); }
+
+private:
+	/** The owner's ability mirror component. */
+	TWeakObjectPtr<const UBotaniMoverAbilityMirrorComponent> AbilityMirror;
+
+	/** The owner's ability system component, only used without an ability mirror component. */
+	TWeakObjectPtr<const UAbilitySystemComponent> AbilitySystem;
+
+	/** Whether the components were looked up already. */
+	bool bLookedUp = false;
+};
+
+#undef MY_API
@@ -3,7 +3,17 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BotaniMovementSettingsModifierStack.h"
+#include "BotaniMoverFreeSpaceBubble.h"
+#include "BotaniMoverLandingPredictor.h"
+#include "BotaniMoverLOD.h"
+#include "BotaniMoverProbeService.h"
+#include "BotaniMoverQueryCache.h"
+#include "BotaniMoverRestingState.h"
+#include "BotaniMoverTagsSyncState.h"
+#include "BotaniTimerSyncState.h"
 #include "CommonMoverComponent.h"
+#include "Subsystems/BotaniMoverQueryBudgetSubsystem.h"
 #include "DefaultMovementSet/CharacterMoverComponent.h"
 #include "Modifiers/BotaniStanceModifier.h"
 
@@ -11,6 +21,30 @@
 
 #define MY_API BOTANIMOVER_API
 
+class UBotaniMoverSettings;
+class UBotaniCommonMovementSettings;
+class UBotaniWallRunMovementSettings;
+class UBotaniStanceSettings;
+
+/** Typed slots for all Botani shared settings, resolved once when the mover component registers. */
+struct FBotaniSharedSettingsRegistry
+{
+	/** Cached botani mover settings. */
+	const UBotaniMoverSettings* MoverSettings = nullptr;
+
+	/** Cached common movement settings. */
+	const UBotaniCommonMovementSettings* MovementSettings = nullptr;
+
+	/** Cached wall running settings. */
+	const UBotaniWallRunMovementSettings* WallRunSettings = nullptr;
+
+	/** Cached stance settings. */
+	const UBotaniStanceSettings* StanceSettings = nullptr;
+
+	/** Whether the slots have been resolved from the shared settings. */
+	bool bResolved = false;
+};
+
 /**
  * Fires when a stance is changed, if stance handling is enabled (see @SetHandleStanceChanges)
  * Note: If a stance was just Activated it will fire with an invalid OldStance
@@ -28,9 +62,95 @@ class UBotaniMoverComponent
 public:
 	MY_API UBotaniMoverComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
-	//~ Begin UObject Interface
+	//~ Begin UActorComponent Interface
+	MY_API virtual void OnRegister() override;
+	MY_API virtual void OnUnregister() override;
 	MY_API virtual void BeginPlay() override;
-	//~ End UObject Interface
+	MY_API virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~ End UActorComponent Interface
+
+	/**
+	 * Returns the cached shared settings of the given type without searching the shared settings.
+	 * Types that don't have a registry slot fall back to FindSharedSettings.
+	 */
+	template<typename SettingsT>
+	const SettingsT* GetBotaniSettings() const
+	{
+		const FBotaniSharedSettingsRegistry& Registry = GetSettingsRegistry();
+		if constexpr (std::is_same_v<SettingsT, UBotaniMoverSettings>)
+		{
+			return Registry.MoverSettings;
+		}
+		else if constexpr (std::is_same_v<SettingsT, UBotaniCommonMovementSettings>)
+		{
+			return Registry.MovementSettings;
+		}
+		else if constexpr (std::is_same_v<SettingsT, UBotaniWallRunMovementSettings>)
+		{
+			return Registry.WallRunSettings;
+		}
+		else if constexpr (std::is_same_v<SettingsT, UBotaniStanceSettings>)
+		{
+			return Registry.StanceSettings;
+		}
+		else
+		{
+			return FindSharedSettings<SettingsT>();
+		}
+	}
+
+	/** Uses the settings registry if the given mover component is a Botani mover component, otherwise falls back to FindSharedSettings. */
+	template<typename SettingsT>
+	static const SettingsT* FindBotaniSettings(const UMoverComponent* MoverComp)
+	{
+		if (const UBotaniMoverComponent* BotaniMoverComp = Cast<UBotaniMoverComponent>(MoverComp))
+		{
+			return BotaniMoverComp->GetBotaniSettings<SettingsT>();
+		}
+
+		return MoverComp ? MoverComp->FindSharedSettings<SettingsT>() : nullptr;
+	}
+
+	/** Returns the settings registry, resolving it first if needed. */
+	const FBotaniSharedSettingsRegistry& GetSettingsRegistry() const
+	{
+		if (!SettingsRegistry.bResolved)
+		{
+			const_cast<ThisClass*>(this)->RefreshSettingsRegistry();
+		}
+
+		return SettingsRegistry;
+	}
+
+	/** Re-resolves the settings registry. Call this after shared settings were added or replaced at runtime. */
+	MY_API void RefreshSettingsRegistry();
+
+	/**
+	 * Returns the approximate number of bytes this component saved by sharing its settings with other pawns of the same archetype.
+	 * Only the size of the settings objects is counted, see UBotaniMoverArchetypeSubsystem::ShareSettingsWithArchetype.
+	 */
+	int64 GetSharedSettingsSavedBytes() const { return SharedSettingsSavedBytes; }
+
+	/**
+	 * Pushes movement settings deltas under the given source, replacing any deltas previously pushed by it.
+	 * The shared movement settings are never modified, the deltas only affect this component's effective settings.
+	 * Changes take effect from the next simulation tick on and are rewound when ticks are simulated again.
+	 */
+	UFUNCTION(BlueprintCallable, Category=BotaniMover)
+	MY_API void PushMovementSettingsModifier(FName Source, const TArray<FBotaniMovementSettingsDelta>& Deltas, int32 Priority = 0);
+
+	/** Removes the movement settings deltas pushed by the given source. */
+	UFUNCTION(BlueprintCallable, Category=BotaniMover)
+	MY_API bool PopMovementSettingsModifier(FName Source);
+
+	/** Returns the common movement settings with all pushed modifiers applied. */
+	MY_API const FBotaniResolvedMovementSettings& GetEffectiveMovementSettings() const;
+
+	/**
+	 * Returns the effective movement settings of the given mover component.
+	 * Falls back to the resolved base settings if the component is not a Botani mover component.
+	 */
+	static MY_API const FBotaniResolvedMovementSettings& GetEffectiveMovementSettings(const UMoverComponent* MoverComp, const UBotaniCommonMovementSettings* BaseSettings);
 
 	/** Returns whether this component is tasked with handling character stance changes, including crouching. */
 	UFUNCTION(BlueprintGetter)
@@ -44,6 +164,169 @@ public:
 	UFUNCTION(BlueprintPure, Category="Mover")
 	MY_API virtual bool IsWallRunning() const;
 
+	/** Returns true if any of the BotaniMover::TagBits is set in the last simulated sync state. */
+	MY_API bool HasAnyTagBits(const uint16 Bits) const;
+
+	/**
+	 * Records a timer edge at the given simulation time, pass the BaseSimTimeMs of the sub-step the edge happened in.
+	 * Edges are committed to the FBotaniTimerSyncState once the movement of the simulation tick is done.
+	 * Only call this from within the simulation, so the edge is queued again when the tick is simulated again after a correction.
+	 */
+	MY_API void QueueTimerEdge(const EBotaniMoverTimer Timer, const double SimTimeMs);
+
+	/**
+	 * Records a timer edge at the start of the current sub-step, for code that has no time step at hand like Activate.
+	 * That's the latest time passed to QueueTimerEdge or SetTimerEdgeSimTime during this tick.
+	 */
+	MY_API void QueueTimerEdge(const EBotaniMoverTimer Timer);
+
+	/** Records a timer edge on the given mover component, if it is a botani mover component. */
+	static MY_API void QueueTimerEdge(UMoverComponent* MoverComp, const EBotaniMoverTimer Timer, const double SimTimeMs);
+
+	/** Records a timer edge at the start of the current sub-step on the given mover component, if it is a botani mover component. */
+	static MY_API void QueueTimerEdge(UMoverComponent* MoverComp, const EBotaniMoverTimer Timer);
+
+	/** Advances the time edges without a time of their own are stamped with, modes call it with the end of each sub-step they simulate. */
+	MY_API void SetTimerEdgeSimTime(const double SimTimeMs);
+
+	/** Advances the timer edge time of the given mover component, if it is a botani mover component. */
+	static MY_API void SetTimerEdgeSimTime(UMoverComponent* MoverComp, const double SimTimeMs);
+
+	/** Writes all queued timer edges into the given sync state. */
+	MY_API void CommitTimerEdges(FMoverSyncState& SyncState);
+
+	/**
+	 * Returns the simulation time in ms that passed since the timer was recorded, or Fallback if it never was.
+	 * Edges queued during the current simulation tick take precedence over the start sync state.
+	 */
+	MY_API int64 GetTimerElapsedMs(const FMoverSyncState& StartSyncState, const EBotaniMoverTimer Timer, const double SimTimeMs, const int64 Fallback = MAX_int32) const;
+
+	/** Returns the timer elapsed time of the given mover component. */
+	static MY_API int64 GetTimerElapsedMs(const UMoverComponent* MoverComp, const FMoverSyncState& StartSyncState, const EBotaniMoverTimer Timer, const double SimTimeMs, const int64 Fallback = MAX_int32);
+
+	/** Returns the world query results of the current simulation frame. Queries are const, so the cache is mutable. */
+	FBotaniMoverQueryCache& GetQueryCache() const { return QueryCache; }
+
+	/** Returns the query cache of the given mover component, or nullptr if it is not a botani mover component. */
+	static MY_API FBotaniMoverQueryCache* FindQueryCache(const UMoverComponent* MoverComp);
+
+	/**
+	 * Returns the collision params shared by all of this component's queries, building them if needed.
+	 * They are rebuilt when actors are attached or detached or the updated component's collision settings change.
+	 */
+	MY_API const FBotaniMoverCollisionParams& GetCollisionParams() const;
+
+	/**
+	 * Returns the cached collision params of the given mover component.
+	 * If it is not a botani mover component, the params are built into Scratch instead.
+	 */
+	static MY_API const FBotaniMoverCollisionParams& FindCollisionParams(const UMoverComponent* MoverComp, FBotaniMoverCollisionParams& Scratch);
+
+	/** Returns the prefetched airborne probes. Probes are consumed by const queries, so the service is mutable. */
+	FBotaniMoverProbeService& GetProbeService() const { return ProbeService; }
+
+	/** Returns the probe service of the given mover component, or nullptr if it is not a botani mover component. */
+	static MY_API FBotaniMoverProbeService* FindProbeService(const UMoverComponent* MoverComp);
+
+	/**
+	 * Prefetches the candidates of a probe for the given simulation frame, using this component's collision params.
+	 * Does nothing if probe prefetching is disabled. The AsyncProbeMargin is added to the radius.
+	 */
+	MY_API void RequestPrefetchProbe(const EBotaniMoverProbe Probe, const int32 ForSimFrame, const FVector& Center, const float Radius,
+		const ECollisionChannel CollisionChannel, const FCollisionResponseParams& ResponseParams = FCollisionResponseParams::DefaultResponseParam);
+
+	/**
+	 * Returns true if moving the updated component by Delta keeps it inside the free space bubble, so the move can skip its sweep.
+	 * Establishes a new bubble around the updated component if there is none or the move would leave it.
+	 * The bubble only covers the static world, dynamic objects are checked with a synchronous overlap before every move that skips its sweep.
+	 * @param SupportNormal	Normal of the floor or wall the pawn moves along, zero if it isn't supported by anything.
+	 * @param SupportGap	Gap between the capsule and the supporting surface.
+	 */
+	MY_API bool CanMoveWithoutSweep(const FVector& Delta, const FVector& SupportNormal = FVector::ZeroVector, const float SupportGap = 0.f);
+
+	/** Returns true if the given mover component can move by Delta without a sweep, see CanMoveWithoutSweep. */
+	static MY_API bool CanMoveWithoutSweep(UMoverComponent* MoverComp, const FVector& Delta, const FVector& SupportNormal = FVector::ZeroVector, const float SupportGap = 0.f);
+
+	/**
+	 * Returns true if a falling move at MoveVelocity follows the predicted falling arc, so it can skip its sweep until close to the predicted impact.
+	 * Casts a new arc if there is none, or the previous one was left or made for a different gravity or move input.
+	 * @param StartSimTimeMs	Simulation time at the start of the move, which is later than the tick start for sub-steps.
+	 * @param StartVelocity	Velocity at the start of the tick, the difference to MoveVelocity is the acceleration along the arc.
+	 * @param MoveInput		Direction intent of the move.
+	 */
+	MY_API bool CanFallWithoutSweep(const double StartSimTimeMs, const FVector& StartVelocity, const FVector& MoveVelocity, const FVector& MoveInput, const float DeltaSeconds) const;
+
+	/** Returns true if the given mover component can fall without a sweep, see CanFallWithoutSweep. */
+	static MY_API bool CanFallWithoutSweep(const UMoverComponent* MoverComp, const double StartSimTimeMs, const FVector& StartVelocity, const FVector& MoveVelocity, const FVector& MoveInput, const float DeltaSeconds);
+
+	/** Returns the current landing prediction. */
+	const FBotaniMoverLandingPredictor& GetLandingPredictor() const { return LandingPredictor; }
+
+	/** Returns true if the move of the given mover component that ended at SimTimeMs followed its predicted falling arc without a sweep. */
+	static MY_API bool IsFollowingLandingPrediction(const UMoverComponent* MoverComp, const double SimTimeMs);
+
+	/** Returns the resting state of the given mover component, or nullptr if it is not a botani mover component or resting is disabled. */
+	static MY_API FBotaniMoverRestingState* FindRestingState(const UMoverComponent* MoverComp);
+
+	/**
+	 * Counts a quiet ground tick on Floor at the current transform, see FBotaniMoverRestingState::AccumulateQuietTick.
+	 * Returns true if the pawn rests afterwards.
+	 */
+	MY_API bool AccumulateQuietTick(const FFloorCheckResult& Floor) const;
+
+	/** Returns true if the pawn rests at its current transform, so its ground ticks skip the floor queries and the ground move. */
+	UFUNCTION(BlueprintPure, Category="Mover")
+	MY_API bool IsResting() const;
+
+	/** Wakes the pawn from resting. Call this for movement effects that don't go through input, layered moves or the settings modifiers. */
+	UFUNCTION(BlueprintCallable, Category="Mover")
+	MY_API void WakeFromRest();
+
+	/** Returns the query budget bookkeeping of the given mover component, or nullptr if it is not a botani mover component. */
+	static MY_API FBotaniMoverQueryBudgetState* FindQueryBudgetState(const UMoverComponent* MoverComp);
+
+	/** Returns the active movement LOD tier of the given mover component, or nullptr if it runs at full fidelity. */
+	static MY_API const FBotaniMoverLODTier* FindLODTier(const UMoverComponent* MoverComp);
+
+	/**
+	 * Returns the active movement LOD tier whose features may change the simulation result, or nullptr if it runs at full fidelity.
+	 * The tier is picked from local inputs like the frame time, so only the authority lowers the simulation fidelity.
+	 * Every other peer simulates at full fidelity and receives the authority's results through corrections.
+	 */
+	static MY_API const FBotaniMoverLODTier* FindSimulationLODTier(const UMoverComponent* MoverComp);
+
+	/** Returns the index of the active movement LOD tier in LODTiers, or INDEX_NONE if movement LOD is not used. */
+	UFUNCTION(BlueprintPure, Category="Mover|LOD")
+	MY_API int32 GetMovementLODTier() const;
+
+	/** Reselects the movement LOD tier. Runs every LODUpdateInterval, call it to react to a change right away. */
+	UFUNCTION(BlueprintCallable, Category="Mover|LOD")
+	MY_API void UpdateMovementLOD();
+
+	/** Forces the collision params to be rebuilt on their next use. */
+	UFUNCTION(BlueprintCallable, Category="Mover")
+	MY_API void InvalidateCollisionParams();
+
+	/** Returns the number of world queries that were answered from the query cache. */
+	UFUNCTION(BlueprintPure, Category="Mover|Debug")
+	MY_API int64 GetQueryCacheHits() const;
+
+	/** Returns the number of world queries that missed the query cache. */
+	UFUNCTION(BlueprintPure, Category="Mover|Debug")
+	MY_API int64 GetQueryCacheMisses() const;
+
+	/** Returns the number of moves that skipped their sweep inside a free space bubble. */
+	UFUNCTION(BlueprintPure, Category="Mover|Debug")
+	MY_API int64 GetFreeSpaceHits() const;
+
+	/** Returns the number of moves that had to sweep because they weren't inside a free space bubble. */
+	UFUNCTION(BlueprintPure, Category="Mover|Debug")
+	MY_API int64 GetFreeSpaceMisses() const;
+
+	/** Returns the number of ground ticks that were skipped because the pawn was resting. */
+	UFUNCTION(BlueprintPure, Category="Mover|Debug")
+	MY_API int64 GetRestingTicks() const;
+
 protected:
 	UFUNCTION()
 	MY_API virtual void OnMoverPreSimulationTick(const FMoverTimeStep& TimeStep, const FMoverInputCmdContext& InputCmd);
@@ -51,6 +334,67 @@ protected:
 	/** Binds the simulation tick functions to the mover component. */
 	MY_API virtual void OnHandlerSettingChanged();
 
+	/** Detects ticks that are simulated again, see HandleSimulationRollback. */
+	UFUNCTION()
+	MY_API virtual void OnRollbackPreSimulationTick(const FMoverTimeStep& TimeStep, const FMoverInputCmdContext& InputCmd);
+
+	/**
+	 * Called when the simulation continues from SimTimeMs, which is not later than the last tick, e.g. when resimulating after a correction.
+	 * Drops or restores all state that lives on the component instead of the sync state.
+	 */
+	MY_API virtual void HandleSimulationRollback(const double SimTimeMs);
+
+	/** Starts a new set of timer edges for this simulation tick. */
+	UFUNCTION()
+	MY_API virtual void OnTimerPreSimulationTick(const FMoverTimeStep& TimeStep, const FMoverInputCmdContext& InputCmd);
+
+	/** Applies the sim rate of the active movement LOD tier on the authority, the other features of the tier are checked where they are used. */
+	MY_API virtual void ApplyMovementLODTier();
+
+	/** Finds the distance to the nearest player's view point, and whether we are net relevant to any player. */
+	MY_API void FindNearestPlayer(float& OutDistance, bool& bOutNetRelevant) const;
+
+	/** Wakes the pawn from resting when something starts overlapping the updated component. */
+	UFUNCTION()
+	MY_API virtual void OnRestingBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp,
+		int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	/** Invalidates the collision params when the updated component's collision settings change. */
+	MY_API void OnUpdatedComponentCollisionSettingsChanged(UPrimitiveComponent* ChangedComponent);
+
+	/**
+	 * Returns a signature of everything the collision params ignore, the updated component, its move ignore lists and our child actors.
+	 * Neither has a change event, so it's compared once per simulation tick. It only hashes pointers and walks no attachment hierarchy.
+	 */
+	MY_API uint32 ComputeAttachmentSignature() const;
+
+	/** Starts a new frame of the query cache. */
+	UFUNCTION()
+	MY_API virtual void OnQueryCachePreSimulationTick(const FMoverTimeStep& TimeStep, const FMoverInputCmdContext& InputCmd);
+
+	/** Prefetches the wall probe of the next simulation frame while we are airborne or wall running. */
+	UFUNCTION()
+	MY_API virtual void OnProbesPostMovement(const FMoverTimeStep& TimeStep, FMoverSyncState& SyncState, FMoverAuxStateContext& AuxState);
+
+	/** Rechecks the free space bubble for dynamic objects before the next simulation tick. */
+	UFUNCTION()
+	MY_API virtual void OnFreeSpacePostMovement(const FMoverTimeStep& TimeStep, FMoverSyncState& SyncState, FMoverAuxStateContext& AuxState);
+
+	/** Prefetches the dynamic objects around the next step of the predicted falling arc, or drops the prediction once we stopped falling. */
+	UFUNCTION()
+	MY_API virtual void OnLandingPostMovement(const FMoverTimeStep& TimeStep, FMoverSyncState& SyncState, FMoverAuxStateContext& AuxState);
+
+	/** Commits the timer edges of this simulation tick into the output sync state. */
+	UFUNCTION()
+	MY_API virtual void OnTimerPostMovement(const FMoverTimeStep& TimeStep, FMoverSyncState& SyncState, FMoverAuxStateContext& AuxState);
+
+	/** Rebuilds the tag bits of the output sync state. */
+	UFUNCTION()
+	MY_API virtual void OnTagsPostMovement(const FMoverTimeStep& TimeStep, FMoverSyncState& SyncState, FMoverAuxStateContext& AuxState);
+
+	/** Returns the tag bits of the static tags of a movement mode. */
+	MY_API uint16 GetModeTagBits(const FName ModeName);
+
 protected:
 	/** Delegate to be called whenever the actor's stance changes. */
 	UPROPERTY(BlueprintAssignable, Category=BotaniMover)
@@ -63,6 +407,192 @@ protected:
 	/** Whether this component should directly handle stance changes, including crouching input. */
 	UPROPERTY(EditAnywhere, BlueprintGetter=GetHandleStanceChanges, BlueprintSetter=SetHandleStanceChanges, Category=BotaniMover)
 	uint8 bHandleStanceChanges : 1 = 1;
+
+	/**
+	 * Whether the shared settings should be shared with all pawns of the same archetype instead of being instanced per pawn.
+	 * Shared settings must not be modified at runtime, use PushMovementSettingsModifier for per pawn changes.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover)
+	uint8 bShareSettingsWithArchetype : 1 = 0;
+
+	/**
+	 * Whether airborne probes, like the wall and vaulting probes, should gather their candidates one frame ahead with async overlaps.
+	 * Probes whose prediction turns out wrong fall back to synchronous queries.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover)
+	uint8 bPrefetchAirborneProbes : 1 = 1;
+
+	/** Extra radius added to prefetched probes, so small prediction errors don't force a synchronous fallback. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bPrefetchAirborneProbes", ClampMin=0, Units=cm))
+	float AsyncProbeMargin = 25.f;
+
+	/**
+	 * Whether moves in open space should skip their collision sweep while they stay inside a box that was confirmed to be free.
+	 * Used by falling, ground movement and wall running.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover)
+	uint8 bUseFreeSpaceBubble : 1 = 0;
+
+	/** Free space the bubble needs around the capsule on every side that isn't resting on a floor or wall. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseFreeSpaceBubble", ClampMin=0, Units=cm))
+	float FreeSpaceBubbleMargin = 100.f;
+
+	/** Time after which a free space bubble has to be confirmed again, even if nothing was seen entering it. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseFreeSpaceBubble", ClampMin=0, Units=s))
+	float FreeSpaceBubbleLifetime = 0.5f;
+
+	/** Time to wait after a failed attempt before establishing another free space bubble, so crowded spaces don't pay for an overlap each tick. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseFreeSpaceBubble", ClampMin=0, Units=s))
+	float FreeSpaceBubbleRetryInterval = 0.1f;
+
+	/**
+	 * Whether falling should cast its ballistic arc once and follow it without sweeps until it gets close to the predicted impact.
+	 * Anything but static geometry near the arc is detected with the prefetched airborne probes and makes the move sweep again,
+	 * so this requires bPrefetchAirborneProbes. The arc is dropped when ticks are simulated again after a correction.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bPrefetchAirborneProbes"))
+	uint8 bPredictLandings : 1 = 0;
+
+	/** How far the pawn may stray from the predicted arc before it is cast again. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bPredictLandings", ClampMin=1, Units=cm))
+	float LandingPredictionTolerance = 20.f;
+
+	/** How far ahead the falling arc is cast. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bPredictLandings", ClampMin=0.1, Units=s))
+	float LandingPredictionHorizon = 2.f;
+
+	/** How far the arc may bend away from the straight chords it is cast with. Smaller values cast more, shorter chords. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bPredictLandings", ClampMin=1, Units=cm))
+	float LandingPredictionMaxSagitta = 10.f;
+
+	/** Time to wait after an arc was blocked right away before casting another one. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bPredictLandings", ClampMin=0, Units=s))
+	float LandingPredictionRetryInterval = 0.1f;
+
+	/**
+	 * Whether a pawn standing still on a static floor should rest, skipping the floor queries and the ground move of its ground ticks.
+	 * It wakes on input, velocity, layered moves, settings modifier and stance changes, overlaps, or when it is moved from the outside.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover)
+	uint8 bUseRestingState : 1 = 1;
+
+	/** Number of quiet ground ticks in a row at the same transform before the pawn starts resting. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseRestingState", ClampMin=1))
+	int32 RestingEntryTicks = 3;
+
+	/**
+	 * How far back the movement settings modifiers can be rewound when ticks are simulated again. Should cover the longest rollback
+	 * of the backend, every change within it is kept regardless of how many there are.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(ClampMin=0.1, Units=s))
+	float ModifierHistoryDuration = 2.f;
+
+	/**
+	 * Whether pawns that aren't player controlled should lower their movement fidelity with the distance to the nearest player,
+	 * their net relevancy and the server's frame time. Player controlled pawns always use the first tier.
+	 * Tiers are only selected and applied on the authority.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover)
+	uint8 bUseMovementLOD : 1 = 0;
+
+	/** Movement LOD tiers, from the highest to the lowest fidelity. Pawns that aren't net relevant to any player use the last tier. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseMovementLOD"))
+	TArray<FBotaniMoverLODTier> LODTiers;
+
+	/** Time between two movement LOD tier selections. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseMovementLOD", ClampMin=0.05, Units=s))
+	float LODUpdateInterval = 0.25f;
+
+	/** Width of the hysteresis bands around the tier distances and the frame time budget, as a fraction of them. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseMovementLOD", ClampMin=0, ClampMax=0.5))
+	float LODHysteresis = 0.1f;
+
+	/** Time a tier has to be held before the pawn is demoted from it. Promotions happen right away. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseMovementLOD", ClampMin=0, Units=s))
+	float LODMinDwellTime = 1.f;
+
+	/** Game thread time of a dedicated server above which every pawn is demoted by one tier. 0 disables the budget, other net modes never use it. */
+	UPROPERTY(EditDefaultsOnly, Category=BotaniMover, meta=(EditCondition="bUseMovementLOD", ClampMin=0, Units=ms))
+	float LODFrameTimeBudget = 40.f;
+
+	/** Replaces our settings with the archetype's shared instances. */
+	MY_API void ShareSettingsWithArchetype();
+
+private:
+	/** Typed slots for the Botani shared settings. Only holds pointers to objects referenced by SharedSettings. */
+	FBotaniSharedSettingsRegistry SettingsRegistry;
+
+	/** Per component overrides on top of the shared movement settings. */
+	FBotaniMovementSettingsModifierStack MovementSettingsModifiers;
+
+	/** Recent states of MovementSettingsModifiers, rewound on rollback. */
+	FBotaniMovementSettingsModifierHistory MovementSettingsModifierHistory;
+
+	/** Simulation time modifier changes take effect at, the end of the current or last simulation tick. */
+	double ModifierEffectiveSimTimeMs = 0.0;
+
+	/** Approximate number of bytes saved by sharing the settings with the archetype. */
+	int64 SharedSettingsSavedBytes = 0;
+
+	/** Timer edges queued during the current simulation tick, not yet written to the sync state. */
+	FBotaniTimerSyncState PendingTimerEdges;
+
+	/** Whether a simulation tick is running, i.e. timer edges can be queued. */
+	bool bInSimulationTick = false;
+
+	/** Simulation time of the current simulation tick. */
+	double CurrentSimTimeMs = 0.0;
+
+	/** Start of the current sub-step, as far as we know it. Timer edges queued without a time are stamped with it. */
+	double TimerEdgeSimTimeMs = 0.0;
+
+	/** Simulation time the last simulation tick started at, used to detect rollbacks. */
+	double LastTickSimTimeMs = TNumericLimits<double>::Lowest();
+
+	/** World query results of the current simulation frame. */
+	mutable FBotaniMoverQueryCache QueryCache;
+
+	/** Async overlaps gathering the candidates of next frame's airborne probes. */
+	mutable FBotaniMoverProbeService ProbeService;
+
+	/** Box around the updated component that is known to be free of static geometry. */
+	FBotaniMoverFreeSpaceBubble FreeSpaceBubble;
+
+	/** Predicted arc of the current fall, moves are const so the predictor is mutable. */
+	mutable FBotaniMoverLandingPredictor LandingPredictor;
+
+	/** Whether the pawn rests on the ground, ground ticks are const during GenerateMove so the state is mutable. */
+	mutable FBotaniMoverRestingState RestingState;
+
+	/** How long our optional queries were deferred by the world's query budget, queries are const so the state is mutable. */
+	mutable FBotaniMoverQueryBudgetState QueryBudgetState;
+
+	/** Selects the active movement LOD tier. */
+	FBotaniMoverLODSelector LODSelector;
+
+	/** Periodic movement LOD tier selection. */
+	FTimerHandle LODTimerHandle;
+
+	/** Game thread time of the dedicated server, smoothed over the movement LOD updates. */
+	float SmoothedFrameTimeMs = 0.f;
+
+	/** Tick interval of the backend before any movement LOD tier was applied. */
+	float BaseSimTickInterval = 0.f;
+
+	/** Cached collision params, built on first use. */
+	mutable FBotaniMoverCollisionParams CollisionParams;
+
+	/** Attachment signature the collision params were built for. */
+	uint32 CollisionParamsSignature = 0;
+
+	/** Whether the collision params have to be rebuilt. */
+	mutable bool bCollisionParamsDirty = true;
+
+	/** The primitive whose collision settings changes we listen to. */
+	TWeakObjectPtr<UPrimitiveComponent> CollisionSettingsSource;
+
+	/** Tag bits per movement mode name, the mode tags don't change so they only have to be gathered once. */
+	TMap<FName, uint16> ModeTagBitsCache;
 };
 
 #undef MY_API
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BotaniMoverSurfaceFilter.h"
 #include "ScalableFloat.h"
 #include "Components/PawnComponent.h"
 
@@ -13,7 +14,9 @@ class UMotionWarpingComponent;
 class AActor;
 class APawn;
 class UBaseMovementMode;
+struct FMoverAuxStateContext;
 struct FMoverInputCmdContext;
+struct FMoverSyncState;
 struct FMoverTimeStep;
 struct FFrame;
 
@@ -46,6 +49,10 @@ public:
 	/** Returns the mover component that owns this vaulting component. */
 	MY_API class UBotaniMoverComponent* GetMoverComponent() const;
 
+	/** Re-evaluates the scalable floats and the slope angle cosines. Call this after changing the vaulting values at runtime. */
+	UFUNCTION(BlueprintCallable, Category = "Vaulting")
+	MY_API void RebuildResolvedVaultingValues();
+
 	/** Called when vaulting is started. */
 	UPROPERTY(BlueprintAssignable)
 	FBotaniVaultingEvent OnVaultingStarted;
@@ -55,6 +62,10 @@ protected:
 	UFUNCTION()
 	MY_API virtual void OnMoverPreSimulationTick(const FMoverTimeStep& TimeStep, const FMoverInputCmdContext& InputCmd);
 
+	/** Bound to the mover component's post movement event. Prefetches the vaulting candidates of the next frame while airborne. */
+	UFUNCTION()
+	MY_API virtual void OnMoverPostMovement(const FMoverTimeStep& TimeStep, FMoverSyncState& SyncState, FMoverAuxStateContext& AuxState);
+
 	/** Must be implemented in blueprints to handle the vaulting montage playback. */
 	UFUNCTION(BlueprintImplementableEvent)
 	void OnPlayMoverVaultingMontage(UBotaniMoverComponent* MoverComponent, UAnimMontage* Montage, UMotionWarpingComponent* MotionWarpingComponent);
@@ -84,6 +95,18 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Vaulting", meta=(DisplayName="Max Vaulting Height (cm)"))
 	FScalableFloat MaxVaultingHeight = 160.f;
 
+	/** Whether to trace for vaulting paths on VaultingTraceChannel instead of the pawn's own collision channel. */
+	UPROPERTY(EditDefaultsOnly, Category = "Vaulting|Collision")
+	uint8 bUseVaultingTraceChannel : 1 = 0;
+
+	/** Channel to trace for vaulting paths on. A channel only vaultable geometry blocks keeps props and foliage out of the traces. */
+	UPROPERTY(EditDefaultsOnly, Category = "Vaulting|Collision", meta=(EditCondition="bUseVaultingTraceChannel"))
+	TEnumAsByte<ECollisionChannel> VaultingTraceChannel = ECC_Visibility;
+
+	/** Tags that opt components in or out of being vaulted over. */
+	UPROPERTY(EditDefaultsOnly, Category = "Vaulting|Collision")
+	FBotaniMoverSurfaceFilter VaultingSurfaceFilter = FBotaniMoverSurfaceFilter(NAME_None, TEXT("NoVault"));
+
 	/** The motion warping target name to use for vaulting. */
 	UPROPERTY(EditDefaultsOnly, Category = "Vaulting|Motion Warpin")
 	FName VaultWarpTargetName = TEXT("VaultWarpTarget");
@@ -96,6 +119,18 @@ private:
 	/** Transient pointer to the mover component that owns this vaulting component. */
 	UPROPERTY(Transient)
 	TWeakObjectPtr<class UBotaniMoverComponent> WeakMoverComp;
+
+	/** Range of vaultable edge slopes, as cosines of Min/MaxVaultingSlopeAngle. */
+	FFloatRange ResolvedVaultSlopeRangeCosine;
+
+	/** Resolved value of VaultingTraceDistance. */
+	float ResolvedVaultingTraceDistance = 0.f;
+
+	/** Resolved value of MinVaultingHeight. */
+	float ResolvedMinVaultingHeight = 0.f;
+
+	/** Resolved value of MaxVaultingHeight. */
+	float ResolvedMaxVaultingHeight = 0.f;
 };
 
 #undef MY_API
@@ -9,6 +9,27 @@
 struct FGroundMoveParams;
 struct FSimulationTickParams;
 struct FHitResult;
+class IBotaniMoverPhysicalMaterial;
+
+/** Static movement properties of a physical material, cached per material by UBotaniPhysicalMaterialSubsystem. */
+struct FBotaniPhysicalMaterialMovementProperties
+{
+	/** Material whose CalculateFrictionCoefficient computes the friction. If null, it is computed as InFriction * FrictionScale + FrictionOffset. */
+	const IBotaniMoverPhysicalMaterial* FrictionSource = nullptr;
+
+	float FrictionScale = 1.f;
+	float FrictionOffset = 0.f;
+
+	/** Acceleration and deceleration overrides, only used if the matching flag is set. */
+	float AccelerationOverride = 0.f;
+	float DecelerationOverride = 0.f;
+
+	uint8 bOverrideAcceleration : 1 = 0;
+	uint8 bOverrideDeceleration : 1 = 0;
+
+	/** Applies the properties to the given move values. */
+	BOTANIMOVER_API void Apply(float& InOutFriction, float& InOutAcceleration, float& InOutDeceleration) const;
+};
 
 UINTERFACE(MinimalAPI, meta=(CannotImplementInterfaceInBlueprint))
 class UBotaniMoverPhysicalMaterial : public UInterface
@@ -25,4 +46,13 @@ public:
 
 	virtual TOptional<float> GetDecelerationOverride() const = 0;
 	virtual TOptional<float> GetAccelerationOverride() const = 0;
+
+	/**
+	 * Returns the movement properties of this material. They are gathered once and cached per material,
+	 * so they must not change at runtime.
+	 * The default implementation keeps calling CalculateFrictionCoefficient for every move.
+	 * Materials whose friction is linear in the input friction can override this and fill in FrictionScale and FrictionOffset instead,
+	 * which saves the virtual call.
+	 */
+	BOTANIMOVER_API virtual FBotaniPhysicalMaterialMovementProperties GetMovementProperties() const;
 };
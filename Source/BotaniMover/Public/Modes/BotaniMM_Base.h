@@ -4,11 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "CommonMovementMode.h"
+#include "BotaniMoverSubstepPolicy.h"
+#include "Components/BotaniMoverAbilityMirrorComponent.h"
 
 #include "BotaniMM_Base.generated.h"
 
 class UObject;
-class UAbilitySystemComponent;
 class UBotaniCommonMovementSettings;
 class UBotaniMoverSettings;
 
@@ -27,6 +28,28 @@ public:
 	//~ End UCommonMovementMode Interface
 
 protected:
+	/** Shortens the simulated step to the first sub-step picked by the SubstepPolicy, the rest is refunded after ApplyMovement. */
+	virtual bool PrepareSimulationData(const FSimulationTickParams& Params) override;
+
+	/** Returns the ability state to simulate with, see FBotaniMoverAbilityStateSource::Resolve. */
+	FBotaniMoverAbilityStateInputs GetAbilityState(const FMoverTickStartData& StartState) const;
+
+	/**
+	 * Scales the max speed and acceleration by the mirrored multipliers.
+	 * A pawn that can't move loses its control input, but keeps its momentum and gravity while it isn't on the ground.
+	 */
+	void ApplyAbilityState(const FMoverTickStartData& StartState, float& InOutMaxSpeed, float& InOutAcceleration, FVector& InOutMoveInput) const;
+
+	/** How this mode splits fast moves into sub-steps. */
+	UPROPERTY(EditAnywhere, Category=Substepping)
+	FBotaniMoverSubstepPolicy SubstepPolicy;
+
+	/** Part of the simulation step left for the following sub-steps, it has to be added to the refunded time of this sub-step. */
+	float UnusedStepMs = 0.f;
+
+	/** Simulation time at the start of the current sub-step. */
+	double SubstepStartSimTimeMs = 0.0;
+
 	/** Pointer to the botani mover settings. */
 	UPROPERTY()
 	TObjectPtr<const UBotaniMoverSettings> BotaniMoverSettings;
@@ -36,7 +59,6 @@ protected:
 	TObjectPtr<const UBotaniCommonMovementSettings> BotaniMovementSettings;
 
 private:
-	/** Transient pointer to the owning actor's ability system component. */
-	UPROPERTY(Transient)
-	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+	/** Where the ability state comes from, looked up once per registration. */
+	mutable FBotaniMoverAbilityStateSource AbilityStateSource;
 };
@@ -22,6 +22,9 @@ public:
 
 	//~ Begin UCommonMovementMode Interface
 
+	/** Records the fall start time on activation */
+	virtual void Activate() override;
+
 	/** Clears blackboard fields on deactivation */
 	virtual void Deactivate() override;
 
@@ -36,9 +39,6 @@ protected:
 	/** Handles most of the actual movement, including collision recovery  */
 	virtual void ApplyMovement(FMoverTickEndData& OutputState) override;
 
-	/** Handles any additional behaviors after the updated component's final position and velocity have been computed */
-	virtual void PostMove(FMoverTickEndData& OutputState) override;
-
 	/** Captures the final movement values and sends it to the Output Sync State */
 	void CaptureFinalState(const FFloorCheckResult& FloorResult, float DeltaSecondsUsed, FMoverTickEndData& TickEndData, FMovementRecord& Record);
 
@@ -64,8 +64,4 @@ protected:
 	/** Gameplay Event to send to the actor when we landed. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Events)
 	FGameplayTag LandingEventTag;
-
-protected:
-	/** Effective Velocity calculated this frame */
-	FVector EffectiveVelocity;
 };
@@ -4,13 +4,33 @@
 
 #include "CoreMinimal.h"
 #include "CommonGroundModeBase.h"
+#include "BotaniMoverSubstepPolicy.h"
+#include "Components/BotaniMoverAbilityMirrorComponent.h"
 #include "MoveLibrary/GroundMovementUtils.h"
 
 #include "BotaniMM_GroundBase.generated.h"
 
 class UBotaniCommonMovementSettings;
 class UBotaniMoverSettings;
-class UAbilitySystemComponent;
+
+/** Outcome of a composite ground move solve, see UBotaniMM_GroundBase::SolveGroundMove. */
+struct FBotaniGroundMoveSolveResult
+{
+	/**
+	 * Number of move sweeps and floor queries the solve issued.
+	 * Each call into the engine's move helpers counts once, depenetration retries they do internally aren't visible from here.
+	 */
+	int32 NumSweeps = 0;
+
+	/** Whether the first move started stuck and was resolved by depenetration instead of moving. */
+	bool bDepenetrated = false;
+
+	/** Whether we stepped up onto an obstacle. */
+	bool bSteppedUp = false;
+
+	/** Whether the final floor was taken from the step up instead of being searched. */
+	bool bReusedStepUpFloor = false;
+};
 
 /** Ground movement mode base class for the Botani game. */
 UCLASS(Abstract)
@@ -26,18 +46,54 @@ protected:
 	virtual void OnRegistered(const FName ModeName) override;
 	virtual void OnUnregistered() override;
 
+	/** Wakes the pawn from resting, other modes don't keep it. */
+	virtual void Deactivate() override;
+
+	/** Shortens the simulated step to the first sub-step picked by the SubstepPolicy, the rest is refunded after ApplyMovement. */
+	virtual bool PrepareSimulationData(const FSimulationTickParams& Params) override;
 	virtual void ApplyMovement(FMoverTickEndData& OutputState) override;
 	virtual void ValidateFloor(float FloorSweepDistance, float MaxWalkableSlopeCosine) override;
 	//~ End UCommonGroundModeBase Interface
 
+	/**
+	 * Searches the floor below the updated component, reusing a floor found from the same transform during this frame.
+	 * Returns true if the floor had to be swept for.
+	 */
+	bool FindFloorCached(const float FloorSweepDistance, const float MaxWalkableSlopeCosine, FFloorCheckResult& OutFloor) const;
+
+	/**
+	 * Runs the moving phases of a ground tick as one composite solve and leaves the floor we ended up on in CurrentFloor.
+	 * All phases share the hit of WalkData, phases whose preconditions already failed are skipped,
+	 * and the floor found by a step up is reused as the final floor.
+	 */
+	FBotaniGroundMoveSolveResult SolveGroundMove(FCommonMoveData& WalkData);
+
+	/**
+	 * Steps up onto the obstacle that blocked the move and applies the rest of the move on top of it.
+	 * Sweeps up by the step height, forward by the rest of the move and back down, then tests the floor we ended up on into OutStepUpFloor.
+	 * The step is reverted if any of the sweeps started stuck, the forward sweep got nowhere, or we'd end up higher than the step height
+	 * or on an unwalkable surface above where we started.
+	 * @param InOutNumSweeps	Incremented by every sweep and floor query issued, whether the step succeeds or not.
+	 */
+	bool TryStepUp(FCommonMoveData& WalkData, FOptionalFloorCheckResult& OutStepUpFloor, const float MaxWalkSlopeCosine, const float MaxStepHeight, const float FloorSweepDistance, int32& InOutNumSweeps);
+
+	/** Returns true if nothing asks the pawn to move: no move, jump or turn input, no velocity and no layered moves. */
+	bool IsQuiet(const FMoverTickStartData& StartState) const;
+
+	/** Returns true if the pawn rests at its current transform and stays quiet, so the tick has nothing to move. */
+	bool CanKeepResting(const FMoverTickStartData& StartState) const;
+
 	/** Applies the physical ground friction to the move parameters based on the physical material of the floor. */
 	virtual void ApplyPhysicalGroundFriction(FGroundMoveParams& MoveParams, const FFloorCheckResult& FloorToUse, const bool bOverrideFriction = true) const;
 
-	/** Returns the effective max speed for the movement mode, taking into account move restrictions. */
+	/** Returns the effective max speed for the movement mode, taking into account move restrictions and the mirrored speed multiplier. */
 	virtual float GetEffectiveMaxSpeed(const float& InMaxSpeed, const FMoverTickStartData& StartState) const;
 
-	/** Returns the ability system component of the owning actor, if available. */
-	UAbilitySystemComponent* GetAbilitySystemComponent() const;
+	/** Returns the effective acceleration for the movement mode, taking into account the mirrored acceleration multiplier. */
+	virtual float GetEffectiveAcceleration(const float& InAcceleration, const FMoverTickStartData& StartState) const;
+
+	/** Returns the ability state to simulate with, see FBotaniMoverAbilityStateSource::Resolve. */
+	FBotaniMoverAbilityStateInputs GetAbilityState(const FMoverTickStartData& StartState) const;
 
 protected:
 	/** Pointer to the botani mover settings. */
@@ -48,8 +104,20 @@ protected:
 	UPROPERTY()
 	TObjectPtr<const UBotaniCommonMovementSettings> BotaniMovementSettings;
 
+	/** How this mode splits fast moves into sub-steps, and which slow moves it merges into the idle path. */
+	UPROPERTY(EditAnywhere, Category=Substepping)
+	FBotaniMoverSubstepPolicy SubstepPolicy;
+
+	/** Part of the simulation step left for the following sub-steps, it has to be added to the refunded time of this sub-step. */
+	float UnusedStepMs = 0.f;
+
+	/** Whether nothing asks the pawn to move in the current simulation tick, set in PrepareSimulationData. */
+	bool bQuietThisTick = false;
+
+	/** Whether the pawn keeps resting in the current simulation tick, set in PrepareSimulationData. */
+	bool bRestingThisTick = false;
+
 private:
-	/** Transient pointer to the owning actor's ability system component. */
-	UPROPERTY(Transient)
-	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+	/** Where the ability state comes from, looked up once per registration. */
+	mutable FBotaniMoverAbilityStateSource AbilityStateSource;
 };
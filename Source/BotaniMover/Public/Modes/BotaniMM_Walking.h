@@ -27,10 +27,16 @@ public:
 protected:
 	//~ Begin UCommonMovementMode Interface
 
+	/** Gathers the sprint input for this simulation tick */
+	virtual bool PrepareSimulationData(const FSimulationTickParams& Params) override;
+
 	/** Walking needs to account for based movement so it overrides the default disabled check */
 	virtual bool CheckIfMovementDisabled();
 	//~ End UCommonMovementMode Interface
 
+	/** Returns true if the inputs ask for sprinting. */
+	static bool IsSprintRequested(const FMoverInputCmdContext& InputCmd);
+
 protected:
 	/** Gameplay Tag to use when sprinting. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Tags)
@@ -43,4 +49,8 @@ protected:
 	/** Gameplay Event to send to the owner when the player stops sprinting. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Events)
 	FGameplayTag SprintStopEventTag;
+
+private:
+	/** Whether we are sprinting in the current simulation tick, set in PrepareSimulationData. */
+	uint8 bSprintingThisTick : 1 = 0;
 };
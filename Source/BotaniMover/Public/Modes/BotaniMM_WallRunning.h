@@ -7,6 +7,7 @@
 
 #include "BotaniMM_WallRunning.generated.h"
 
+class UBotaniWallRunMovementSettings;
 struct FWallRunMoveParams;
 struct FWallCheckResult;
 /** Wall Running mode for Botani game. */
@@ -19,8 +20,10 @@ public:
 	UBotaniMM_WallRunning(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	//~ Begin UCommonMovementMode Interface
+	virtual void OnRegistered(const FName ModeName) override;
+	virtual void OnUnregistered() override;
 
-	/** Clears blackboard fields on deactivation */
+	/** Records the wall run end time on deactivation */
 	virtual void Deactivate() override;
 
 	/** Generates the movement data that will be consumed by the simulation tick */
@@ -46,6 +49,7 @@ protected:
 	void CaptureFinalState(const FWallCheckResult& WallResult, float DeltaSecondsUsed, FMoverTickEndData& TickEndData, FMovementRecord& Record);
 
 protected:
-	/** Effective Velocity calculated this frame */
-	FVector EffectiveVelocity;
+	/** Pointer to the botani wall run settings. */
+	UPROPERTY()
+	TObjectPtr<const UBotaniWallRunMovementSettings> BotaniWallRunSettings;
 };
@@ -58,6 +58,9 @@ public:
 	MY_API virtual bool ShouldExpandingMaintainBase(const UCommonMoverComponent* MoverComp) const;
 
 public:
+	/** Source key the stance pushes its movement settings overrides under. */
+	static MY_API const FName MovementSettingsModifierSource;
+
 	/** The current stance mode that this modifier is applying. */
 	UPROPERTY(Transient)
 	EBotaniStanceMode ActiveStance;
@@ -0,0 +1,62 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FRichCurve;
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Fixed-size, uniformly sampled bake of a rich curve.
+ * Inputs outside the curve's key range are clamped, evaluation is a single lerp between two samples.
+ */
+struct FBotaniCurveLookupTable
+{
+	/** Number of uniformly spaced samples taken across the curve's key range. */
+	static constexpr int32 NumSamples = 64;
+
+	/** Samples the given curve. If the curve has no data, every evaluation returns the default value. */
+	MY_API void Bake(const FRichCurve* Curve, float InDefaultValue);
+
+	/** Returns true if a curve with data was baked into this table. */
+	bool HasData() const
+	{
+		return bHasData;
+	}
+
+	/** Evaluates the table at the given time. */
+	float Eval(float InTime) const
+	{
+		if (!bHasData)
+		{
+			return DefaultValue;
+		}
+
+		const float SampleCoord = FMath::Clamp((InTime - MinTime) * InvSampleStep, 0.f, static_cast<float>(NumSamples - 1));
+		const int32 SampleIndex = FMath::Min(FMath::FloorToInt32(SampleCoord), NumSamples - 2);
+		return FMath::Lerp(Samples[SampleIndex], Samples[SampleIndex + 1], SampleCoord - SampleIndex);
+	}
+
+	/** Evaluates the table for a whole batch of times at once, four at a time using SIMD. Both views must have the same size. */
+	MY_API void EvalBatch(TConstArrayView<float> InTimes, TArrayView<float> OutValues) const;
+
+private:
+	/** Time of the first sample. */
+	float MinTime = 0.f;
+
+	/** Inverse of the time between two samples, zero for constant curves. */
+	float InvSampleStep = 0.f;
+
+	/** Value returned if no curve data was baked. */
+	float DefaultValue = 0.f;
+
+	/** True if a curve with data was baked. */
+	bool bHasData = false;
+
+	/** The baked samples. */
+	alignas(16) float Samples[NumSamples] = {};
+};
+
+#undef MY_API
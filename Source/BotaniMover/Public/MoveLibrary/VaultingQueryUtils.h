@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BotaniMoverSurfaceFilter.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 
 #include "VaultingQueryUtils.generated.h"
@@ -10,6 +11,7 @@
 #define MY_API BOTANIMOVER_API
 
 struct FMovingComponentSet;
+class USceneComponent;
 
 /** Data about a vaulting path, used by mover simulations. */
 USTRUCT(BlueprintType)
@@ -72,9 +74,19 @@ class UVaultingQueryUtils : public UBlueprintFunctionLibrary
 	GENERATED_BODY()
 
 public:
-	/** Performs a vaulting path query for the given moving component set, checking if a vaulting path may exist at the given location. */
+	/**
+	 * Performs a vaulting path query for the given moving component set, checking if a vaulting path may exist at the given location.
+	 * Traces on the given channel, or on the pawn's own channel with its responses if none is given. Hits that fail the surface filter are traced through.
+	 * If a simulation frame is given, the candidates prefetched for that frame are tested instead of querying the scene.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Mover|Vaulting")
-	static MY_API void FindVaultingPath(const FMovingComponentSet& MovingComps, float MaxVaultHeight, float MinVaultHeight, float VaultSweepDistance, uint8 VaultingSamples, const FVector& Location, const FRotator& Rotation, const FFloatRange& VaultingSlopeCosineRange, FVaultingPathCheckResult& OutVaultingResult);
+	static MY_API void FindVaultingPath(const FMovingComponentSet& MovingComps, float MaxVaultHeight, float MinVaultHeight, float VaultSweepDistance, uint8 VaultingSamples, const FVector& Location, const FRotator& Rotation, const FFloatRange& VaultingSlopeCosineRange, const FBotaniMoverSurfaceFilter& SurfaceFilter, FVaultingPathCheckResult& OutVaultingResult, int32 SimFrame = -1, ECollisionChannel TraceChannel = ECC_MAX);
+
+	/** Returns the radius of a sphere around the pawn's location that contains all vaulting samples. */
+	static MY_API float GetVaultingProbeRadius(const USceneComponent* UpdatedComponent, float MaxVaultHeight, float VaultSweepDistance);
+
+	/** Returns the radius and half height of the pawn's collision, falling back to a humanoid size. */
+	static MY_API void GetPawnCollisionSize(const USceneComponent* UpdatedComponent, float& OutRadius, float& OutHalfHeight);
 
 	/** Verifies whether the vaulting path is vaultable, checking physical materials, slope angles, etc. */
 	UFUNCTION(BlueprintCallable, Category = "Mover|Vaulting")
@@ -13,6 +13,9 @@ struct FMovingComponentSet;
 struct FSimulationTickParams;
 struct FHitResult;
 class UMoverComponent;
+class UPhysicalMaterial;
+class UPrimitiveComponent;
+class UBotaniWallRunMovementSettings;
 
 /** Enum for specifying which wall side to trace for wall running */
 UENUM(BlueprintType)
@@ -26,6 +29,105 @@ enum EBotaniWallRunSide
 
 #define MY_API BOTANIMOVER_API
 
+/** The parts of a wall hit that wall running actually uses, a lot cheaper to copy around than a full FHitResult */
+USTRUCT(BlueprintType)
+struct FWallContact
+{
+	GENERATED_BODY()
+
+public:
+	FWallContact()
+		: Normal(FVector::ZeroVector)
+		, ImpactPoint(FVector::ZeroVector)
+		, Distance(0.f)
+		, Side(Wall_Error)
+	{
+	}
+
+	const FVector& GetNormal() const
+	{
+		return Normal;
+	}
+
+	const FVector& GetImpactPoint() const
+	{
+		return ImpactPoint;
+	}
+
+	float GetDistance() const
+	{
+		return Distance;
+	}
+
+	UPrimitiveComponent* GetComponent() const
+	{
+		return Component.Get();
+	}
+
+	UPhysicalMaterial* GetPhysMaterial() const
+	{
+		return PhysMaterial.Get();
+	}
+
+	EBotaniWallRunSide GetSide() const
+	{
+		return Side;
+	}
+
+	void SetSide(const EBotaniWallRunSide InSide)
+	{
+		Side = InSide;
+	}
+
+	/** Returns the actor owning the wall component, if any. */
+	MY_API AActor* GetActor() const;
+
+	MY_API void SetFromHitResult(const FHitResult& InHit, const float InDistance);
+
+	/** Fills the contact from a wall probe. */
+	MY_API void SetFromProbe(const FVector& InNormal, const FVector& InImpactPoint, const float InDistance, const EBotaniWallRunSide InSide, UPrimitiveComponent* InComponent);
+
+	/** Builds a blocking hit result from this contact, for code that still works with hit results. */
+	MY_API FHitResult ToHitResult(const FVector& TraceStart) const;
+
+	/** Moves the contact to another point on the same wall. */
+	void SetImpactPoint(const FVector& InImpactPoint, const float InDistance)
+	{
+		ImpactPoint = InImpactPoint;
+		Distance = InDistance;
+	}
+
+	void Reset()
+	{
+		*this = FWallContact();
+	}
+
+protected:
+	/** Normal of the wall at the impact point, pointing away from the wall. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FVector Normal;
+
+	/** Location of the impact on the wall. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FVector ImpactPoint;
+
+	/** The distance to the wall, computed from the trace. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	float Distance;
+
+	/** Which side of the character the wall is on. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	TEnumAsByte<EBotaniWallRunSide> Side;
+
+	/** Component of the wall that was hit. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	/** Physical material of the wall, only set if the trace returned it. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	TWeakObjectPtr<UPhysicalMaterial> PhysMaterial;
+};
+
 /** Data about the wall for wall running movement, used by Mover simulations */
 USTRUCT(BlueprintType)
 struct FWallCheckResult
@@ -36,8 +138,6 @@ public:
 	FWallCheckResult()
 		: bBlockingHit(false)
 		, bRunAbleWall(false)
-		, WallDist(0.f)
-		, HitResult(1.f)
 	{
 	}
 
@@ -50,22 +150,38 @@ public:
 	{
 		bBlockingHit = false;
 		bRunAbleWall = false;
-		WallDist = 0.f;
-		HitResult.Reset(1.f, false);
+		Contact.Reset();
 	}
 
 	float GetDistanceToWall() const
 	{
-		return WallDist;
+		return Contact.GetDistance();
+	}
+
+	const FWallContact& GetContact() const
+	{
+		return Contact;
 	}
 
-	FHitResult GetHitResult() const
+	EBotaniWallRunSide GetWallSide() const
 	{
-		return HitResult;
+		return Contact.GetSide();
+	}
+
+	void SetWallSide(const EBotaniWallRunSide InWallSide)
+	{
+		Contact.SetSide(InWallSide);
 	}
 
 	MY_API void SetFromHitResult(const FHitResult& InHit, const float InWallDist, const bool bIsRunAbleWall);
 
+	void SetFromContact(const FWallContact& InContact, const bool bInIsRunAbleWall)
+	{
+		bBlockingHit = true;
+		bRunAbleWall = bInIsRunAbleWall;
+		Contact = InContact;
+	}
+
 protected:
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Wall)
 	uint8 bBlockingHit : 1;
@@ -74,13 +190,186 @@ protected:
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Wall)
 	uint8 bRunAbleWall : 1;
 
-	/** The distance to the wall, computed from the trace. */
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Wall)
-	float WallDist;
+	/** The wall that was found. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FWallContact Contact;
+};
 
-	/** Hit result of the test that found a wall. */
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Wall)
-	FHitResult HitResult;
+/** Closest wall on each side of the character, as found by UWallRunningMovementUtils::ProbeWalls. */
+USTRUCT(BlueprintType)
+struct FWallProbeResult
+{
+	GENERATED_BODY()
+
+public:
+	FWallProbeResult()
+		: bHitLeft(false)
+		, bHitRight(false)
+	{
+	}
+
+	bool HasWall(const EBotaniWallRunSide Side) const
+	{
+		return ((Side & Wall_Left) && bHitLeft) || ((Side & Wall_Right) && bHitRight);
+	}
+
+	/** Returns the closest wall on the given sides, or nullptr if there is none. */
+	const FWallContact* GetClosestWall(const EBotaniWallRunSide Sides = Wall_Both) const
+	{
+		const FWallContact* LeftWall = ((Sides & Wall_Left) && bHitLeft) ? &Left : nullptr;
+		const FWallContact* RightWall = ((Sides & Wall_Right) && bHitRight) ? &Right : nullptr;
+		if (LeftWall && RightWall)
+		{
+			return (LeftWall->GetDistance() <= RightWall->GetDistance()) ? LeftWall : RightWall;
+		}
+
+		return LeftWall ? LeftWall : RightWall;
+	}
+
+public:
+	/** Closest wall on the left side. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FWallContact Left;
+
+	/** Closest wall on the right side. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FWallContact Right;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	uint8 bHitLeft : 1;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	uint8 bHitRight : 1;
+};
+
+/**
+ * Plane and extent of a planar wall, captured when a wall run starts or the wall is probed again.
+ * While the pawn stays well inside of the extent, the wall contact is derived from the plane instead of probing the world.
+ */
+USTRUCT(BlueprintType)
+struct FBotaniWallPlane
+{
+	GENERATED_BODY()
+
+public:
+	FBotaniWallPlane()
+		: Origin(FVector::ZeroVector)
+		, Normal(FVector::ZeroVector)
+		, Tangent(FVector::ZeroVector)
+		, Bitangent(FVector::ZeroVector)
+		, Extent(ForceInit)
+		, ConfirmedContactPoint(FVector::ZeroVector)
+		, CaptureSimTimeMs(0.0)
+		, bValid(false)
+	{
+	}
+
+	bool IsValid() const
+	{
+		return bValid;
+	}
+
+	const FVector& GetNormal() const
+	{
+		return Normal;
+	}
+
+	double GetCaptureSimTimeMs() const
+	{
+		return CaptureSimTimeMs;
+	}
+
+	const UPrimitiveComponent* GetComponent() const
+	{
+		return Contact.GetComponent();
+	}
+
+	/** Returns the last point on the plane that a trace confirmed the wall at. */
+	const FVector& GetConfirmedContactPoint() const
+	{
+		return ConfirmedContactPoint;
+	}
+
+	/** Stores the point on the plane that a trace just confirmed the wall at. */
+	void SetConfirmedContactPoint(const FVector& InContactPoint)
+	{
+		ConfirmedContactPoint = InContactPoint;
+	}
+
+	/**
+	 * Captures the plane of the wall behind the given contact.
+	 * Fails if the wall has no simple collision or isn't planar within PlanarityProbeDistance of the contact.
+	 */
+	MY_API bool Capture(const FWallContact& InContact, const FVector& UpDirection, const double InSimTimeMs, const float PlanarityProbeDistance);
+
+	/** Returns the location in 2D wall space, X along the wall and Y up the wall. */
+	FVector2D ToWallSpace(const FVector& WorldLocation) const
+	{
+		const FVector Delta = WorldLocation - Origin;
+		return FVector2D(Delta | Tangent, Delta | Bitangent);
+	}
+
+	/** Returns the signed distance of the location to the wall, positive in front of it. */
+	float GetDistance(const FVector& WorldLocation) const
+	{
+		return (WorldLocation - Origin) | Normal;
+	}
+
+	/** Returns true if the wall space location is within the given margins of the edge of the wall. */
+	bool IsNearEdge(const FVector2D& WallLocation, const FVector2D& Margin) const
+	{
+		return WallLocation.X < Extent.Min.X + Margin.X || WallLocation.X > Extent.Max.X - Margin.X
+			|| WallLocation.Y < Extent.Min.Y + Margin.Y || WallLocation.Y > Extent.Max.Y - Margin.Y;
+	}
+
+	/** Returns true if the wall's component is gone or has moved since the plane was captured. */
+	MY_API bool HasWallMoved() const;
+
+	/** Returns the contact a wall probe from the given location would find on this plane. */
+	MY_API FWallContact MakeContact(const FVector& WorldLocation) const;
+
+protected:
+	/** Point on the wall the plane was captured at. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FVector Origin;
+
+	/** Normal of the wall, pointing away from it. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FVector Normal;
+
+	/** Horizontal direction along the wall. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FVector Tangent;
+
+	/** Direction up the wall. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FVector Bitangent;
+
+	/** Extent of the wall in wall space, taken from the bounds of its component. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FBox2D Extent;
+
+	/** Transform of the wall's component at capture time. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FTransform WallTransform;
+
+	/** The contact the plane was captured from. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FWallContact Contact;
+
+	/**
+	 * Last point on the plane that a trace confirmed the wall at.
+	 * The extent is only the wall's bounds, so openings inside of it are found by confirming the wall as the pawn moves along.
+	 */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	FVector ConfirmedContactPoint;
+
+	/** Simulation time the plane was captured at. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	double CaptureSimTimeMs;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Wall)
+	uint8 bValid : 1;
 };
 
 /** Input parameters for controlled wall running movement function */
@@ -155,23 +444,61 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Mover)
 	static MY_API bool IsWallRunning(const FSimulationTickParams& TickParams);
 
+	/**
+	 * Finds the closest wall on each requested side with a single overlap query.
+	 * A wall counts if one of the side's trace vectors (see WallTraceVectorsHeadDelta/TailDelta) would reach it.
+	 * Falls back to line traces for walls without simple collision.
+	 */
+	UFUNCTION(BlueprintCallable, Category = Mover)
+	static MY_API bool ProbeWalls(const UMoverComponent* MoverComponent, FWallProbeResult& OutProbeResult, float WallTraceVectorsHeadDelta, float WallTraceVectorsTailDelta, EBotaniWallRunSide WallSide = Wall_Both);
+
 	/** Performs the wall trace to find a valid wall to run on */
 	UFUNCTION(BlueprintCallable, Category = Mover)
 	static MY_API bool PerformWallTrace(const FMovingComponentSet& MovingComps, FHitResult& OutWallHit, float WallTraceVectorsHeadDelta, float WallTraceVectorsTailDelta, EBotaniWallRunSide WallSide = Wall_Both);
 	UFUNCTION(BlueprintCallable, Category = Mover)
 	static MY_API bool PerformWallTrace_Mover(const UMoverComponent* MoverComponent, FHitResult& OutWallHit, float WallTraceVectorsHeadDelta, float WallTraceVectorsTailDelta, EBotaniWallRunSide WallSide = Wall_Both);
 
-	/** Constructs the trace parameters to ignore the owner of the mover component */
+	/** Returns which side of the character a wall hit is on */
+	UFUNCTION(BlueprintCallable, Category = Mover)
+	static MY_API EBotaniWallRunSide GetWallSide(const FHitResult& WallHit, const FVector& RightDirection);
+
+	/** Returns a copy of the trace parameters that ignore the owner of the mover component. Hot paths should use UBotaniMoverComponent::FindCollisionParams instead. */
 	static MY_API FCollisionQueryParams GetIgnoreOwnerQueryParams(const UMoverComponent* InMoverComponent);
 
 	/** Returns the angle of a wall hit result relative to the up direction */
 	UFUNCTION(BlueprintCallable, Category = Mover)
 	static MY_API float GetWallAngle(const FHitResult& WallHit, const FVector& UpDirection = FVector::UpVector);
+	static MY_API float GetWallAngle(const FWallContact& Wall, const FVector& UpDirection = FVector::UpVector);
 
 	/** Returns whether we want to fall off the wall based on the current wall hit */
 	UFUNCTION(BlueprintCallable, Category = Mover)
 	static MY_API bool ShouldFallOffWall(const FHitResult& WallHit, const float& PullAwayAngle, const FVector& MoveIntent);
 
+	/** Same as ShouldFallOffWall, but takes the already computed sine of the pull away angle. */
+	static MY_API bool ShouldFallOffWall_Sine(const FHitResult& WallHit, float SinPullAwayAngle, const FVector& MoveIntent);
+	static MY_API bool ShouldFallOffWall_Sine(const FWallContact& Wall, float SinPullAwayAngle, const FVector& MoveIntent);
+
+	/** Returns true if the wall angle is below the min required angle, using the already computed cosine of that angle. */
+	static bool IsWallTooSteep(const FHitResult& WallHit, float CosMinRequiredAngle, const FVector& UpDirection = FVector::UpVector)
+	{
+		// Smaller angles have greater cosines
+		return (WallHit.Normal | UpDirection) > CosMinRequiredAngle;
+	}
+
+	static bool IsWallTooSteep(const FWallContact& Wall, float CosMinRequiredAngle, const FVector& UpDirection = FVector::UpVector)
+	{
+		return (Wall.GetNormal() | UpDirection) > CosMinRequiredAngle;
+	}
+
+	/**
+	 * Returns the gravity scale from the baked gravity curves (velocity curve times time curve).
+	 * Pass zero as tangent acceleration if the pawn is moving upwards.
+	 */
+	static MY_API float ComputeWallRunGravityScale(const UBotaniWallRunMovementSettings* WallRunSettings, float TangentAccel, float WallRunSeconds);
+
+	/** Same as ComputeWallRunGravityScale, but for a whole batch of pawns at once. All views must have the same size. */
+	static MY_API void ComputeWallRunGravityScales(const UBotaniWallRunMovementSettings* WallRunSettings, TConstArrayView<float> TangentAccels, TConstArrayView<float> WallRunSeconds, TArrayView<float> OutGravityScales);
+
 	/** Checks if we are high enough above any floor to consider starting a wall run */
 	UFUNCTION(BlueprintCallable, Category = Mover)
 	static MY_API bool IsHighEnoughForWallRun(const FMovingComponentSet& MovingComps, float MinHeightAboveFloor = 100.f, const FVector& UpDirection = FVector::UpVector);
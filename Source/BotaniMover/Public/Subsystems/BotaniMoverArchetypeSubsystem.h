@@ -0,0 +1,55 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "BotaniMoverArchetypeSubsystem.generated.h"
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Hands out one immutable settings instance per archetype, so pawns spawned from the same archetype
+ * don't each carry their own copy of every shared settings object. The shared instances are copies owned by the subsystem.
+ * Only settings that are identical to the archetype's settings are shared, per instance overrides keep their own copy.
+ */
+UCLASS(MinimalAPI)
+class UBotaniMoverArchetypeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem Interface
+	MY_API virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	MY_API virtual void Deinitialize() override;
+	//~ End UWorldSubsystem Interface
+
+	/**
+	 * Replaces the entries of the given settings array with the shared instances for the archetype's settings.
+	 * @param ArchetypeSettings	The shared settings of the mover component's archetype.
+	 * @param InOutSettings		The mover component's shared settings.
+	 * @returns The approximate number of bytes that are no longer needed, 0 for the first pawn to share an instance.
+	 *			It's the size of the settings objects only, anything they allocate on the heap isn't counted.
+	 */
+	MY_API int64 ShareSettingsWithArchetype(TConstArrayView<TObjectPtr<UObject>> ArchetypeSettings, TArray<TObjectPtr<UObject>>& InOutSettings);
+
+	/** Returns true if the given settings object is a shared instance handed out by an archetype subsystem. Shared instances must not be changed. */
+	static bool IsSharedInstance(const UObject* Settings) { return Settings && Settings->GetOuter() && Settings->GetOuter()->IsA<UBotaniMoverArchetypeSubsystem>(); }
+
+	/** Returns the approximate total number of bytes saved by sharing settings in this world, see ShareSettingsWithArchetype. */
+	int64 GetTotalSavedBytes() const { return TotalSavedBytes; }
+
+private:
+	/** Returns true if all properties of both settings objects are identical. */
+	static bool AreSettingsIdentical(const UObject* A, const UObject* B);
+
+	/** Shared settings instances, keyed by the archetype's settings object they mirror. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<const UObject>, TObjectPtr<UObject>> SharedSettings;
+
+	/** Approximate total number of bytes saved by sharing settings in this world. */
+	int64 TotalSavedBytes = 0;
+};
+
+#undef MY_API
@@ -0,0 +1,170 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "BotaniMoverQueryBudgetSubsystem.generated.h"
+
+class UMoverComponent;
+
+#define MY_API BOTANIMOVER_API
+
+/** The kinds of collision queries counted against the query budget. */
+enum class EBotaniMoverQuery : uint8
+{
+	/** Move, step and slide sweeps. */
+	Move,
+
+	/** Floor sweeps. */
+	Floor,
+
+	/** Wall probes. */
+	Wall,
+
+	/** Height checks above the floor, like IsHighEnoughForWallRun. */
+	Height,
+
+	/** Vaulting path samples. */
+	Vault,
+
+	Num
+};
+
+/** Scheduling priority of a pawn's optional queries. */
+enum class EBotaniMoverQueryPriority : uint8
+{
+	/** Player controlled, never deferred. */
+	Player,
+
+	/** In the highest movement LOD tier, may use the whole budget. */
+	Near,
+
+	/** In a lower movement LOD tier, time-sliced and limited to a share of the budget. */
+	Far
+};
+
+/** Per pawn bookkeeping of the query budget, owned by the mover component. */
+struct FBotaniMoverQueryBudgetState
+{
+	/** Last frame an optional query of the pawn was deferred. */
+	uint64 LastDeferredFrame = 0;
+
+	/** Number of frames in a row the pawn's optional queries were deferred. */
+	int32 NumDeferredFrames = 0;
+
+	/** Budget decision of a simulation tick, see UBotaniMoverQueryBudgetSubsystem::TryAcquireOptionalSimQueries. */
+	struct FSimGrant
+	{
+		double SimTimeMs = 0.0;
+		bool bGranted = false;
+	};
+
+	/** Number of simulation ticks whose decisions are kept, enough to cover any rollback we resimulate. */
+	static constexpr int32 MaxSimGrants = 128;
+
+	/** Budget decisions of the most recent simulation ticks, oldest first. */
+	TArray<FSimGrant> SimGrants;
+};
+
+/**
+ * Enforces a per frame budget for the collision queries of all Botani movers in the world.
+ *
+ * Required queries, like the move and floor sweeps, always run but are counted against the budget.
+ * Optional queries have to be acquired first and are deferred when the budget is used up. Whether they run depends on
+ * the frame and on the other pawns, so only work that doesn't feed the simulation result may be optional,
+ * like the probe prefetches. Work that does feed it, like the vault scan, goes through TryAcquireOptionalSimQueries. Player controlled pawns are never deferred, pawns in the highest movement LOD tier
+ * may use the whole budget, all others only a share of it and only on their time slice. A pawn deferred for too many frames in a row
+ * runs its query regardless, so nobody starves.
+ */
+UCLASS(Config=Game, MinimalAPI)
+class UBotaniMoverQueryBudgetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem Interface
+	MY_API virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	//~ End UWorldSubsystem Interface
+
+	/** Counts required queries, they always run. */
+	MY_API void RecordQueries(const EBotaniMoverQuery Query, const int32 NumQueries = 1);
+
+	/** Counts required queries of the given mover component against its world's budget. */
+	static MY_API void RecordQueries(const UMoverComponent* MoverComp, const EBotaniMoverQuery Query, const int32 NumQueries = 1);
+
+	/**
+	 * Asks to run optional work of about EstimatedCost queries for the given mover component this frame.
+	 * Returns false if it has to be deferred to a later frame. The queries are counted once they actually run.
+	 */
+	MY_API bool TryAcquireOptional(const UMoverComponent* MoverComp, const int32 EstimatedCost = 1);
+
+	/** Asks the budget of the mover component's world, see TryAcquireOptional. Always succeeds without a budget. */
+	static MY_API bool TryAcquireOptionalQueries(const UMoverComponent* MoverComp, const int32 EstimatedCost = 1);
+
+	/**
+	 * Asks the budget for optional work whose result feeds the simulation tick at SimTimeMs, like the vault scan.
+	 * The budget is only asked the first time a tick is simulated, a resimulated tick replays that decision, so a rollback takes
+	 * the same path as the original tick. A deferred tick must leave the simulation as if the work found nothing.
+	 */
+	static MY_API bool TryAcquireOptionalSimQueries(const UMoverComponent* MoverComp, const double SimTimeMs, const int32 EstimatedCost = 1);
+
+	/** Returns the scheduling priority of the given mover component's optional queries. */
+	static MY_API EBotaniMoverQueryPriority GetQueryPriority(const UMoverComponent* MoverComp);
+
+	/** Returns the number of queries counted during the last completed frame. */
+	UFUNCTION(BlueprintPure, Category="Mover|Debug")
+	MY_API int32 GetLastFrameQueries() const;
+
+	/** Returns the number of optional queries deferred during the last completed frame. */
+	UFUNCTION(BlueprintPure, Category="Mover|Debug")
+	MY_API int32 GetLastFrameDeferrals() const;
+
+	/** Returns the number of queries of the given kind counted during the last completed frame. */
+	MY_API int32 GetLastFrameQueries(const EBotaniMoverQuery Query) const;
+
+protected:
+	/** Starts counting a new frame if the engine moved on since the last query. */
+	MY_API void BeginFrameIfNeeded();
+
+	/** Maximum number of queries per frame before optional queries are deferred. 0 disables the budget. */
+	UPROPERTY(Config)
+	int32 QueryBudgetPerFrame = 512;
+
+	/** Share of the budget that pawns outside the highest movement LOD tier may use. */
+	UPROPERTY(Config)
+	float FarBudgetShare = 0.5f;
+
+	/** Pawns outside the highest movement LOD tier only run optional queries every this many frames. */
+	UPROPERTY(Config)
+	int32 FarQueryInterval = 4;
+
+	/** Number of frames in a row a pawn's optional queries may be deferred before they run regardless of the budget. */
+	UPROPERTY(Config)
+	int32 MaxDeferredFrames = 8;
+
+private:
+	/** Frame the counters belong to. */
+	uint64 CurrentFrame = 0;
+
+	/** Queries per kind counted during the current frame. */
+	int32 FrameQueries[static_cast<uint8>(EBotaniMoverQuery::Num)] = {};
+
+	/** Queries counted during the current frame. */
+	int32 NumFrameQueries = 0;
+
+	/** Optional queries deferred during the current frame. */
+	int32 NumFrameDeferrals = 0;
+
+	/** Queries per kind counted during the last completed frame. */
+	int32 LastFrameQueries[static_cast<uint8>(EBotaniMoverQuery::Num)] = {};
+
+	/** Queries counted during the last completed frame. */
+	int32 NumLastFrameQueries = 0;
+
+	/** Optional queries deferred during the last completed frame. */
+	int32 NumLastFrameDeferrals = 0;
+};
+
+#undef MY_API
@@ -0,0 +1,67 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IBotaniMoverPhysicalMaterial.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "BotaniPhysicalMaterialSubsystem.generated.h"
+
+class UPhysicalMaterial;
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Table of the movement properties of all physical materials implementing IBotaniMoverPhysicalMaterial, keyed by material.
+ * Loaded materials are gathered on startup, materials that are loaded later are added the first time they are looked up.
+ * In the editor, the entry of a material is rebuilt when one of its properties is changed.
+ */
+UCLASS(MinimalAPI)
+class UBotaniPhysicalMaterialSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem Interface
+	MY_API virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	MY_API virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	/**
+	 * Returns the movement properties of the given physical material, or nullptr if it doesn't implement IBotaniMoverPhysicalMaterial.
+	 * The result is only valid until the next lookup, which may add an entry to the table.
+	 */
+	static MY_API const FBotaniPhysicalMaterialMovementProperties* FindMovementProperties(const UPhysicalMaterial* PhysMaterial);
+
+	/** Adds or refreshes the table entry of the given physical material. */
+	MY_API void RegisterPhysicalMaterial(const UPhysicalMaterial* PhysMaterial);
+
+private:
+	/** Table entry of a single physical material. */
+	struct FMaterialEntry
+	{
+		/** The cached movement properties. */
+		FBotaniPhysicalMaterialMovementProperties Properties;
+
+		/** Whether the material implements IBotaniMoverPhysicalMaterial. */
+		bool bHasProperties = false;
+	};
+
+#if WITH_EDITOR
+	/** Drops the entry of an edited physical material, so it is rebuilt with the new properties. */
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+
+	/** Handle of the property changed callback. */
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
+
+	/** Movement properties per physical material, plain materials are kept too so they are only looked at once. */
+	TMap<TObjectKey<UPhysicalMaterial>, FMaterialEntry> MaterialEntries;
+
+	/** The active subsystem, so the simulation doesn't have to go through the engine to find it. */
+	static UBotaniPhysicalMaterialSubsystem* Instance;
+};
+
+#undef MY_API
@@ -0,0 +1,145 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WallRunIndex/BotaniWallRunIndex.h"
+
+#include "BotaniWallRunIndexSubsystem.generated.h"
+
+class ABotaniWallRunIndexActor;
+class UActorComponent;
+class UPrimitiveComponent;
+
+#define MY_API BOTANIMOVER_API
+
+/** Answer of the wall run index to whether there is a runnable wall near a location. */
+UENUM(BlueprintType)
+enum class EBotaniWallRunIndexResult : uint8
+{
+	/** No loaded index covers the location, so the regular probes have to decide. */
+	Unknown,
+
+	/** A baked index covers the location and has no runnable wall near it. */
+	NoWall,
+
+	/** A baked index has a runnable wall near the location. */
+	HasWall
+};
+
+/**
+ * Answers "is there a runnable wall near here?" from the baked wall run indices of all loaded levels, without any physics query.
+ * The indices only know static walls, so the subsystem also keeps the non-static components of the world in a spatial hash
+ * and never lets a wall probe be skipped while one of them is nearby.
+ */
+UCLASS(MinimalAPI)
+class UBotaniWallRunIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UWorldSubsystem Interface
+	MY_API virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	MY_API virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	MY_API virtual void Deinitialize() override;
+	//~ End UWorldSubsystem Interface
+
+	/** Makes the index of the given actor available to queries. */
+	MY_API void RegisterIndex(const ABotaniWallRunIndexActor* IndexActor);
+
+	/** Removes the index of the given actor, e.g. when its level is streamed out. */
+	MY_API void UnregisterIndex(const ABotaniWallRunIndexActor* IndexActor);
+
+	/**
+	 * Returns whether there is a baked runnable wall within the sphere.
+	 * Patches that fail the given angle test are ignored, the default accepts everything that was baked.
+	 */
+	MY_API EBotaniWallRunIndexResult QueryRunnableWalls(const FVector& Location, const float Radius, const float CosMinRequiredAngle = 1.f, const FVector& UpDirection = FVector::UpVector) const;
+
+	/**
+	 * Returns true if there can't be a runnable wall within the sphere, so wall probes can be skipped.
+	 * That is the case if the baked indices rule out static walls and no non-static component blocking the wall channel is nearby.
+	 * Components of the IgnoreActor, usually the probing pawn, don't count.
+	 */
+	static MY_API bool CanSkipWallProbe(
+		const UWorld* World,
+		const FVector& Location,
+		const float Radius,
+		const ECollisionChannel WallChannel,
+		const AActor* IgnoreActor,
+		const float CosMinRequiredAngle = 1.f,
+		const FVector& UpDirection = FVector::UpVector);
+
+	/** Returns true if any tracked non-static component blocking the wall channel may be within the sphere. */
+	MY_API bool HasDynamicGeometry(const FVector& Location, const float Radius, const ECollisionChannel WallChannel, const AActor* IgnoreActor) const;
+
+	/** Returns all baked wall patches within the sphere, e.g. for AI looking for walls to run on. */
+	UFUNCTION(BlueprintCallable, Category = "Mover|Wall Running")
+	MY_API void FindRunnableWalls(const FVector& Location, float Radius, TArray<FBotaniWallPatch>& OutPatches) const;
+
+	/** Side length of the cells the non-static components are hashed into. */
+	static constexpr float DynamicCellSize = 1000.f;
+
+	/** Components overlapping more cells than this are kept in a list that every query checks, instead of the hash. */
+	static constexpr int32 MaxDynamicCellsPerComponent = 64;
+
+private:
+	struct FDynamicComponent
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+
+		/** Cells the component's bounds were hashed into, inclusive. Empty for oversized components. */
+		FIntVector MinCell = FIntVector::ZeroValue;
+		FIntVector MaxCell = FIntVector(-1);
+
+		/** Handle of the transform updated callback. */
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	/**
+	 * Starts or stops tracking the given component, depending on whether it is a non-static primitive of our world.
+	 * Runs whenever a component creates its physics state, so it picks up spawned actors, streamed in levels,
+	 * components added after spawning and components that became movable, which re-registers them.
+	 */
+	void OnComponentCreatedPhysicsState(UActorComponent* Component);
+
+	/** Stops tracking the given component. */
+	void OnComponentDestroyedPhysicsState(UActorComponent* Component);
+
+	/** Moves a tracked component to the cells of its new bounds. */
+	void OnDynamicComponentTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	void TrackDynamicComponent(UPrimitiveComponent* Component);
+	void UntrackDynamicComponent(const UActorComponent* Component);
+
+	/** Hashes the component into the cells overlapped by its bounds, removing it from the cells it was in before. */
+	void HashDynamicComponent(const TObjectKey<UPrimitiveComponent> Key, FDynamicComponent& Entry);
+	void UnhashDynamicComponent(const TObjectKey<UPrimitiveComponent> Key, FDynamicComponent& Entry);
+
+	/** Returns true if the component may be a wall within the sphere. */
+	static bool IsDynamicWallNearby(const UPrimitiveComponent* Component, const FVector& Location, const float RadiusSquared, const ECollisionChannel WallChannel, const AActor* IgnoreActor);
+
+	/** Returns the range of cells overlapped by the box. */
+	static void GetCellRange(const FBox& Box, FIntVector& OutMinCell, FIntVector& OutMaxCell);
+
+	/** Actors holding the indices of the loaded levels. */
+	TArray<TWeakObjectPtr<const ABotaniWallRunIndexActor>> IndexActors;
+
+	/** Every stationary and movable primitive component of the world, none of them are in the baked indices. */
+	TMap<TObjectKey<UPrimitiveComponent>, FDynamicComponent> DynamicComponents;
+
+	/** Tracked components by the cells their bounds overlap. */
+	using FDynamicCell = TArray<TObjectKey<UPrimitiveComponent>, TInlineAllocator<4>>;
+	TMap<FIntVector, FDynamicCell> DynamicCells;
+
+	/** Tracked components too large to be hashed. */
+	TArray<TObjectKey<UPrimitiveComponent>> OversizedDynamicComponents;
+
+	/** Handles of the global physics state callbacks. */
+	FDelegateHandle CreatePhysicsStateHandle;
+	FDelegateHandle DestroyPhysicsStateHandle;
+};
+
+#undef MY_API
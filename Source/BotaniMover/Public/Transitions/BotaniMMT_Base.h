@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BotaniTimerSyncState.h"
 #include "GameplayTagContainer.h"
 #include "MovementModeTransition.h"
 
@@ -28,9 +29,12 @@ protected:
 	UPROPERTY(EditAnywhere, Category=Trigger)
 	FGameplayTag TriggerEventTag;
 
-	/** If a name is provided, it will be used to log the transition trigger time into the Blackboard under that key. */
+	/** If set, the transition trigger time is recorded into this timer of the FBotaniTimerSyncState. */
 	UPROPERTY(EditAnywhere, Category=Trigger)
-	FName BlackboardTimeLoggingKey;
+	EBotaniMoverTimer TriggerTimer = EBotaniMoverTimer::None;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage="Use TriggerTimer instead."))
+	FName BlackboardTimeLoggingKey_DEPRECATED;
 
 	/** If true, will create a visual log entry when the transition is triggered */
 	UPROPERTY(EditAnywhere, Category=Trigger)
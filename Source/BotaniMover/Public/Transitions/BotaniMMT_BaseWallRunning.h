@@ -10,6 +10,7 @@
 
 #define MY_API BOTANIMOVER_API
 
+struct FWallContact;
 class UBotaniWallRunMovementSettings;
 /** Base class for all Wall Running transitions, provides a bunch of helper functions shared among other transitions. */
 UCLASS(MinimalAPI, Abstract)
@@ -26,8 +27,19 @@ public:
 	//~ End UBaseMovementModeTransition Interface
 
 protected:
-	/** Internal helper function that checks if there is a valid wall to run on. */
-	MY_API virtual bool CanStartWallRunning(const FSimulationTickParams& Params, FHitResult& OutHitResult) const;
+	/** Internal helper function that checks if there is a valid wall to run on, the wall side comes with the contact. */
+	MY_API virtual bool CanStartWallRunning(const FSimulationTickParams& Params, FWallContact& OutWall) const;
+
+	/**
+	 * Derives the wall from the captured wall plane without probing the world.
+	 * Fails if there is no plane, the wall moved, the revalidation interval expired, or the pawn is near the edge of the wall.
+	 * Whenever the pawn moved more than its radius along the plane since the wall was last confirmed, a single trace towards the plane
+	 * confirms it again, so gaps and openings within the wall's bounds aren't run over.
+	 */
+	MY_API bool TryGetWallFromPlane(const FSimulationTickParams& Params, FWallContact& OutWall) const;
+
+	/** Captures the plane of the given wall into the blackboard, or clears it if the wall isn't planar. */
+	MY_API void CaptureWallPlane(const FSimulationTickParams& Params, const FWallContact& Wall) const;
 
 protected:
 	/** Wall run settings that this transition depends on. */
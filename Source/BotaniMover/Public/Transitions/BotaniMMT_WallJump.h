@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BotaniMoverTagsSyncState.h"
+#include "BotaniTimerSyncState.h"
 #include "GameplayTagContainer.h"
 #include "MovementModeTransition.h"
 
@@ -27,6 +29,14 @@ class UBotaniMMT_WallJump : public UBaseMovementModeTransition
 public:
 	MY_API UBotaniMMT_WallJump(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	//~ Begin UObject Interface
+	MY_API virtual void PostInitProperties() override;
+	MY_API virtual void PostLoad() override;
+#if WITH_EDITOR
+	MY_API virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject Interface
+
 	//~ Begin UBaseMovementModeTransition Interface
 	MY_API virtual FTransitionEvalResult Evaluate_Implementation(const FSimulationTickParams& Params) const override;
 	MY_API virtual void Trigger_Implementation(const FSimulationTickParams& Params) override;
@@ -73,9 +83,22 @@ protected:
 	UPROPERTY(EditAnywhere, Category=Trigger)
 	FGameplayTag TriggerEventTag;
 
-	/** If a FName is provided, the simulation time of the wall jump will be saved to the Blackboard under that key */
+	/** If set, the simulation time of the wall jump will additionally be recorded into this timer */
 	UPROPERTY(EditAnywhere, Category=Trigger)
-	FName BlackboardTimeLoggingKey;
+	EBotaniMoverTimer TriggerTimer = EBotaniMoverTimer::None;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage="Use TriggerTimer instead."))
+	FName BlackboardTimeLoggingKey_DEPRECATED;
+
+private:
+	/** Compiles the tag containers into tag bits. */
+	MY_API void CompileTagMasks();
+
+	/** WallJumpRequiredTags compiled into tag bits. */
+	FBotaniCompiledTagMask WallJumpRequiredTagsMask;
+
+	/** WallJumpBlockedTags compiled into tag bits. */
+	FBotaniCompiledTagMask WallJumpBlockedTagsMask;
 };
 
 #undef MY_API
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "BotaniTimerSyncState.h"
 #include "GameplayTagContainer.h"
 #include "MovementModeTransition.h"
 
@@ -55,7 +56,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Trigger")
 	FGameplayTag TriggerEvent;
 
-	/** If a FName is provided, the simulation time of the jump will be saved to the Blackboard under that key */
+	/** If set, the simulation time of the wall run will additionally be recorded into this timer */
 	UPROPERTY(EditAnywhere, Category="Trigger")
-	FName BlackboardTimeLoggingKey;
+	EBotaniMoverTimer TriggerTimer = EBotaniMoverTimer::None;
+
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage="Use TriggerTimer instead."))
+	FName BlackboardTimeLoggingKey_DEPRECATED;
 };
@@ -0,0 +1,132 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BotaniMoverSurfaceFilter.h"
+#include "Engine/EngineTypes.h"
+
+#include "BotaniWallRunIndex.generated.h"
+
+class ULevel;
+
+#define MY_API BOTANIMOVER_API
+
+/** Settings used to bake a FBotaniWallRunIndex. */
+USTRUCT(BlueprintType)
+struct FBotaniWallRunIndexBakeSettings
+{
+	GENERATED_BODY()
+
+	/** The collision channel walls are probed on. Only components blocking this channel are baked. Should match the WallTraceChannel in use. */
+	UPROPERTY(EditAnywhere, Category = "Wall Run Index")
+	TEnumAsByte<ECollisionChannel> WallChannel = ECC_Camera;
+
+	/** Only components passing this filter are baked. Should match the WallSurfaceFilter in use. */
+	UPROPERTY(EditAnywhere, Category = "Wall Run Index")
+	FBotaniMoverSurfaceFilter SurfaceFilter = FBotaniMoverSurfaceFilter(NAME_None, TEXT("NoWallRun"));
+
+	/** Distance between the sample points the level collision is scanned with. Smaller values find thinner walls but bake slower. */
+	UPROPERTY(EditAnywhere, Category = "Wall Run Index", meta=(ClampMin=10, Units=cm))
+	float SampleSpacing = 100.f;
+
+	/** Size of the grid cells the wall patches are sorted into. */
+	UPROPERTY(EditAnywhere, Category = "Wall Run Index", meta=(ClampMin=50, Units=cm))
+	float CellSize = 400.f;
+};
+
+/** A small piece of a wall. The wall running angle test is applied when querying, so every hit surface is kept. */
+USTRUCT(BlueprintType)
+struct FBotaniWallPatch
+{
+	GENERATED_BODY()
+
+	/** Point on the wall's surface. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wall Run Index")
+	FVector3f Location = FVector3f::ZeroVector;
+
+	/** Normal of the wall, pointing away from it. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wall Run Index")
+	FVector3f Normal = FVector3f::ForwardVector;
+};
+
+/** Range of wall patches inside of a single grid cell. */
+USTRUCT()
+struct FBotaniWallRunIndexCell
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 FirstPatch = 0;
+
+	UPROPERTY()
+	int32 NumPatches = 0;
+};
+
+/**
+ * Static wall surfaces of a level, baked into a sparse grid of wall patches.
+ * Answers whether a runnable wall is near a location without any physics query. Only static components are baked,
+ * so the index can only rule out static walls, and only inside of the grid cells that were sampled.
+ * Stationary and movable walls must still be found by the regular wall probes.
+ */
+USTRUCT()
+struct FBotaniWallRunIndex
+{
+	GENERATED_BODY()
+
+	/** Returns true if this index has been baked. */
+	bool IsBaked() const { return CellSize > 0.f && !SampledCells.IsEmpty(); }
+
+	/** Returns true if every grid cell the sphere touches was sampled while baking. */
+	MY_API bool Covers(const FVector& Location, const float Radius) const;
+
+	/**
+	 * Returns true if any baked wall patch is within the sphere.
+	 * Patches that fail the given angle test are ignored, the default accepts everything that was baked.
+	 */
+	MY_API bool HasRunnableWall(const FVector& Location, const float Radius, const float CosMinRequiredAngle = 1.f, const FVector& UpDirection = FVector::UpVector) const;
+
+	/** Adds all baked wall patches within the sphere to the given array. */
+	MY_API void FindWallPatches(const FVector& Location, const float Radius, TArray<FBotaniWallPatch>& OutPatches) const;
+
+	/** Returns the number of baked wall patches. */
+	int32 GetNumPatches() const { return Patches.Num(); }
+
+	/** Returns the memory used by the baked data. */
+	MY_API SIZE_T GetAllocatedSize() const;
+
+#if WITH_EDITOR
+	/** Scans the static collision of the given level and rebuilds the index from it. */
+	MY_API void Bake(const ULevel* Level, const FBotaniWallRunIndexBakeSettings& Settings);
+#endif
+
+private:
+	/** Returns the grid cell containing the given location. */
+	FIntVector GetCellCoord(const FVector& Location) const;
+
+	/** Calls the given function for every patch within the sphere, until it returns false. */
+	template <typename FuncType>
+	void ForEachPatchInSphere(const FVector& Location, const float Radius, FuncType&& Func) const;
+
+	/** Size of a grid cell. */
+	UPROPERTY()
+	float CellSize = 0.f;
+
+	/** Distance from a patch within which its wall is assumed to continue, the diagonal of a sample cell. */
+	UPROPERTY()
+	float PatchRadius = 0.f;
+
+	/** The grid cells that were scanned while baking, walls or not. */
+	UPROPERTY()
+	TSet<FIntVector> SampledCells;
+
+	/** All wall patches, sorted by grid cell. */
+	UPROPERTY()
+	TArray<FBotaniWallPatch> Patches;
+
+	/** The patch range of every grid cell that has any patch. */
+	UPROPERTY()
+	TMap<FIntVector, FBotaniWallRunIndexCell> Cells;
+};
+
+#undef MY_API
@@ -0,0 +1,54 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BotaniWallRunIndex.h"
+#include "GameFramework/Info.h"
+
+#include "BotaniWallRunIndexActor.generated.h"
+
+#define MY_API BOTANIMOVER_API
+
+/**
+ * Holds the baked wall run index of the level it is placed in, so the index streams in and out with its level.
+ * Registers the index with the UBotaniWallRunIndexSubsystem while the level is loaded.
+ */
+UCLASS(MinimalAPI, DisplayName="Botani Wall Run Index", hidecategories=(Actor, Input, Replication, Rendering, Collision, HLOD, Physics, Networking, LevelInstance, Cooking, DataLayers, WorldPartition))
+class ABotaniWallRunIndexActor : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+	MY_API ABotaniWallRunIndexActor(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	//~ Begin AActor Interface
+	MY_API virtual void BeginPlay() override;
+	MY_API virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~ End AActor Interface
+
+	/** Returns the baked index. */
+	const FBotaniWallRunIndex& GetIndex() const { return Index; }
+
+#if WITH_EDITOR
+	/** Rebuilds the index from the static collision of this actor's level. */
+	UFUNCTION(CallInEditor, Category = "Wall Run Index")
+	MY_API void BakeWallRunIndex();
+#endif
+
+protected:
+	/** Settings used when baking the index. */
+	UPROPERTY(EditAnywhere, Category = "Wall Run Index")
+	FBotaniWallRunIndexBakeSettings BakeSettings;
+
+	/** Number of wall patches in the baked index. */
+	UPROPERTY(VisibleAnywhere, Category = "Wall Run Index")
+	int32 NumBakedPatches = 0;
+
+private:
+	/** The baked index. */
+	UPROPERTY()
+	FBotaniWallRunIndex Index;
+};
+
+#undef MY_API
@@ -0,0 +1,24 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class BotaniMoverEditor : ModuleRules
+{
+	public BotaniMoverEditor(ReadOnlyTargetRules target) : base(target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange( new []
+		{
+			"Core",
+		});
+
+
+		PrivateDependencyModuleNames.AddRange( new []
+		{
+			"CoreUObject",
+			"Engine",
+			"BotaniMover",
+		});
+	}
+}
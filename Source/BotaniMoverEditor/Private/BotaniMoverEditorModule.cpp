@@ -0,0 +1,5 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BotaniMoverEditorModule.h"
+
+IMPLEMENT_MODULE(FBotaniMoverEditorModule, BotaniMoverEditor)
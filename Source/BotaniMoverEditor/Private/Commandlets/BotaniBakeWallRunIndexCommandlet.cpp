@@ -0,0 +1,132 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+
+#include "Commandlets/BotaniBakeWallRunIndexCommandlet.h"
+
+#include "BotaniMoverLogChannels.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "WallRunIndex/BotaniWallRunIndexActor.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BotaniBakeWallRunIndexCommandlet)
+
+UBotaniBakeWallRunIndexCommandlet::UBotaniBakeWallRunIndexCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UBotaniBakeWallRunIndexCommandlet::Main(const FString& Params)
+{
+	FString MapsParam;
+	if (!FParse::Value(*Params, TEXT("Maps="), MapsParam, false))
+	{
+		BOTANIMOVER_ERROR("No maps given. Usage: -run=BotaniBakeWallRunIndex -Maps=/Game/Maps/MapA+/Game/Maps/MapB");
+		return 1;
+	}
+
+	TArray<FString> MapNames;
+	MapsParam.ParseIntoArray(MapNames, TEXT("+"));
+
+	int32 NumFailed = 0;
+	for (const FString& MapName : MapNames)
+	{
+		if (!BakeMap(MapName))
+		{
+			++NumFailed;
+		}
+	}
+
+	return NumFailed > 0 ? 1 : 0;
+}
+
+bool UBotaniBakeWallRunIndexCommandlet::BakeMap(const FString& MapName)
+{
+	UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (!World)
+	{
+		BOTANIMOVER_ERROR("Failed to load map '%s'.", *MapName);
+		return false;
+	}
+
+	// Only the loaded cells would be scanned, and the index would be baked from whatever happens to be loaded
+	if (World->IsPartitionedWorld())
+	{
+		BOTANIMOVER_ERROR("Map '%s' uses World Partition, which isn't supported by the wall run index bake.", *MapName);
+		return false;
+	}
+
+	// The components need their physics bodies to be traced against
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+			.ShouldSimulatePhysics(false)
+			.EnableTraceCollision(true)
+			.CreateNavigation(false)
+			.CreateAISystem(false)
+			.AllowAudioPlayback(false)
+			.CreatePhysicsScene(true));
+	}
+
+	World->UpdateWorldComponents(true, false);
+
+	// Reuse the placed index actor to keep its bake settings
+	ABotaniWallRunIndexActor* IndexActor = nullptr;
+	for (AActor* Actor : World->PersistentLevel->Actors)
+	{
+		IndexActor = Cast<ABotaniWallRunIndexActor>(Actor);
+		if (IndexActor)
+		{
+			break;
+		}
+	}
+
+	if (!IndexActor)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.OverrideLevel = World->PersistentLevel;
+		IndexActor = World->SpawnActor<ABotaniWallRunIndexActor>(SpawnParams);
+	}
+
+	bool bSaved = false;
+	if (IndexActor)
+	{
+		IndexActor->BakeWallRunIndex();
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Standalone;
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetMapPackageExtension());
+		bSaved = UPackage::SavePackage(Package, World, *Filename, SaveArgs);
+
+		// With one file per actor, the index lives in the actor's own package
+		if (bSaved && IndexActor->IsPackageExternal())
+		{
+			UPackage* ActorPackage = IndexActor->GetExternalPackage();
+			const FString ActorFilename = FPackageName::LongPackageNameToFilename(ActorPackage->GetName(), FPackageName::GetAssetPackageExtension());
+
+			FSavePackageArgs ActorSaveArgs;
+			ActorSaveArgs.TopLevelFlags = RF_NoFlags;
+			bSaved = UPackage::SavePackage(ActorPackage, nullptr, *ActorFilename, ActorSaveArgs);
+		}
+	}
+
+	if (!bSaved)
+	{
+		BOTANIMOVER_ERROR("Failed to bake the wall run index of map '%s'.", *MapName);
+	}
+
+	World->CleanupWorld();
+	World->RemoveFromRoot();
+
+	return bSaved;
+}
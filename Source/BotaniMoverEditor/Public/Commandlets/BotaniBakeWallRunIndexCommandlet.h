@@ -0,0 +1,36 @@
+﻿// Author: Tom Werner (MajorT), 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "BotaniBakeWallRunIndexCommandlet.generated.h"
+
+#define MY_API BOTANIMOVEREDITOR_API
+
+/**
+ * Bakes the wall run index of the given maps and saves them.
+ * Maps without a wall run index actor get one placed with the default bake settings.
+ * World Partition maps aren't supported, their cells would have to be loaded and baked one by one.
+ *
+ * Usage: -run=BotaniBakeWallRunIndex -Maps=/Game/Maps/MapA+/Game/Maps/MapB
+ */
+UCLASS(MinimalAPI)
+class UBotaniBakeWallRunIndexCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	MY_API UBotaniBakeWallRunIndexCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	//~ Begin UCommandlet Interface
+	MY_API virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	/** Loads, bakes and saves a single map. Returns false on failure. */
+	bool BakeMap(const FString& MapName);
+};
+
+#undef MY_API